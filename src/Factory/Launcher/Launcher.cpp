@@ -25,6 +25,7 @@
 #include "Launcher/Simulation/BFER_ite.hpp"
 #include "Launcher/Simulation/BFER_std.hpp"
 #include "Launcher/Simulation/EXIT.hpp"
+#include "Launcher/Simulation/DEC.hpp"
 
 #include "Factory/Module/Codec/BCH/Codec_BCH.hpp"
 #include "Factory/Module/Codec/LDPC/Codec_LDPC.hpp"
@@ -80,8 +81,8 @@ void factory::Launcher::parameters
 
 	opt_args[{p+"-type"}] =
 		{"string",
-		 "select the type of simulation to launch (default is BFER).",
-		 "BFER, BFERI"};
+		 "select the type of simulation to launch (default is BFER, DEC decodes a file of LLRs).",
+		 "BFER, BFERI, DEC"};
 
 #if !defined(PREC_8_BIT) && !defined(PREC_16_BIT)
 		 opt_args[{p+"-type"}][2] += ", EXIT";
@@ -244,6 +245,8 @@ launcher::Launcher* factory::Launcher::parameters
 	{
 		if (this->sim_type == "BFER")
 			return new launcher::Polar<launcher::BFER_std<B,R,Q>,B,R,Q>(argc, argv);
+		else if (this->sim_type == "DEC")
+			return new launcher::Polar<launcher::DEC<B,R,Q>,B,R,Q>(argc, argv);
 		else if (this->sim_type == "BFERI")
 			return new launcher::Polar<launcher::BFER_ite<B,R,Q>,B,R,Q>(argc, argv);
 	}
@@ -252,6 +255,8 @@ launcher::Launcher* factory::Launcher::parameters
 	{
 		if (this->sim_type == "BFER")
 			return new launcher::RSC<launcher::BFER_std<B,R,Q>,B,R,Q>(argc, argv);
+		else if (this->sim_type == "DEC")
+			return new launcher::RSC<launcher::DEC<B,R,Q>,B,R,Q>(argc, argv);
 		else if (this->sim_type == "BFERI")
 			return new launcher::RSC<launcher::BFER_ite<B,R,Q>,B,R,Q>(argc, argv);
 	}
@@ -260,6 +265,8 @@ launcher::Launcher* factory::Launcher::parameters
 	{
 		if (this->sim_type == "BFER")
 			return new launcher::RSC_DB<launcher::BFER_std<B,R,Q>,B,R,Q>(argc, argv);
+		else if (this->sim_type == "DEC")
+			return new launcher::RSC_DB<launcher::DEC<B,R,Q>,B,R,Q>(argc, argv);
 		else if (this->sim_type == "BFERI")
 			return new launcher::RSC_DB<launcher::BFER_ite<B,R,Q>,B,R,Q>(argc, argv);
 	}
@@ -268,36 +275,48 @@ launcher::Launcher* factory::Launcher::parameters
 	{
 		if (this->sim_type == "BFER")
 			return new launcher::Turbo<launcher::BFER_std<B,R,Q>,B,R,Q>(argc, argv);
+		else if (this->sim_type == "DEC")
+			return new launcher::Turbo<launcher::DEC<B,R,Q>,B,R,Q>(argc, argv);
 	}
 
 	if (this->cde_type == "TURBO_DB")
 	{
 		if (this->sim_type == "BFER")
 			return new launcher::Turbo_DB<launcher::BFER_std<B,R,Q>,B,R,Q>(argc, argv);
+		else if (this->sim_type == "DEC")
+			return new launcher::Turbo_DB<launcher::DEC<B,R,Q>,B,R,Q>(argc, argv);
 	}
 
 	if (this->cde_type == "REP")
 	{
 		if (this->sim_type == "BFER")
 			return new launcher::Repetition<launcher::BFER_std<B,R,Q>,B,R,Q>(argc, argv);
+		else if (this->sim_type == "DEC")
+			return new launcher::Repetition<launcher::DEC<B,R,Q>,B,R,Q>(argc, argv);
 	}
 
 	if (this->cde_type == "BCH")
 	{
 		if (this->sim_type == "BFER")
 			return new launcher::BCH<launcher::BFER_std<B,R,Q>,B,R,Q>(argc, argv);
+		else if (this->sim_type == "DEC")
+			return new launcher::BCH<launcher::DEC<B,R,Q>,B,R,Q>(argc, argv);
 	}
 
 	if (this->cde_type == "RA")
 	{
 		if (this->sim_type == "BFER")
 			return new launcher::RA<launcher::BFER_std<B,R,Q>,B,R,Q>(argc, argv);
+		else if (this->sim_type == "DEC")
+			return new launcher::RA<launcher::DEC<B,R,Q>,B,R,Q>(argc, argv);
 	}
 
 	if (this->cde_type == "LDPC")
 	{
 		if (this->sim_type == "BFER")
 			return new launcher::LDPC<launcher::BFER_std<B,R,Q>,B,R,Q>(argc, argv);
+		else if (this->sim_type == "DEC")
+			return new launcher::LDPC<launcher::DEC<B,R,Q>,B,R,Q>(argc, argv);
 		else if (this->sim_type == "BFERI")
 			return new launcher::LDPC<launcher::BFER_ite<B,R,Q>,B,R,Q>(argc, argv);
 	}
@@ -306,6 +325,8 @@ launcher::Launcher* factory::Launcher::parameters
 	{
 		if (this->sim_type == "BFER")
 			return new launcher::Uncoded<launcher::BFER_std<B,R,Q>,B,R,Q>(argc, argv);
+		else if (this->sim_type == "DEC")
+			return new launcher::Uncoded<launcher::DEC<B,R,Q>,B,R,Q>(argc, argv);
 		else if (this->sim_type == "BFERI")
 			return new launcher::Uncoded<launcher::BFER_ite<B,R,Q>,B,R,Q>(argc, argv);
 	}
@@ -1,6 +1,7 @@
 #include <sstream>
 
 #include "Module/Decoder/BCH/Decoder_BCH.hpp"
+#include "Module/Decoder/BCH/Decoder_BCH_fast.hpp"
 
 #include "Tools/Exception/exception.hpp"
 
@@ -39,6 +40,7 @@ void Decoder_BCH::parameters
 	auto p = this->get_prefix();
 
 	opt_args[{p+"-type", "D"}][2] += ", ALGEBRAIC";
+	opt_args[{p+"-implem"   }][2] += ", FAST";
 
 	opt_args[{p+"-corr-pow", "T"}] =
 		{"strictly_positive_int",
@@ -92,7 +94,8 @@ module::Decoder_SIHO<B,Q>* Decoder_BCH::parameters
 	{
 		if (this->type == "ALGEBRAIC")
 		{
-			if (this->implem == "STD") return new module::Decoder_BCH<B,Q>(this->K, this->N_cw, GF, this->n_frames);
+			if (this->implem == "STD" ) return new module::Decoder_BCH     <B,Q>(this->K, this->N_cw, GF, this->n_frames);
+			if (this->implem == "FAST") return new module::Decoder_BCH_fast<B,Q>(this->K, this->N_cw, GF, this->n_frames);
 		}
 	}
 
@@ -61,6 +61,10 @@ void Decoder::parameters
 	opt_args[{p+"-flips"}] =
 		{"strictly_positive_int",
 		 "set the maximum number of flips in the CHASE decoder."};
+
+	opt_args[{p+"-threads"}] =
+		{"strictly_positive_int",
+		 "set the number of threads used to explore the information words in the ML decoder."};
 }
 
 void Decoder::parameters
@@ -72,6 +76,7 @@ void Decoder::parameters
 	if(exist(vals, {p+"-cw-size",   "N"})) this->N_cw       = std::stoi(vals.at({p+"-cw-size",   "N"}));
 	if(exist(vals, {p+"-fra",       "F"})) this->n_frames   = std::stoi(vals.at({p+"-fra",       "F"}));
 	if(exist(vals, {p+"-flips"         })) this->flips      = std::stoi(vals.at({p+"-flips"         }));
+	if(exist(vals, {p+"-threads"       })) this->n_threads  = std::stoi(vals.at({p+"-threads"       }));
 	if(exist(vals, {p+"-type",      "D"})) this->type       =           vals.at({p+"-type",      "D"});
 	if(exist(vals, {p+"-implem"        })) this->implem     =           vals.at({p+"-implem"        });
 	if(exist(vals, {p+"-no-sys"        })) this->systematic = false;
@@ -96,6 +101,8 @@ void Decoder::parameters
 		headers[p].push_back(std::make_pair("Distance", this->hamming ? "Hamming" : "Euclidean"));
 	if(this->type == "CHASE")
 		headers[p].push_back(std::make_pair("Max flips", std::to_string(this->flips)));
+	if(this->type == "ML" && this->implem == "STD")
+		headers[p].push_back(std::make_pair("Threads", std::to_string(this->n_threads)));
 }
 
 template <typename B, typename Q>
@@ -106,7 +113,7 @@ module::Decoder_SIHO<B,Q>* Decoder::parameters
 	{
 		if (this->type == "ML")
 		{
-			if (this->implem == "STD"  ) return new module::Decoder_ML_std  <B,Q>(this->K, this->N_cw, *encoder, this->hamming, this->n_frames);
+			if (this->implem == "STD"  ) return new module::Decoder_ML_std  <B,Q>(this->K, this->N_cw, *encoder, this->hamming, this->n_frames, this->n_threads);
 			if (this->implem == "NAIVE") return new module::Decoder_ML_naive<B,Q>(this->K, this->N_cw, *encoder, this->hamming, this->n_frames);
 		}
 		else if (this->type == "CHASE")
@@ -6,11 +6,13 @@
 #include "Module/Decoder/LDPC/BP/Flooding/ONMS/Decoder_LDPC_BP_flooding_offset_normalize_min_sum.hpp"
 #include "Module/Decoder/LDPC/BP/Flooding/AMS/Decoder_LDPC_BP_flooding_approximate_min_star.hpp"
 #include "Module/Decoder/LDPC/BP/Flooding/Gallager/Decoder_LDPC_BP_flooding_Gallager_A.hpp"
+#include "Module/Decoder/LDPC/BP/Flooding/Gallager/Decoder_LDPC_BP_flooding_Gallager_inter.hpp"
 #include "Module/Decoder/LDPC/BP/Layered/SPA/Decoder_LDPC_BP_layered_sum_product.hpp"
 #include "Module/Decoder/LDPC/BP/Layered/LSPA/Decoder_LDPC_BP_layered_log_sum_product.hpp"
 #include "Module/Decoder/LDPC/BP/Layered/ONMS/Decoder_LDPC_BP_layered_offset_normalize_min_sum.hpp"
 #include "Module/Decoder/LDPC/BP/Layered/ONMS/Decoder_LDPC_BP_layered_ONMS_inter.hpp"
 #include "Module/Decoder/LDPC/BP/Layered/AMS/Decoder_LDPC_BP_layered_approximate_min_star.hpp"
+#include "Module/Decoder/LDPC/BF/Decoder_LDPC_bit_flipping_inter.hpp"
 
 #include "Decoder_LDPC.hpp"
 
@@ -61,8 +63,8 @@ void Decoder_LDPC::parameters
 		 "the MIN implementation for the nodes (AMS decoder).",
 		 "MIN, MINL, MINS"};
 
-	opt_args[{p+"-type", "D"}][2] += ", BP, BP_FLOODING, BP_LAYERED";
-	opt_args[{p+"-implem"   }][2] += ", ONMS, SPA, LSPA, GALA, AMS";
+	opt_args[{p+"-type", "D"}][2] += ", BP, BP_FLOODING, BP_LAYERED, BIT_FLIPPING";
+	opt_args[{p+"-implem"   }][2] += ", ONMS, SPA, LSPA, GALA, GALB, AMS, WGDBF";
 
 	opt_args[{p+"-ite", "i"}] =
 		{"positive_int",
@@ -76,6 +78,11 @@ void Decoder_LDPC::parameters
 		{"positive_float",
 		 "normalization factor used in the normalized min-sum BP algorithm (works only with \"--dec-implem ONMS\")."};
 
+	opt_args[{p+"-rel-bits"}] =
+		{"positive_int",
+		 "number of bits of the channel reliabilities in the weighted bit-flipping decoder (works only with "
+		 "\"--dec-implem WGDBF\", 0 is the plain majority bit-flipping)."};
+
 	opt_args[{p+"-no-synd"}] =
 		{"",
 		 "disable the syndrome detection (disable the stop criterion in the LDPC decoders)."};
@@ -104,6 +111,7 @@ void Decoder_LDPC::parameters
 	if(exist(vals, {p+"-off"       })) this->offset          = std::stof(vals.at({p+"-off"       }));
 	if(exist(vals, {p+"-norm"      })) this->norm_factor     = std::stof(vals.at({p+"-norm"      }));
 	if(exist(vals, {p+"-synd-depth"})) this->syndrome_depth  = std::stoi(vals.at({p+"-synd-depth"}));
+	if(exist(vals, {p+"-rel-bits"  })) this->n_rel_bits      = std::stoi(vals.at({p+"-rel-bits"  }));
 	if(exist(vals, {p+"-simd"      })) this->simd_strategy   =           vals.at({p+"-simd"      });
 	if(exist(vals, {p+"-no-synd"   })) this->enable_syndrome = false;
 }
@@ -134,6 +142,9 @@ void Decoder_LDPC::parameters
 			headers[p].push_back(std::make_pair("Normalize factor", std::to_string(this->norm_factor)));
 		}
 
+		if (this->implem == "WGDBF")
+			headers[p].push_back(std::make_pair("Reliability bits", std::to_string(this->n_rel_bits)));
+
 		std::string syndrome = this->enable_syndrome ? "on" : "off";
 		headers[p].push_back(std::make_pair("Stop criterion (syndrome)", syndrome));
 
@@ -150,9 +161,11 @@ module::Decoder_SISO_SIHO<B,Q>* Decoder_LDPC::parameters
 ::build_siso(const tools::Sparse_matrix &H, const std::vector<unsigned> &info_bits_pos,
              module::Encoder<B> *encoder) const
 {
+	const auto offset = (Q)(this->offset * (float)(1 << this->n_decimals));
+
 	if ((this->type == "BP" || this->type == "BP_FLOODING") && this->simd_strategy.empty())
 	{
-		     if (this->implem == "ONMS") return new module::Decoder_LDPC_BP_flooding_ONMS     <B,Q>(this->K, this->N_cw, this->n_ite, H, info_bits_pos, this->norm_factor, (Q)this->offset, this->enable_syndrome, this->syndrome_depth, this->n_frames);
+		     if (this->implem == "ONMS") return new module::Decoder_LDPC_BP_flooding_ONMS     <B,Q>(this->K, this->N_cw, this->n_ite, H, info_bits_pos, this->norm_factor, offset,          this->enable_syndrome, this->syndrome_depth, this->n_frames);
 		else if (this->implem == "SPA" ) return new module::Decoder_LDPC_BP_flooding_SPA      <B,Q>(this->K, this->N_cw, this->n_ite, H, info_bits_pos,                                     this->enable_syndrome, this->syndrome_depth, this->n_frames);
 		else if (this->implem == "LSPA") return new module::Decoder_LDPC_BP_flooding_LSPA     <B,Q>(this->K, this->N_cw, this->n_ite, H, info_bits_pos,                                     this->enable_syndrome, this->syndrome_depth, this->n_frames);
 		else if (this->implem == "AMS" ) {
@@ -166,7 +179,7 @@ module::Decoder_SISO_SIHO<B,Q>* Decoder_LDPC::parameters
 	}
 	else if (this->type == "BP_LAYERED" && this->simd_strategy.empty())
 	{
-		     if (this->implem == "ONMS") return new module::Decoder_LDPC_BP_layered_ONMS      <B,Q>(this->K, this->N_cw, this->n_ite, H, info_bits_pos, this->norm_factor, (Q)this->offset, this->enable_syndrome, this->syndrome_depth, this->n_frames);
+		     if (this->implem == "ONMS") return new module::Decoder_LDPC_BP_layered_ONMS      <B,Q>(this->K, this->N_cw, this->n_ite, H, info_bits_pos, this->norm_factor, offset,          this->enable_syndrome, this->syndrome_depth, this->n_frames);
 		else if (this->implem == "SPA" ) return new module::Decoder_LDPC_BP_layered_SPA       <B,Q>(this->K, this->N_cw, this->n_ite, H, info_bits_pos,                                     this->enable_syndrome, this->syndrome_depth, this->n_frames);
 		else if (this->implem == "LSPA") return new module::Decoder_LDPC_BP_layered_LSPA      <B,Q>(this->K, this->N_cw, this->n_ite, H, info_bits_pos,                                     this->enable_syndrome, this->syndrome_depth, this->n_frames);
 		else if (this->implem == "AMS" ) {
@@ -180,7 +193,7 @@ module::Decoder_SISO_SIHO<B,Q>* Decoder_LDPC::parameters
 	}
 	else if (this->type == "BP_LAYERED" && this->simd_strategy == "INTER")
 	{
-		     if (this->implem == "ONMS") return new module::Decoder_LDPC_BP_layered_ONMS_inter<B,Q>(this->K, this->N_cw, this->n_ite, H, info_bits_pos, this->norm_factor, (Q)this->offset, this->enable_syndrome, this->syndrome_depth, this->n_frames);
+		     if (this->implem == "ONMS") return new module::Decoder_LDPC_BP_layered_ONMS_inter<B,Q>(this->K, this->N_cw, this->n_ite, H, info_bits_pos, this->norm_factor, offset,          this->enable_syndrome, this->syndrome_depth, this->n_frames);
 	}
 
 	throw tools::cannot_allocate(__FILE__, __LINE__, __func__);
@@ -201,6 +214,15 @@ module::Decoder_SIHO<B,Q>* Decoder_LDPC::parameters
 		{
 			if (this->implem == "GALA") return new module::Decoder_LDPC_BP_flooding_GALA<B,Q>(this->K, this->N_cw, this->n_ite, H, info_bits_pos, this->enable_syndrome, this->syndrome_depth, this->n_frames);
 		}
+		else if ((this->type == "BP" || this->type == "BP_FLOODING") && this->simd_strategy == "INTER")
+		{
+			     if (this->implem == "GALA") return new module::Decoder_LDPC_BP_flooding_Gallager_inter<B,Q>(this->K, this->N_cw, this->n_ite, H, info_bits_pos, false, this->enable_syndrome, this->syndrome_depth, this->n_frames);
+			else if (this->implem == "GALB") return new module::Decoder_LDPC_BP_flooding_Gallager_inter<B,Q>(this->K, this->N_cw, this->n_ite, H, info_bits_pos, true,  this->enable_syndrome, this->syndrome_depth, this->n_frames);
+		}
+		else if (this->type == "BIT_FLIPPING" && this->simd_strategy == "INTER")
+		{
+			if (this->implem == "WGDBF") return new module::Decoder_LDPC_bit_flipping_inter<B,Q>(this->K, this->N_cw, this->n_ite, H, info_bits_pos, this->n_rel_bits, this->enable_syndrome, this->syndrome_depth, this->n_frames);
+		}
 
 		return build_siso<B,Q>(H, info_bits_pos);
 	}
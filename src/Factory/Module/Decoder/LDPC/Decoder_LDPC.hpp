@@ -35,6 +35,10 @@ struct Decoder_LDPC : public Decoder
 		bool        enable_syndrome = true;
 		int         syndrome_depth  = 2;
 		int         n_ite           = 10;
+		int         n_rel_bits      = 2;
+
+		// deduced parameters
+		int         n_decimals      = 0; // the fixed-point LLRs (and the offset) are scaled by 2^n_decimals
 
 		// ---------------------------------------------------------------------------------------------------- METHODS
 		explicit parameters(const std::string &p = Decoder_LDPC_prefix);
@@ -5,14 +5,18 @@
 #include "Module/Decoder/Polar/SC/Decoder_polar_SC_fast_sys.hpp"
 #include "Module/Decoder/Polar/SCAN/Decoder_polar_SCAN_naive.hpp"
 #include "Module/Decoder/Polar/SCAN/Decoder_polar_SCAN_naive_sys.hpp"
+#include "Module/Decoder/Polar/SCAN/Decoder_polar_SCAN_fast.hpp"
+#include "Module/Decoder/Polar/SCAN/Decoder_polar_SCAN_fast_sys.hpp"
 #include "Module/Decoder/Polar/SCL/Decoder_polar_SCL_naive.hpp"
 #include "Module/Decoder/Polar/SCL/Decoder_polar_SCL_naive_sys.hpp"
 #include "Module/Decoder/Polar/SCL/Decoder_polar_SCL_fast_sys.hpp"
 #include "Module/Decoder/Polar/SCL/Decoder_polar_SCL_MEM_fast_sys.hpp"
+#include "Module/Decoder/Polar/SCL/Decoder_polar_SCL_inter_fast_sys.hpp"
 #include "Module/Decoder/Polar/SCL/CRC/Decoder_polar_SCL_naive_CA.hpp"
 #include "Module/Decoder/Polar/SCL/CRC/Decoder_polar_SCL_naive_CA_sys.hpp"
 #include "Module/Decoder/Polar/SCL/CRC/Decoder_polar_SCL_fast_CA_sys.hpp"
 #include "Module/Decoder/Polar/SCL/CRC/Decoder_polar_SCL_MEM_fast_CA_sys.hpp"
+#include "Module/Decoder/Polar/SCL/CRC/Decoder_polar_SCL_inter_fast_CA_sys.hpp"
 #include "Module/Decoder/Polar/ASCL/Decoder_polar_ASCL_fast_CA_sys.hpp"
 #include "Module/Decoder/Polar/ASCL/Decoder_polar_ASCL_MEM_fast_CA_sys.hpp"
 
@@ -94,7 +98,8 @@ void Decoder_polar::parameters
 
 	opt_args[{p+"-polar-nodes"}] =
 		{"string",
-		 "the type of nodes you want to detect in the Polar tree (ex: \"{R0,R1,R0L,REP_2-8,REPL,SPC_4+}\")."};
+		 "the type of nodes you want to detect in the Polar tree (ex: \"{R0,R1,R0L,REP_2-8,REPL,SPC_4+}\"), the "
+		 "generalized nodes GREPR1, GREPSPC (SC and SCL), GPC and GPCREP (SC only) can also be detected."};
 
 	opt_args[{p+"-partial-adaptive"}] =
 		{"",
@@ -169,9 +174,34 @@ module::Decoder_SISO_SIHO<B,Q>* Decoder_polar::parameters
 		if (this->implem == "NAIVE") return new module::Decoder_polar_SCAN_naive    <B, Q, tools::f_LLR<Q>, tools::v_LLR<Q>, tools::h_LLR<B,Q>>(this->K, this->N_cw, this->n_ite, frozen_bits, this->n_frames);
 	}
 
+	if (this->type == "SCAN" && this->implem == "FAST")
+	{
+		if (this->simd_strategy == "INTER")
+		{
+#ifdef API_POLAR_DYNAMIC
+			using API_polar = tools::API_polar_dynamic_inter<B,Q>;
+#else
+			using API_polar = tools::API_polar_static_inter<B,Q>;
+#endif
+			return _build_scan_fast<B,Q,API_polar>(frozen_bits);
+		}
+		else if (this->simd_strategy == "INTRA")
+			return _build_scan_fast<B,Q,tools::API_polar_dynamic_intra<B,Q>>(frozen_bits);
+		else if (this->simd_strategy.empty())
+			return _build_scan_fast<B,Q,tools::API_polar_dynamic_seq<B,Q>>(frozen_bits);
+	}
+
 	throw tools::cannot_allocate(__FILE__, __LINE__, __func__);
 }
 
+template <typename B, typename Q, class API_polar>
+module::Decoder_SISO_SIHO<B,Q>* Decoder_polar::parameters
+::_build_scan_fast(const std::vector<bool> &frozen_bits) const
+{
+	if (this->systematic) return new module::Decoder_polar_SCAN_fast_sys<B,Q,API_polar>(this->K, this->N_cw, this->n_ite, frozen_bits, this->n_frames);
+	else                  return new module::Decoder_polar_SCAN_fast    <B,Q,API_polar>(this->K, this->N_cw, this->n_ite, frozen_bits, this->n_frames);
+}
+
 template <typename B, typename Q, class API_polar>
 module::Decoder_SIHO<B,Q>* Decoder_polar::parameters
 ::_build(const std::vector<bool> &frozen_bits, module::CRC<B> *crc, module::Encoder<B> *encoder) const
@@ -244,6 +274,21 @@ module::Decoder_SIHO<B,Q>* Decoder_polar::parameters
 	throw tools::cannot_allocate(__FILE__, __LINE__, __func__);
 }
 
+template <typename B, typename Q, class API_polar>
+module::Decoder_SIHO<B,Q>* Decoder_polar::parameters
+::_build_scl_inter(const std::vector<bool> &frozen_bits, module::CRC<B> *crc, module::Encoder<B> *encoder) const
+{
+	if (this->implem == "FAST" && this->systematic && this->type == "SCL")
+	{
+		if (crc != nullptr && crc->get_size() > 0)
+			return new module::Decoder_polar_SCL_inter_fast_CA_sys<B, Q, API_polar>(this->K, this->N_cw, this->L, frozen_bits, *crc, this->n_frames);
+		else
+			return new module::Decoder_polar_SCL_inter_fast_sys   <B, Q, API_polar>(this->K, this->N_cw, this->L, frozen_bits,       this->n_frames);
+	}
+
+	throw tools::cannot_allocate(__FILE__, __LINE__, __func__);
+}
+
 template <typename B, typename Q>
 module::Decoder_SIHO<B,Q>* Decoder_polar::parameters
 ::build(const std::vector<bool> &frozen_bits, module::CRC<B> *crc, module::Encoder<B> *encoder) const
@@ -275,6 +320,15 @@ module::Decoder_SIHO<B,Q>* Decoder_polar::parameters
 			{
 				return _build_scl_fast<B,Q,tools::API_polar_dynamic_seq<B,Q>>(frozen_bits, crc, encoder);
 			}
+			else if (this->simd_strategy == "INTER" && this->type == "SCL")
+			{
+#ifdef API_POLAR_DYNAMIC
+				using API_polar = tools::API_polar_dynamic_inter<B,Q>;
+#else
+				using API_polar = tools::API_polar_static_inter<B,Q>;
+#endif
+				return _build_scl_inter<B,Q,API_polar>(frozen_bits, crc, encoder);
+			}
 		}
 
 		if (this->simd_strategy == "INTER" && this->type == "SC" && this->implem == "FAST")
@@ -59,11 +59,19 @@ struct Decoder_polar : public Decoder
 		module::Decoder_SIHO<B,Q>* _build(const std::vector<bool> &frozen_bits, module::CRC<B> *crc = nullptr,
 		                                  module::Encoder<B> *encoder = nullptr) const;
 
+		template <typename B = int, typename Q = float, class API_polar>
+		module::Decoder_SISO_SIHO<B,Q>* _build_scan_fast(const std::vector<bool> &frozen_bits) const;
+
 		template <typename B = int, typename Q = float, class API_polar>
 		module::Decoder_SIHO<B,Q>* _build_scl_fast(const std::vector<bool> &frozen_bits,
 		                                           module::CRC<B> *crc = nullptr,
 		                                           module::Encoder<B> *encoder = nullptr) const;
 
+		template <typename B = int, typename Q = float, class API_polar>
+		module::Decoder_SIHO<B,Q>* _build_scl_inter(const std::vector<bool> &frozen_bits,
+		                                            module::CRC<B> *crc = nullptr,
+		                                            module::Encoder<B> *encoder = nullptr) const;
+
 		template <typename B = int, typename Q = float, class API_polar>
 		module::Decoder_SIHO<B,Q>* _build_gen(module::CRC<B> *crc = nullptr,
 		                                      module::Encoder<B> *encoder = nullptr) const;
@@ -1,6 +1,7 @@
 #include "Tools/Exception/exception.hpp"
 
 #include "Module/Decoder/RA/Decoder_RA.hpp"
+#include "Module/Decoder/RA/Decoder_RA_inter.hpp"
 
 #include "Decoder_RA.hpp"
 
@@ -77,6 +78,11 @@ void Decoder_RA::parameters
 	opt_args[{p+"-ite", "i"}] =
 		{"strictly_positive_int",
 		 "maximal number of iterations in the decoder."};
+
+	opt_args[{p+"-simd"}] =
+		{"string",
+		 "the SIMD strategy you want to use.",
+		 "INTER"};
 }
 
 void Decoder_RA::parameters
@@ -91,7 +97,8 @@ void Decoder_RA::parameters
 
 	itl->store(vals);
 
-	if(exist(vals, {p+"-ite", "i"})) this->n_ite = std::stoi(vals.at({p+"-ite", "i"}));
+	if(exist(vals, {p+"-ite", "i"})) this->n_ite         = std::stoi(vals.at({p+"-ite", "i"}));
+	if(exist(vals, {p+"-simd"    })) this->simd_strategy =           vals.at({p+"-simd"    });
 }
 
 void Decoder_RA::parameters
@@ -104,7 +111,10 @@ void Decoder_RA::parameters
 	if (this->type != "ML" && this->type != "CHASE")
 	{
 		auto p = this->get_prefix();
-		
+
+		if (!this->simd_strategy.empty())
+			headers[p].push_back(std::make_pair("SIMD strategy", this->simd_strategy));
+
 		headers[p].push_back(std::make_pair("Num. of iterations (i)", std::to_string(this->n_ite)));
 	}
 }
@@ -119,9 +129,13 @@ module::Decoder_SIHO<B,Q>* Decoder_RA::parameters
 	}
 	catch (tools::cannot_allocate const&)
 	{
-		if (this->type == "RA")
+		if (this->type == "RA" && this->simd_strategy.empty())
+		{
+			if (this->implem == "STD" ) return new module::Decoder_RA      <B,Q>(this->K, this->N_cw, itl, this->n_ite, this->n_frames);
+		}
+		else if (this->type == "RA" && this->simd_strategy == "INTER")
 		{
-			if (this->implem == "STD" ) return new module::Decoder_RA<B,Q>(this->K, this->N_cw, itl, this->n_ite, this->n_frames);
+			if (this->implem == "STD" ) return new module::Decoder_RA_inter<B,Q>(this->K, this->N_cw, itl, this->n_ite, this->n_frames);
 		}
 	}
 
@@ -23,7 +23,8 @@ struct Decoder_RA : public Decoder
 	public:
 		// ------------------------------------------------------------------------------------------------- PARAMETERS
 		// optional parameters
-		int n_ite = 10;
+		int         n_ite         = 10;
+		std::string simd_strategy = "";
 
 		// depending parameters
 		Interleaver::parameters *itl;
@@ -21,6 +21,10 @@
 #include "Module/Decoder/RSC/BCJR/Inter/Decoder_RSC_BCJR_inter_fast.hpp"
 #include "Module/Decoder/RSC/BCJR/Inter/Decoder_RSC_BCJR_inter_very_fast.hpp"
 
+#include "Module/Decoder/RSC/BCJR/Inter_generic/Decoder_RSC_BCJR_inter_generic_std.hpp"
+#include "Module/Decoder/RSC/BCJR/Intra_generic/Decoder_RSC_BCJR_intra_generic_std.hpp"
+#include "Module/Decoder/RSC/BCJR/Sub_block/Decoder_RSC_BCJR_sub_block.hpp"
+
 #include "Decoder_RSC.hpp"
 
 using namespace aff3ct;
@@ -58,7 +62,7 @@ void Decoder_RSC::parameters
 	req_args.erase({p+"-cw-size", "N"});
 
 	opt_args[{p+"-type", "D"}][2] += ", BCJR";
-	opt_args[{p+"-implem"   }][2] += ", GENERIC, FAST, VERY_FAST";
+	opt_args[{p+"-implem"   }][2] += ", GENERIC, FAST, VERY_FAST, SUB_BLOCK";
 
 	opt_args[{p+"-simd"}] =
 		{"string",
@@ -120,7 +124,8 @@ void Decoder_RSC::parameters
 	if (this->poly[0] == 023 && this->poly[1] == 033)
 		this->standard = "CCSDS";
 
-	if (this->poly[0] != 013 || this->poly[1] != 015)
+	// the sub-block decoder supports any trellis
+	if ((this->poly[0] != 013 || this->poly[1] != 015) && this->implem != "SUB_BLOCK")
 		this->implem = "GENERIC";
 
 	this->tail_length = (int)(2 * std::floor(std::log2((float)std::max(this->poly[0], this->poly[1]))));
@@ -185,11 +190,16 @@ module::Decoder_SISO_SIHO<B,Q>* Decoder_RSC::parameters
 		     if (this->implem == "STD"      ) return new module::Decoder_RSC_BCJR_inter_std      <B,Q,MAX>(this->K, trellis, this->buffered, this->n_frames);
 		else if (this->implem == "FAST"     ) return new module::Decoder_RSC_BCJR_inter_fast     <B,Q,MAX>(this->K, trellis, this->buffered, this->n_frames);
 		else if (this->implem == "VERY_FAST") return new module::Decoder_RSC_BCJR_inter_very_fast<B,Q,MAX>(this->K, trellis, this->buffered, this->n_frames);
+		else if (this->implem == "GENERIC"  ) return new module::Decoder_RSC_BCJR_inter_generic_std<B,Q,MAX>(this->K, trellis, this->buffered, this->n_frames);
 	}
 
 	if (this->type == "BCJR" && this->simd_strategy == "INTRA")
 	{
-		if (this->implem == "STD")
+		if (this->implem == "GENERIC")
+			return new module::Decoder_RSC_BCJR_intra_generic_std<B,Q,MAX>(this->K, trellis, this->buffered, this->n_frames);
+		else if (this->implem == "SUB_BLOCK")
+			return new module::Decoder_RSC_BCJR_sub_block<B,Q,MAX>(this->K, trellis, this->buffered, this->n_frames);
+		else if (this->implem == "STD")
 		{
 			switch (mipp::nElReg<Q>())
 			{
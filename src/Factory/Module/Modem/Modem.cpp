@@ -240,7 +240,7 @@ void Modem::parameters
 	}
 }
 
-template <typename B, typename R, typename Q, tools::proto_max<Q> MAX>
+template <typename B, typename R, typename Q, tools::proto_max<Q> MAX, tools::proto_max_i<Q> MAX_i>
 module::Modem<B,R,Q>* Modem::parameters
 ::_build() const
 {
@@ -251,7 +251,7 @@ module::Modem<B,R,Q>* Modem::parameters
 	else if (this->type == "QAM"      ) return new module::Modem_QAM      <B,R,Q,MAX>(this->N,                   this->sigma, this->bps,                                                                                    this->no_sig2, this->n_frames);
 	else if (this->type == "PSK"      ) return new module::Modem_PSK      <B,R,Q,MAX>(this->N,                   this->sigma, this->bps,                                                                                    this->no_sig2, this->n_frames);
 	else if (this->type == "USER"     ) return new module::Modem_user     <B,R,Q,MAX>(this->N, this->const_path, this->sigma, this->bps,                                                                                    this->no_sig2, this->n_frames);
-	else if (this->type == "CPM"      ) return new module::Modem_CPM      <B,R,Q,MAX>(this->N,                   this->sigma, this->bps, this->upf, this->cpm_L, this->cpm_k, this->cpm_p, this->mapping, this->wave_shape, this->no_sig2, this->n_frames);
+	else if (this->type == "CPM"      ) return new module::Modem_CPM      <B,R,Q,MAX,MAX_i>(this->N,                   this->sigma, this->bps, this->upf, this->cpm_L, this->cpm_k, this->cpm_p, this->mapping, this->wave_shape, this->no_sig2, this->n_frames);
 
 	throw tools::cannot_allocate(__FILE__, __LINE__, __func__);
 }
@@ -278,10 +278,11 @@ module::Modem<B,R,Q>* Modem::parameters
 	}
 	else
 	{
-		     if (this->max == "MAX"  ) return _build<B,R,Q,tools::max          <Q>>();
-		else if (this->max == "MAXL" ) return _build<B,R,Q,tools::max_linear   <Q>>();
-		else if (this->max == "MAXS" ) return _build<B,R,Q,tools::max_star     <Q>>();
-		else if (this->max == "MAXSS") return _build<B,R,Q,tools::max_star_safe<Q>>();
+		// there is no SIMD version of the 'max_star_safe' function: 'max_star_i' is used instead (inter-frame CPM)
+		     if (this->max == "MAX"  ) return _build<B,R,Q,tools::max          <Q>,tools::max_i       <Q>>();
+		else if (this->max == "MAXL" ) return _build<B,R,Q,tools::max_linear   <Q>,tools::max_linear_i<Q>>();
+		else if (this->max == "MAXS" ) return _build<B,R,Q,tools::max_star     <Q>,tools::max_star_i  <Q>>();
+		else if (this->max == "MAXSS") return _build<B,R,Q,tools::max_star_safe<Q>,tools::max_star_i  <Q>>();
 	}
 
 	throw tools::cannot_allocate(__FILE__, __LINE__, __func__);
@@ -66,7 +66,8 @@ struct Modem : public Factory
 		module::Modem<B,R,Q>* build() const;
 
 	private:
-		template <typename B = int, typename R = float, typename Q = R, tools::proto_max<Q> MAX>
+		template <typename B = int, typename R = float, typename Q = R, tools::proto_max<Q> MAX,
+		          tools::proto_max_i<Q> MAX_i>
 		inline module::Modem<B,R,Q>* _build() const;
 
 		template <typename B = int, typename R = float, typename Q = R>
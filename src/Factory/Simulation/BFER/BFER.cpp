@@ -150,6 +150,12 @@ void BFER::parameters
 		this->err_track_enable = false;
 		this->n_threads = 1;
 	}
+
+#ifndef ENABLE_MPI
+	// the bad frames files can't be shared by several processes
+	if (this->err_track_enable || this->err_track_revert)
+		this->n_procs = 1;
+#endif
 }
 
 void BFER::parameters
@@ -43,18 +43,44 @@ void BFER_std::parameters
 ::get_description(arg_map &req_args, arg_map &opt_args) const
 {
 	BFER::parameters::get_description(req_args, opt_args);
+
+	auto p = this->get_prefix();
+
+	opt_args[{p+"-snr-par"}] =
+		{"strictly_positive_int",
+		 "number of SNR points simulated concurrently, the threads move to the point that needs the most frames."};
 }
 
 void BFER_std::parameters
 ::store(const arg_val_map &vals)
 {
 	BFER::parameters::store(vals);
+
+	auto p = this->get_prefix();
+
+	if(exist(vals, {p+"-snr-par"})) this->snr_par = std::stoi(vals.at({p+"-snr-par"}));
+
+#if defined(SYSTEMC) || defined(ENABLE_MPI)
+	this->snr_par = 1;
+#else
+	if (this->n_procs > 1)
+		this->snr_par = 1;
+#endif
+
+	// the concurrent SNR points can't share the per SNR outputs (debug, statistics and bad frames tracking)
+	if (this->debug || this->statistics || this->err_track_enable || this->err_track_revert)
+		this->snr_par = 1;
 }
 
 void BFER_std::parameters
 ::get_headers(std::map<std::string,header_list>& headers, const bool full) const
 {
 	BFER::parameters::get_headers(headers, full);
+
+	auto p = this->get_prefix();
+
+	if (this->snr_par > 1)
+		headers[p].push_back(std::make_pair("Concurrent SNR points", std::to_string(this->snr_par)));
 }
 
 template <typename B, typename R, typename Q>
@@ -28,6 +28,9 @@ struct BFER_std : BFER
 	{
 	public:
 		// ------------------------------------------------------------------------------------------------- PARAMETERS
+		// optional parameters
+		int snr_par = 1;
+
 		// module parameters
 		Codec_SIHO::parameters *cdc = nullptr;
 
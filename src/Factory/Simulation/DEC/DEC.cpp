@@ -0,0 +1,187 @@
+#include <thread>
+#include <algorithm>
+
+#include "Simulation/DEC/DEC.hpp"
+
+#include "DEC.hpp"
+
+using namespace aff3ct;
+using namespace aff3ct::factory;
+
+const std::string aff3ct::factory::DEC_name   = "Simulation DEC";
+const std::string aff3ct::factory::DEC_prefix = "sim";
+
+DEC::parameters
+::parameters(const std::string &prefix)
+: Simulation::parameters(DEC_name, prefix)
+{
+}
+
+DEC::parameters
+::~parameters()
+{
+	if (src != nullptr) { delete src; src = nullptr; }
+	if (crc != nullptr) { delete crc; crc = nullptr; }
+	if (cdc != nullptr) { delete cdc; cdc = nullptr; }
+	if (qnt != nullptr) { delete qnt; qnt = nullptr; }
+}
+
+DEC::parameters* DEC::parameters
+::clone() const
+{
+	auto clone = new DEC::parameters(*this);
+
+	if (src != nullptr) { clone->src = src->clone(); }
+	if (crc != nullptr) { clone->crc = crc->clone(); }
+	if (cdc != nullptr) { clone->cdc = dynamic_cast<Codec_SIHO::parameters*>(cdc->clone()); }
+	if (qnt != nullptr) { clone->qnt = qnt->clone(); }
+
+	return clone;
+}
+
+std::vector<std::string> DEC::parameters
+::get_names() const
+{
+	auto n = Simulation::parameters::get_names();
+	if (src != nullptr) { auto nn = src->get_names(); for (auto &x : nn) n.push_back(x); }
+	if (crc != nullptr) { auto nn = crc->get_names(); for (auto &x : nn) n.push_back(x); }
+	if (cdc != nullptr) { auto nn = cdc->get_names(); for (auto &x : nn) n.push_back(x); }
+	if (qnt != nullptr) { auto nn = qnt->get_names(); for (auto &x : nn) n.push_back(x); }
+	return n;
+}
+
+std::vector<std::string> DEC::parameters
+::get_short_names() const
+{
+	auto sn = Factory::parameters::get_short_names();
+	if (src != nullptr) { auto nn = src->get_short_names(); for (auto &x : nn) sn.push_back(x); }
+	if (crc != nullptr) { auto nn = crc->get_short_names(); for (auto &x : nn) sn.push_back(x); }
+	if (cdc != nullptr) { auto nn = cdc->get_short_names(); for (auto &x : nn) sn.push_back(x); }
+	if (qnt != nullptr) { auto nn = qnt->get_short_names(); for (auto &x : nn) sn.push_back(x); }
+	return sn;
+}
+
+std::vector<std::string> DEC::parameters
+::get_prefixes() const
+{
+	auto p = Factory::parameters::get_prefixes();
+	if (src != nullptr) { auto nn = src->get_prefixes(); for (auto &x : nn) p.push_back(x); }
+	if (crc != nullptr) { auto nn = crc->get_prefixes(); for (auto &x : nn) p.push_back(x); }
+	if (cdc != nullptr) { auto nn = cdc->get_prefixes(); for (auto &x : nn) p.push_back(x); }
+	if (qnt != nullptr) { auto nn = qnt->get_prefixes(); for (auto &x : nn) p.push_back(x); }
+	return p;
+}
+
+void DEC::parameters
+::get_description(arg_map &req_args, arg_map &opt_args) const
+{
+	Simulation::parameters::get_description(req_args, opt_args);
+
+	auto p = this->get_prefix();
+
+	// there is no channel to simulate: the LLRs come from a file
+	req_args.erase({p+"-snr-min", "m"});
+	req_args.erase({p+"-snr-max", "M"});
+	opt_args.erase({p+"-snr-step", "s"});
+	opt_args.erase({p+"-pyber"        });
+	opt_args.erase({p+"-stop-time"    });
+#if !defined(ENABLE_MPI) && (defined(__linux__) || defined(__linux) || defined(__APPLE__))
+	opt_args.erase({p+"-procs"        });
+#endif
+
+	req_args[{p+"-llr-path"}] =
+		{"string",
+		 "path to the binary file of the LLRs to decode (header: the number of frames and the frame size N as two "
+		 "32-bit integers, followed by the LLRs stored as 32-bit or 64-bit floats)."};
+
+	opt_args[{p+"-out-path"}] =
+		{"string",
+		 "path to the binary file of the decoded bits (header: the number of frames and the number of information bits"
+		 " as two 32-bit integers, followed by one byte per bit), nothing is written if empty."};
+
+	opt_args[{p+"-chunk"}] =
+		{"strictly_positive_int",
+		 "number of frames read from the file and decoded by each thread at once."};
+
+	opt_args[{p+"-sigma"}] =
+		{"strictly_positive_float",
+		 "noise standard deviation given to the codecs which depend on it (ex: the polar frozen bits generation)."};
+}
+
+void DEC::parameters
+::store(const arg_val_map &vals)
+{
+#if !defined(SYSTEMC)
+	this->n_threads = std::thread::hardware_concurrency() ? std::thread::hardware_concurrency() : 1;
+#endif
+
+	Simulation::parameters::store(vals);
+
+	auto p = this->get_prefix();
+
+	if(exist(vals, {p+"-llr-path"})) this->llr_path = vals.at({p+"-llr-path"});
+	if(exist(vals, {p+"-out-path"})) this->out_path = vals.at({p+"-out-path"});
+	if(exist(vals, {p+"-chunk"   })) this->chunk    = std::stoi(vals.at({p+"-chunk"}));
+	if(exist(vals, {p+"-sigma"   })) this->sigma    = std::stof(vals.at({p+"-sigma"}));
+
+#ifndef ENABLE_MPI
+	// the frames of the file are shared between the threads of a single process
+	this->n_procs = 1;
+#endif
+}
+
+void DEC::parameters
+::get_headers(std::map<std::string,header_list>& headers, const bool full) const
+{
+	Simulation::parameters::get_headers(headers, full);
+
+	auto p = this->get_prefix();
+
+	auto &h = headers[p];
+	h.erase(std::remove_if(h.begin(), h.end(), [](const std::pair<std::string,std::string> &x)
+	                       { return x.first.find("SNR") == 0; }), h.end());
+
+	headers[p].push_back(std::make_pair("LLR path", this->llr_path));
+	headers[p].push_back(std::make_pair("Output path", this->out_path.empty() ? "none" : this->out_path));
+	headers[p].push_back(std::make_pair("Chunk (frames per thread)", std::to_string(this->chunk)));
+	if (this->sigma > 0.f)
+		headers[p].push_back(std::make_pair("Sigma", std::to_string(this->sigma)));
+
+	if (this->src != nullptr)
+		headers[p].push_back(std::make_pair("Inter frame level", std::to_string(this->src->n_frames)));
+
+	if (this->src != nullptr) { this->src->get_headers(headers, full); }
+	if (this->crc != nullptr) { this->crc->get_headers(headers, full); }
+	if (this->cdc != nullptr) { this->cdc->get_headers(headers, full); }
+	if (this->qnt != nullptr) { this->qnt->get_headers(headers, full); }
+}
+
+template <typename B, typename R, typename Q>
+simulation::DEC<B,R,Q>* DEC::parameters
+::build() const
+{
+#if defined(SYSTEMC)
+	throw tools::invalid_argument(__FILE__, __LINE__, __func__, "SystemC/TLM  simulation is not available.");
+#else
+	return new simulation::DEC<B,R,Q>(*this);
+#endif
+}
+
+template <typename B, typename R, typename Q>
+simulation::DEC<B,R,Q>* DEC
+::build(const parameters &params)
+{
+	return params.template build<B,R,Q>();
+}
+
+// ==================================================================================== explicit template instantiation
+#include "Tools/types.h"
+#ifdef MULTI_PREC
+template aff3ct::simulation::DEC<B_8 ,R_8 ,Q_8 >* aff3ct::factory::DEC::build<B_8 ,R_8 ,Q_8 >(const aff3ct::factory::DEC::parameters&);
+template aff3ct::simulation::DEC<B_16,R_16,Q_16>* aff3ct::factory::DEC::build<B_16,R_16,Q_16>(const aff3ct::factory::DEC::parameters&);
+template aff3ct::simulation::DEC<B_32,R_32,Q_32>* aff3ct::factory::DEC::build<B_32,R_32,Q_32>(const aff3ct::factory::DEC::parameters&);
+template aff3ct::simulation::DEC<B_64,R_64,Q_64>* aff3ct::factory::DEC::build<B_64,R_64,Q_64>(const aff3ct::factory::DEC::parameters&);
+#else
+template aff3ct::simulation::DEC<B,R,Q>* aff3ct::factory::DEC::build<B,R,Q>(const aff3ct::factory::DEC::parameters&);
+#endif
+// ==================================================================================== explicit template instantiation
@@ -0,0 +1,79 @@
+#ifndef FACTORY_SIMULATION_DEC_HPP_
+#define FACTORY_SIMULATION_DEC_HPP_
+
+#include <string>
+
+#include "Factory/Module/Source/Source.hpp"
+#include "Factory/Module/CRC/CRC.hpp"
+#include "Factory/Module/Codec/Codec_SIHO.hpp"
+#include "Factory/Module/Quantizer/Quantizer.hpp"
+
+#include "../Simulation.hpp"
+
+namespace aff3ct
+{
+namespace simulation
+{
+template <typename B, typename R, typename Q>
+class DEC;
+}
+}
+
+namespace aff3ct
+{
+namespace factory
+{
+extern const std::string DEC_name;
+extern const std::string DEC_prefix;
+struct DEC : Simulation
+{
+	class parameters : public Simulation::parameters
+	{
+	public:
+		// ------------------------------------------------------------------------------------------------- PARAMETERS
+		// required parameters
+		std::string llr_path  = "";
+
+		// optional parameters
+		std::string out_path  = "";
+		int         chunk     = 64;
+		float       sigma     = -1.f;
+
+		// module parameters
+		Source    ::parameters *src = nullptr;
+		CRC       ::parameters *crc = nullptr;
+		Codec_SIHO::parameters *cdc = nullptr;
+		Quantizer ::parameters *qnt = nullptr;
+
+		// ---------------------------------------------------------------------------------------------------- METHODS
+		explicit parameters(const std::string &p = DEC_prefix);
+		virtual ~parameters();
+		virtual DEC::parameters* clone() const;
+
+		virtual std::vector<std::string> get_names      () const;
+		virtual std::vector<std::string> get_short_names() const;
+		virtual std::vector<std::string> get_prefixes   () const;
+
+		// setters
+		void set_src(Source    ::parameters *src) { this->src = src; }
+		void set_crc(CRC       ::parameters *crc) { this->crc = crc; }
+		void set_cdc(Codec_SIHO::parameters *cdc) { this->cdc = cdc; }
+		void set_qnt(Quantizer ::parameters *qnt) { this->qnt = qnt; }
+
+		// parameters construction
+		void get_description(arg_map &req_args, arg_map &opt_args                              ) const;
+		void store          (const arg_val_map &vals                                           );
+		void get_headers    (std::map<std::string,header_list>& headers, const bool full = true) const;
+
+		// builder
+		template <typename B = int, typename R = float, typename Q = R>
+		simulation::DEC<B,R,Q>* build() const;
+	};
+
+	template <typename B = int, typename R = float, typename Q = R>
+	static simulation::DEC<B,R,Q>* build(const parameters &params);
+};
+}
+}
+
+#endif /* FACTORY_SIMULATION_DEC_HPP_ */
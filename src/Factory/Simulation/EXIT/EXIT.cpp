@@ -118,6 +118,11 @@ void EXIT::parameters
 	if(exist(vals, {p+"-siga-min", "a"})) this->sig_a_min  = std::stof(vals.at({p+"-siga-min", "a"}));
 	if(exist(vals, {p+"-siga-max", "A"})) this->sig_a_max  = std::stof(vals.at({p+"-siga-max", "A"}));
 	if(exist(vals, {p+"-siga-step"    })) this->sig_a_step = std::stof(vals.at({p+"-siga-step"    }));
+
+#ifndef ENABLE_MPI
+	// the EXIT simulation has no shared monitor
+	this->n_procs = 1;
+#endif
 }
 
 void EXIT::parameters
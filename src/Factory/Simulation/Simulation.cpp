@@ -76,6 +76,11 @@ void Simulation::parameters
 		{"positive_int",
 		 "specify the number of threads used (0 or default is the number of CPU cores)."};
 
+	opt_args[{p+"-pin"}] =
+		{"string",
+		 "pin the threads on the CPU cores: 'none', 'compact' (fill the NUMA nodes one by one), 'scatter' (round-robin"
+		 " on the NUMA nodes) or an explicit list of cores (ex: \"0-3,8,9\")."};
+
 	opt_args[{p+"-seed", "S"}] =
 		{"positive_int",
 		 "seed used in the simulation to initialize the pseudo random generators in general."};
@@ -84,6 +89,10 @@ void Simulation::parameters
 	opt_args[{p+"-mpi-comm"}] =
 		{"strictly_positive_int",
 		 "MPI communication frequency between the nodes (in millisec)."};
+#elif defined(__linux__) || defined(__linux) || defined(__APPLE__)
+	opt_args[{p+"-procs"}] =
+		{"strictly_positive_int",
+		 "number of processes forked to run the simulation, the monitors are shared through a POSIX shared memory."};
 #endif
 
 #ifdef ENABLE_COOL_BASH
@@ -107,6 +116,7 @@ void Simulation::parameters
 	if(exist(vals, {p+"-pyber"        })) this->pyber       =                   vals.at({p+"-pyber"        });
 	if(exist(vals, {p+"-snr-step", "s"})) this->snr_step    =         std::stof(vals.at({p+"-snr-step", "s"}));
 	if(exist(vals, {p+"-stop-time"    })) this->stop_time   = seconds(std::stoi(vals.at({p+"-stop-time"    })));
+	if(exist(vals, {p+"-pin"          })) this->thread_pin  =                   vals.at({p+"-pin"          });
 	if(exist(vals, {p+"-seed",     "S"})) this->global_seed =         std::stoi(vals.at({p+"-seed",     "S"}));
 	if(exist(vals, {p+"-stats"        })) this->statistics  = true;
 	if(exist(vals, {p+"-debug",    "d"})) this->debug       = true;
@@ -153,6 +163,11 @@ void Simulation::parameters
 	// ensure that all the MPI processes have a different seed (crucial for the Monte-Carlo method)
 	this->local_seed = this->global_seed + max_n_threads_global * this->mpi_rank;
 #else
+#if defined(__linux__) || defined(__linux) || defined(__APPLE__)
+	if(exist(vals, {p+"-procs"})) this->n_procs = std::stoi(vals.at({p+"-procs"}));
+#endif
+
+	// the seed of the forked processes is updated in the launcher (see 'proc_rank')
 	this->local_seed = this->global_seed;
 #endif
 
@@ -171,6 +186,11 @@ void Simulation::parameters
 	if (this->debug && !(exist(vals, {p+"-threads", "t"}) && std::stoi(vals.at({p+"-threads", "t"})) > 0))
 		// check if debug is asked and if n_thread kept its default value
 		this->n_threads = 1;
+
+#ifndef ENABLE_MPI
+	if (this->debug)
+		this->n_procs = 1;
+#endif
 }
 
 void Simulation::parameters
@@ -196,6 +216,9 @@ void Simulation::parameters
 #ifdef ENABLE_MPI
 	headers[p].push_back(std::make_pair("MPI comm. freq. (ms)", std::to_string(this->mpi_comm_freq.count())));
 	headers[p].push_back(std::make_pair("MPI size",             std::to_string(this->mpi_size             )));
+#else
+	if (this->n_procs > 1)
+		headers[p].push_back(std::make_pair("Processes", std::to_string(this->n_procs)));
 #endif
 
 	std::string threads = "unused";
@@ -203,4 +226,7 @@ void Simulation::parameters
 		threads = std::to_string(this->n_threads) + " thread(s)";
 
 	headers[p].push_back(std::make_pair("Multi-threading (t)", threads));
+
+	if (this->thread_pin != "none")
+		headers[p].push_back(std::make_pair("Thread pinning", this->thread_pin));
 }
@@ -33,9 +33,14 @@ struct Simulation : Launcher
 		std::chrono::milliseconds mpi_comm_freq   = std::chrono::milliseconds(1000);
 		int                       mpi_rank        = 0;
 		int                       mpi_size        = 1;
+#else
+		std::string               shm_name        = "";
+		int                       n_procs         = 1;
+		int                       proc_rank       = 0;
 #endif
 		std::chrono::seconds      stop_time       = std::chrono::seconds(0);
 		std::string               pyber           = "";
+		std::string               thread_pin      = "none";
 		float                     snr_step        = 0.1f;
 		bool                      debug           = false;
 		bool                      debug_hex       = false;
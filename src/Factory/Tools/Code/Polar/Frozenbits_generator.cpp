@@ -54,6 +54,10 @@ void Frozenbits_generator::parameters
 		{"string",
 		 "path to a file or a directory containing the best channels to use for information bits."};
 
+	opt_args[{p+"-db-path"}] =
+		{"string",
+		 "path to an existing directory where the best channels computed by the GA method are stored and reused."};
+
 #ifdef ENABLE_POLAR_BOUNDS
 	opt_args[{p+"-pb-path"}] =
 		{"string",
@@ -71,6 +75,7 @@ void Frozenbits_generator::parameters
 	if(exist(vals, {p+"-sigma"         })) this->sigma   = std::stof(vals.at({p+"-sigma"         }));
 	if(exist(vals, {p+"-awgn-path"     })) this->path_fb =           vals.at({p+"-awgn-path"     });
 	if(exist(vals, {p+"-gen-method"    })) this->type    =           vals.at({p+"-gen-method"    });
+	if(exist(vals, {p+"-db-path"       })) this->path_db =           vals.at({p+"-db-path"       });
 
 #ifdef ENABLE_POLAR_BOUNDS
 	if(exist(vals, {p+"-pb-path"})) this->path_pb = vals.at({p+"-pb-path"});
@@ -92,16 +97,24 @@ void Frozenbits_generator::parameters
 #endif
 	if (this->type == "TV" || this->type == "FILE")
 		headers[p].push_back(std::make_pair("Path", this->path_fb));
+	if (this->type == "GA" && !this->path_db.empty())
+		headers[p].push_back(std::make_pair("Database path", this->path_db));
 }
 
 tools::Frozenbits_generator* Frozenbits_generator::parameters
 ::build() const
 {
-	     if (this->type == "GA"  ) return new tools::Frozenbits_generator_GA  (this->K, this->N_cw,                               this->sigma);
-	else if (this->type == "TV"  ) return new tools::Frozenbits_generator_TV  (this->K, this->N_cw, this->path_fb, this->path_pb, this->sigma);
-	else if (this->type == "FILE") return new tools::Frozenbits_generator_file(this->K, this->N_cw, this->path_fb                            );
+	tools::Frozenbits_generator* fb_generator = nullptr;
+
+	     if (this->type == "GA"  ) fb_generator = new tools::Frozenbits_generator_GA  (this->K, this->N_cw,                               this->sigma);
+	else if (this->type == "TV"  ) fb_generator = new tools::Frozenbits_generator_TV  (this->K, this->N_cw, this->path_fb, this->path_pb, this->sigma);
+	else if (this->type == "FILE") fb_generator = new tools::Frozenbits_generator_file(this->K, this->N_cw, this->path_fb                            );
+
+	if (fb_generator == nullptr)
+		throw tools::cannot_allocate(__FILE__, __LINE__, __func__);
 
-	throw tools::cannot_allocate(__FILE__, __LINE__, __func__);
+	fb_generator->set_db_path(this->path_db);
+	return fb_generator;
 }
 
 tools::Frozenbits_generator* Frozenbits_generator
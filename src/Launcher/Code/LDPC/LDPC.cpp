@@ -1,7 +1,10 @@
 #include <iostream>
 #include <mipp.h>
 
+#include "Tools/Perf/bit_sliced.h"
+
 #include "Launcher/Simulation/BFER_std.hpp"
+#include "Launcher/Simulation/DEC.hpp"
 
 #include "Factory/Module/Codec/LDPC/Codec_LDPC.hpp"
 
@@ -17,7 +20,7 @@ LDPC<L,B,R,Q>
 {
 	this->params.set_cdc(params_cdc);
 
-	if (typeid(L) == typeid(BFER_std<B,R,Q>))
+	if (typeid(L) == typeid(BFER_std<B,R,Q>) || typeid(L) == typeid(DEC<B,R,Q>))
 		params_cdc->enable_puncturer();
 }
 
@@ -48,7 +51,14 @@ void LDPC<L,B,R,Q>
 	params_cdc->store(this->ar.get_args());
 
 	if (params_cdc->dec->simd_strategy == "INTER")
-		this->params.src->n_frames = mipp::N<Q>();
+	{
+		// the hard decision decoders are bit-sliced: one frame per bit of the SIMD registers
+		if (params_cdc->dec->implem == "GALA" || params_cdc->dec->implem == "GALB" ||
+		    params_cdc->dec->type == "BIT_FLIPPING")
+			this->params.src->n_frames = tools::bs_n_frames<B>();
+		else
+			this->params.src->n_frames = mipp::N<Q>();
+	}
 
 	if (std::is_same<Q,int8_t>() || std::is_same<Q,int16_t>())
 	{
@@ -58,6 +68,10 @@ void LDPC<L,B,R,Q>
 
 	L::store_args();
 
+	// in fixed-point the LLRs are scaled by the quantizer: the offset of the min-sum decoders is scaled the same way
+	if (std::is_same<Q,int8_t>() || std::is_same<Q,int16_t>())
+		params_cdc->dec->n_decimals = this->params.qnt->n_decimals;
+
 	params_cdc->enc->n_frames = this->params.src->n_frames;
 	if (params_cdc->pct)
 	params_cdc->pct->n_frames = this->params.src->n_frames;
@@ -68,6 +82,7 @@ void LDPC<L,B,R,Q>
 #include "Tools/types.h"
 #include "Launcher/Simulation/EXIT.hpp"
 #include "Launcher/Simulation/BFER_std.hpp"
+#include "Launcher/Simulation/DEC.hpp"
 #include "Launcher/Simulation/BFER_ite.hpp"
 #ifdef MULTI_PREC
 template class aff3ct::launcher::LDPC<aff3ct::launcher::EXIT    <B_32,R_32     >,B_32,R_32     >;
@@ -76,6 +91,10 @@ template class aff3ct::launcher::LDPC<aff3ct::launcher::BFER_std<B_8, R_8, Q_8 >
 template class aff3ct::launcher::LDPC<aff3ct::launcher::BFER_std<B_16,R_16,Q_16>,B_16,R_16,Q_16>;
 template class aff3ct::launcher::LDPC<aff3ct::launcher::BFER_std<B_32,R_32,Q_32>,B_32,R_32,Q_32>;
 template class aff3ct::launcher::LDPC<aff3ct::launcher::BFER_std<B_64,R_64,Q_64>,B_64,R_64,Q_64>;
+template class aff3ct::launcher::LDPC<aff3ct::launcher::DEC     <B_8, R_8, Q_8 >,B_8 ,R_8 ,Q_8 >;
+template class aff3ct::launcher::LDPC<aff3ct::launcher::DEC     <B_16,R_16,Q_16>,B_16,R_16,Q_16>;
+template class aff3ct::launcher::LDPC<aff3ct::launcher::DEC     <B_32,R_32,Q_32>,B_32,R_32,Q_32>;
+template class aff3ct::launcher::LDPC<aff3ct::launcher::DEC     <B_64,R_64,Q_64>,B_64,R_64,Q_64>;
 template class aff3ct::launcher::LDPC<aff3ct::launcher::BFER_ite<B_8, R_8, Q_8 >,B_8 ,R_8 ,Q_8 >;
 template class aff3ct::launcher::LDPC<aff3ct::launcher::BFER_ite<B_16,R_16,Q_16>,B_16,R_16,Q_16>;
 template class aff3ct::launcher::LDPC<aff3ct::launcher::BFER_ite<B_32,R_32,Q_32>,B_32,R_32,Q_32>;
@@ -85,6 +104,7 @@ template class aff3ct::launcher::LDPC<aff3ct::launcher::BFER_ite<B_64,R_64,Q_64>
 template class aff3ct::launcher::LDPC<aff3ct::launcher::EXIT    <B,R  >,B,R  >;
 #endif
 template class aff3ct::launcher::LDPC<aff3ct::launcher::BFER_std<B,R,Q>,B,R,Q>;
+template class aff3ct::launcher::LDPC<aff3ct::launcher::DEC     <B,R,Q>,B,R,Q>;
 template class aff3ct::launcher::LDPC<aff3ct::launcher::BFER_ite<B,R,Q>,B,R,Q>;
 #endif
 // ==================================================================================== explicit template instantiation
@@ -1,4 +1,5 @@
 #include <iostream>
+#include <mipp.h>
 
 #include "Factory/Module/Codec/RA/Codec_RA.hpp"
 
@@ -44,6 +45,9 @@ void RA<L,B,R,Q>
 {
 	this->params.cdc->store(this->ar.get_args());
 
+	if (params_cdc->dec->simd_strategy == "INTER")
+		this->params.src->n_frames = mipp::N<Q>();
+
 	L::store_args();
 
 	params_cdc->enc->n_frames = this->params.src->n_frames;
@@ -56,12 +60,18 @@ void RA<L,B,R,Q>
 // ==================================================================================== explicit template instantiation
 #include "Tools/types.h"
 #include "Launcher/Simulation/BFER_std.hpp"
+#include "Launcher/Simulation/DEC.hpp"
 #ifdef MULTI_PREC
 template class aff3ct::launcher::RA<aff3ct::launcher::BFER_std<B_8 ,R_8 ,Q_8 >,B_8 ,R_8 ,Q_8 >;
 template class aff3ct::launcher::RA<aff3ct::launcher::BFER_std<B_16,R_16,Q_16>,B_16,R_16,Q_16>;
 template class aff3ct::launcher::RA<aff3ct::launcher::BFER_std<B_32,R_32,Q_32>,B_32,R_32,Q_32>;
 template class aff3ct::launcher::RA<aff3ct::launcher::BFER_std<B_64,R_64,Q_64>,B_64,R_64,Q_64>;
+template class aff3ct::launcher::RA<aff3ct::launcher::DEC     <B_8 ,R_8 ,Q_8 >,B_8 ,R_8 ,Q_8 >;
+template class aff3ct::launcher::RA<aff3ct::launcher::DEC     <B_16,R_16,Q_16>,B_16,R_16,Q_16>;
+template class aff3ct::launcher::RA<aff3ct::launcher::DEC     <B_32,R_32,Q_32>,B_32,R_32,Q_32>;
+template class aff3ct::launcher::RA<aff3ct::launcher::DEC     <B_64,R_64,Q_64>,B_64,R_64,Q_64>;
 #else
 template class aff3ct::launcher::RA<aff3ct::launcher::BFER_std<B,R,Q>,B,R,Q>;
+template class aff3ct::launcher::RA<aff3ct::launcher::DEC     <B,R,Q>,B,R,Q>;
 #endif
 // ==================================================================================== explicit template instantiation
@@ -1,4 +1,5 @@
 #include <iostream>
+#include <mipp.h>
 
 #include "Factory/Module/Codec/RSC_DB/Codec_RSC_DB.hpp"
 
@@ -41,6 +42,9 @@ void RSC_DB<L,B,R,Q>
 {
 	params_cdc->store(this->ar.get_args());
 
+	if (params_cdc->dec->simd_strategy == "INTER")
+		this->params.src->n_frames = mipp::N<Q>();
+
 	if (std::is_same<Q,int8_t>())
 	{
 		this->params.qnt->n_bits     = 6;
@@ -62,6 +66,7 @@ void RSC_DB<L,B,R,Q>
 #include "Tools/types.h"
 #include "Launcher/Simulation/EXIT.hpp"
 #include "Launcher/Simulation/BFER_std.hpp"
+#include "Launcher/Simulation/DEC.hpp"
 #include "Launcher/Simulation/BFER_ite.hpp"
 #ifdef MULTI_PREC
 template class aff3ct::launcher::RSC_DB<aff3ct::launcher::EXIT    <B_32,R_32     >,B_32,R_32     >;
@@ -70,6 +75,10 @@ template class aff3ct::launcher::RSC_DB<aff3ct::launcher::BFER_std<B_8, R_8, Q_8
 template class aff3ct::launcher::RSC_DB<aff3ct::launcher::BFER_std<B_16,R_16,Q_16>,B_16,R_16,Q_16>;
 template class aff3ct::launcher::RSC_DB<aff3ct::launcher::BFER_std<B_32,R_32,Q_32>,B_32,R_32,Q_32>;
 template class aff3ct::launcher::RSC_DB<aff3ct::launcher::BFER_std<B_64,R_64,Q_64>,B_64,R_64,Q_64>;
+template class aff3ct::launcher::RSC_DB<aff3ct::launcher::DEC     <B_8, R_8, Q_8 >,B_8 ,R_8 ,Q_8 >;
+template class aff3ct::launcher::RSC_DB<aff3ct::launcher::DEC     <B_16,R_16,Q_16>,B_16,R_16,Q_16>;
+template class aff3ct::launcher::RSC_DB<aff3ct::launcher::DEC     <B_32,R_32,Q_32>,B_32,R_32,Q_32>;
+template class aff3ct::launcher::RSC_DB<aff3ct::launcher::DEC     <B_64,R_64,Q_64>,B_64,R_64,Q_64>;
 template class aff3ct::launcher::RSC_DB<aff3ct::launcher::BFER_ite<B_8, R_8, Q_8 >,B_8 ,R_8 ,Q_8 >;
 template class aff3ct::launcher::RSC_DB<aff3ct::launcher::BFER_ite<B_16,R_16,Q_16>,B_16,R_16,Q_16>;
 template class aff3ct::launcher::RSC_DB<aff3ct::launcher::BFER_ite<B_32,R_32,Q_32>,B_32,R_32,Q_32>;
@@ -79,6 +88,7 @@ template class aff3ct::launcher::RSC_DB<aff3ct::launcher::BFER_ite<B_64,R_64,Q_6
 template class aff3ct::launcher::RSC_DB<aff3ct::launcher::EXIT    <B,R  >,B,R  >;
 #endif
 template class aff3ct::launcher::RSC_DB<aff3ct::launcher::BFER_std<B,R,Q>,B,R,Q>;
+template class aff3ct::launcher::RSC_DB<aff3ct::launcher::DEC     <B,R,Q>,B,R,Q>;
 template class aff3ct::launcher::RSC_DB<aff3ct::launcher::BFER_ite<B,R,Q>,B,R,Q>;
 #endif
 // ==================================================================================== explicit template instantiation
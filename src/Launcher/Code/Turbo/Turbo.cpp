@@ -3,6 +3,7 @@
 #include <mipp.h>
 
 #include "Launcher/Simulation/BFER_std.hpp"
+#include "Launcher/Simulation/DEC.hpp"
 
 #include "Factory/Module/Codec/Turbo/Codec_turbo.hpp"
 
@@ -18,7 +19,7 @@ Turbo<L,B,R,Q>
 {
 	this->params.set_cdc(params_cdc);
 
-	if (typeid(L) == typeid(BFER_std<B,R,Q>))
+	if (typeid(L) == typeid(BFER_std<B,R,Q>) || typeid(L) == typeid(DEC<B,R,Q>))
 		params_cdc->enable_puncturer();
 }
 
@@ -84,12 +85,18 @@ void Turbo<L,B,R,Q>
 // ==================================================================================== explicit template instantiation
 #include "Tools/types.h"
 #include "Launcher/Simulation/BFER_std.hpp"
+#include "Launcher/Simulation/DEC.hpp"
 #ifdef MULTI_PREC
 template class aff3ct::launcher::Turbo<aff3ct::launcher::BFER_std<B_8 ,R_8 ,Q_8 >,B_8 ,R_8 ,Q_8 >;
 template class aff3ct::launcher::Turbo<aff3ct::launcher::BFER_std<B_16,R_16,Q_16>,B_16,R_16,Q_16>;
 template class aff3ct::launcher::Turbo<aff3ct::launcher::BFER_std<B_32,R_32,Q_32>,B_32,R_32,Q_32>;
 template class aff3ct::launcher::Turbo<aff3ct::launcher::BFER_std<B_64,R_64,Q_64>,B_64,R_64,Q_64>;
+template class aff3ct::launcher::Turbo<aff3ct::launcher::DEC     <B_8 ,R_8 ,Q_8 >,B_8 ,R_8 ,Q_8 >;
+template class aff3ct::launcher::Turbo<aff3ct::launcher::DEC     <B_16,R_16,Q_16>,B_16,R_16,Q_16>;
+template class aff3ct::launcher::Turbo<aff3ct::launcher::DEC     <B_32,R_32,Q_32>,B_32,R_32,Q_32>;
+template class aff3ct::launcher::Turbo<aff3ct::launcher::DEC     <B_64,R_64,Q_64>,B_64,R_64,Q_64>;
 #else
 template class aff3ct::launcher::Turbo<aff3ct::launcher::BFER_std<B,R,Q>,B,R,Q>;
+template class aff3ct::launcher::Turbo<aff3ct::launcher::DEC     <B,R,Q>,B,R,Q>;
 #endif
 // ==================================================================================== explicit template instantiation
@@ -6,6 +6,11 @@
 
 #ifdef ENABLE_MPI
 #include <mpi.h>
+#elif defined(__linux__) || defined(__linux) || defined(__APPLE__)
+#include <csignal>
+#include <unistd.h>
+#include <sys/wait.h>
+#include <sys/types.h>
 #endif
 
 #include "Tools/date.h"
@@ -26,6 +31,10 @@
 #include "Factory/Module/Monitor/Monitor.hpp"
 #include "Factory/Tools/Display/Terminal/Terminal.hpp"
 
+#if !defined(ENABLE_MPI) && (defined(__linux__) || defined(__linux) || defined(__APPLE__))
+#include "Module/Monitor/BFER/Monitor_BFER_reduction_shm.hpp"
+#endif
+
 #include "Launcher.hpp"
 
 using namespace aff3ct;
@@ -107,6 +116,76 @@ int Launcher::read_arguments()
 	return ((miss_arg || error) ? EXIT_FAILURE : EXIT_SUCCESS);
 }
 
+#ifndef ENABLE_MPI
+void Launcher::fork_processes()
+{
+	this->params_common.proc_rank = 0;
+	if (this->params_common.n_procs <= 1)
+		return;
+
+#if defined(__linux__) || defined(__linux) || defined(__APPLE__)
+	this->params_common.shm_name = "/aff3ct_" + std::to_string(getpid());
+	module::create_monitor_shm(this->params_common.shm_name, this->params_common.n_procs);
+	module::register_monitor_shm_proc(this->params_common.shm_name, this->params_common.n_procs, 0, (int)getpid());
+
+	// do not duplicate the buffered outputs in the forked processes
+	stream    << std::flush;
+	std::cout << std::flush;
+	std::cerr << std::flush;
+
+	for (auto r = 1; r < this->params_common.n_procs; r++)
+	{
+		auto pid = fork();
+		if (pid == -1)
+		{
+			for (auto p : child_pids)
+				kill((pid_t)p, SIGKILL);
+			this->join_processes();
+
+			throw tools::runtime_error(__FILE__, __LINE__, __func__, "'fork' failed.");
+		}
+
+		if (pid == 0)
+		{
+			this->params_common.proc_rank = r;
+			child_pids.clear();
+			break;
+		}
+
+		child_pids.push_back((int)pid);
+		module::register_monitor_shm_proc(this->params_common.shm_name, this->params_common.n_procs, r, (int)pid);
+	}
+
+	// ensure that all the processes have a different seed (crucial for the Monte-Carlo method)
+	this->params_common.local_seed = this->params_common.global_seed +
+	                                 this->params_common.n_threads * this->params_common.proc_rank;
+#endif
+}
+
+int Launcher::join_processes()
+{
+	auto exit_code = EXIT_SUCCESS;
+
+#if defined(__linux__) || defined(__linux) || defined(__APPLE__)
+	for (auto p : child_pids)
+	{
+		int status = 0;
+		if (waitpid((pid_t)p, &status, 0) == -1 || !WIFEXITED(status) || WEXITSTATUS(status) != EXIT_SUCCESS)
+			exit_code = EXIT_FAILURE;
+	}
+	child_pids.clear();
+
+	if (!this->params_common.shm_name.empty())
+	{
+		module::unlink_monitor_shm(this->params_common.shm_name);
+		this->params_common.shm_name = "";
+	}
+#endif
+
+	return exit_code;
+}
+#endif
+
 void Launcher::print_header()
 {
 	// display configuration and simulation parameters
@@ -169,6 +248,9 @@ int Launcher::launch()
 
 	try
 	{
+#ifndef ENABLE_MPI
+		this->fork_processes();
+#endif
 		simu = this->build_simu();
 	}
 	catch (std::exception const& e)
@@ -181,7 +263,9 @@ int Launcher::launch()
 	{
 		// launch the simulation
 #ifdef ENABLE_MPI
-	if (this->params_common.mpi_rank == 0)
+		if (this->params_common.mpi_rank == 0)
+#else
+		if (this->params_common.proc_rank == 0)
 #endif
 			stream << "# " << "The simulation is running..." << std::endl;
 
@@ -198,16 +282,24 @@ int Launcher::launch()
 		}
 	}
 
-#ifdef ENABLE_MPI
-	if (this->params_common.mpi_rank == 0)
-#endif
-		stream << "# End of the simulation." << std::endl;
-
 	if (simu != nullptr)
 	{
 		delete simu;
 		simu = nullptr;
 	}
 
+#ifndef ENABLE_MPI
+	if (this->params_common.proc_rank != 0)
+		return exit_code;
+
+	if (this->join_processes() == EXIT_FAILURE)
+		exit_code = EXIT_FAILURE;
+#endif
+
+#ifdef ENABLE_MPI
+	if (this->params_common.mpi_rank == 0)
+#endif
+		stream << "# End of the simulation." << std::endl;
+
 	return exit_code;
 }
@@ -34,6 +34,9 @@ private:
 	simulation::Simulation          *simu;          /*!< A generic simulation pointer to allocate a specific simulation. */
 	std::string                      cmd_line;
 	std::vector<std::string>         cmd_warn;
+#ifndef ENABLE_MPI
+	std::vector<int>                 child_pids;    /*!< The PIDs of the forked processes (only on the first process). */
+#endif
 
 protected:
 	tools::Arguments_reader          ar;            /*!< An argument reader to manage the parsing and the documentation of the command line parameters. */
@@ -99,6 +102,20 @@ protected:
 
 private:
 	int read_arguments();
+
+#ifndef ENABLE_MPI
+	/*!
+	 * \brief Forks the simulation processes and creates their shared memory segment.
+	 */
+	void fork_processes();
+
+	/*!
+	 * \brief Waits the forked processes and releases the shared memory segment.
+	 *
+	 * \return EXIT_FAILURE if one of the forked processes failed, EXIT_SUCCESS otherwise.
+	 */
+	int join_processes();
+#endif
 };
 }
 }
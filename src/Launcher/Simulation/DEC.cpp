@@ -0,0 +1,105 @@
+#include "Simulation/DEC/DEC.hpp"
+
+#include <string>
+#include <iostream>
+
+#include "DEC.hpp"
+
+using namespace aff3ct;
+using namespace aff3ct::launcher;
+
+template <typename B, typename R, typename Q>
+DEC<B,R,Q>
+::DEC(const int argc, const char **argv, std::ostream &stream)
+: Launcher(argc, argv, params, stream)
+{
+	params.set_src(new factory::Source   ::parameters("src"));
+	params.set_crc(new factory::CRC      ::parameters("crc"));
+	params.set_qnt(new factory::Quantizer::parameters("qnt"));
+}
+
+template <typename B, typename R, typename Q>
+DEC<B,R,Q>
+::~DEC()
+{
+}
+
+template <typename B, typename R, typename Q>
+void DEC<B,R,Q>
+::get_description_args()
+{
+	Launcher::get_description_args();
+
+	params.     get_description(this->req_args, this->opt_args);
+	params.src->get_description(this->req_args, this->opt_args);
+	params.crc->get_description(this->req_args, this->opt_args);
+	if (std::is_integral<Q>())
+	params.qnt->get_description(this->req_args, this->opt_args);
+
+	auto psrc = params.src     ->get_prefix();
+	auto pcrc = params.crc     ->get_prefix();
+	auto penc = params.cdc->enc->get_prefix();
+	auto ppct = std::string("pct");
+	auto pqnt = params.qnt     ->get_prefix();
+
+	if (this->req_args.find({penc+"-info-bits", "K"}) != this->req_args.end() ||
+	    this->req_args.find({ppct+"-info-bits", "K"}) != this->req_args.end())
+		this->req_args.erase({psrc+"-info-bits", "K"});
+	this->opt_args.erase({psrc+"-type"           });
+	this->opt_args.erase({psrc+"-path"           });
+	this->opt_args.erase({psrc+"-seed",       "S"});
+	this->req_args.erase({pcrc+"-info-bits",  "K"});
+	this->opt_args.erase({pcrc+"-fra",        "F"});
+	this->req_args.erase({pqnt+"-size",       "N"});
+	this->opt_args.erase({pqnt+"-fra",        "F"});
+}
+
+template <typename B, typename R, typename Q>
+void DEC<B,R,Q>
+::store_args()
+{
+	Launcher::store_args();
+
+	params.store(this->ar.get_args());
+
+	params.src->store(this->ar.get_args());
+
+	auto psrc = params.src->get_prefix();
+
+	auto K = this->req_args.find({psrc+"-info-bits", "K"}) != this->req_args.end() ? params.src->K : params.cdc->K;
+	auto N = this->req_args.find({psrc+"-info-bits", "K"}) != this->req_args.end() ? params.src->K : params.cdc->N;
+
+	params.crc->store(this->ar.get_args());
+
+	params.crc->K = K - params.crc->size;
+	params.src->K = params.src->K == 0 ? params.crc->K : params.src->K;
+
+	params.qnt->size = N;
+
+	if (std::is_integral<Q>())
+		params.qnt->store(this->ar.get_args());
+	else
+		params.qnt->type = "NO";
+
+	params.crc->n_frames = params.src->n_frames;
+	params.qnt->n_frames = params.src->n_frames;
+}
+
+template <typename B, typename R, typename Q>
+simulation::Simulation* DEC<B,R,Q>
+::build_simu()
+{
+	return factory::DEC::build<B,R,Q>(params);
+}
+
+// ==================================================================================== explicit template instantiation
+#include "Tools/types.h"
+#ifdef MULTI_PREC
+template class aff3ct::launcher::DEC<B_8,R_8,Q_8>;
+template class aff3ct::launcher::DEC<B_16,R_16,Q_16>;
+template class aff3ct::launcher::DEC<B_32,R_32,Q_32>;
+template class aff3ct::launcher::DEC<B_64,R_64,Q_64>;
+#else
+template class aff3ct::launcher::DEC<B,R,Q>;
+#endif
+// ==================================================================================== explicit template instantiation
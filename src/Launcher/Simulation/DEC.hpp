@@ -0,0 +1,31 @@
+#ifndef LAUNCHER_DEC_HPP_
+#define LAUNCHER_DEC_HPP_
+
+#include "Factory/Simulation/DEC/DEC.hpp"
+
+#include "../Launcher.hpp"
+
+namespace aff3ct
+{
+namespace launcher
+{
+template <typename B = int, typename R = float, typename Q = R>
+class DEC : public Launcher
+{
+protected:
+	factory::DEC::parameters params;
+
+public:
+	DEC(const int argc, const char **argv, std::ostream &stream = std::cout);
+	virtual ~DEC();
+
+protected:
+	virtual void get_description_args();
+	virtual void store_args();
+
+	virtual simulation::Simulation* build_simu();
+};
+}
+}
+
+#endif /* LAUNCHER_DEC_HPP_ */
@@ -1,6 +1,16 @@
+#include <cerrno>
+#include <cstring>
 #include <fstream>
 #include <sstream>
 
+#if defined(__linux__) || defined(__linux) || defined(__APPLE__)
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#define CHANNEL_USER_MMAP
+#endif
+
 #include "Tools/Exception/exception.hpp"
 
 #include "Channel_user.hpp"
@@ -11,7 +21,8 @@ using namespace aff3ct::module;
 template <typename R>
 Channel_user<R>
 ::Channel_user(const int N, const std::string &filename, const bool add_users, const int n_frames)
-: Channel<R>(N, (R)1, n_frames), add_users(add_users), noise_buff(), noise_counter(0)
+: Channel<R>(N, (R)1, n_frames), add_users(add_users), file_data(nullptr), file_size(0), file_buff(), n_fra_file(0),
+  sizeof_float(0), fra_first(0), fra_step(1), n_fra_played(0), noise_counter(0)
 {
 	const std::string name = "Channel_user";
 	this->set_name(name);
@@ -19,95 +30,141 @@ Channel_user<R>
 	if (filename.empty())
 		throw tools::invalid_argument(__FILE__, __LINE__, __func__, "'filename' should not be empty.");
 
-	std::ifstream file(filename.c_str(), std::ios::binary);
+#ifdef CHANNEL_USER_MMAP
+	const auto fd = ::open(filename.c_str(), O_RDONLY);
+	if (fd == -1)
+		throw tools::invalid_argument(__FILE__, __LINE__, __func__, "Can't open '" + filename + "' file");
 
-	if (file.is_open())
+	struct stat st;
+	if (fstat(fd, &st) == -1)
 	{
-		unsigned n_fra = 0;
-		int fra_size = 0;
+		::close(fd);
 
-		file.read((char*)&n_fra,    sizeof(n_fra));
-		file.read((char*)&fra_size, sizeof(fra_size));
-
-		file.ignore(std::numeric_limits<std::streamsize>::max());
-		std::streamsize length = file.gcount();
-		file.clear(); // since ignore will have set eof.
-		file.seekg(8, std::ios_base::beg);
+		std::stringstream message;
+		message << "'fstat' failed ('filename' = " << filename << ", 'errno' = " << std::strerror(errno) << ").";
+		throw tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
+	}
+	this->file_size = (size_t)st.st_size;
 
-		if (n_fra <= 0 || fra_size <= 0)
+	if (this->file_size >= 2 * sizeof(unsigned))
+	{
+		auto ptr = mmap(nullptr, this->file_size, PROT_READ, MAP_PRIVATE, fd, 0);
+		if (ptr == MAP_FAILED)
 		{
+			::close(fd);
+
 			std::stringstream message;
-			message << "'n_fra' and 'fra_size' have to be bigger than 0 ('n_fra' = "
-			        << n_fra << ", 'fra_size' = " << fra_size << ").";
+			message << "'mmap' failed ('filename' = " << filename << ", 'errno' = " << std::strerror(errno) << ").";
 			throw tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
 		}
+		this->file_data = (const char*)ptr;
+	}
+	::close(fd); // the mapping stays valid after the file is closed
+#else
+	std::ifstream file(filename.c_str(), std::ios::binary);
+	if (!file.is_open())
+		throw tools::invalid_argument(__FILE__, __LINE__, __func__, "Can't open '" + filename + "' file");
 
-		const unsigned sizeof_float = (unsigned)length / (n_fra * fra_size);
+	file.seekg(0, std::ios_base::end);
+	this->file_size = (size_t)file.tellg();
+	file.seekg(0, std::ios_base::beg);
 
-		this->noise_buff.resize(n_fra);
-		for (unsigned i = 0; i < (unsigned)n_fra; i++)
-			this->noise_buff[i].resize(fra_size);
+	this->file_buff.resize(this->file_size);
+	file.read(this->file_buff.data(), this->file_size);
+	file.close();
+	this->file_data = this->file_buff.data();
+#endif
 
-		if (fra_size == this->N)
-		{
-			if (sizeof_float == sizeof(R))
-			{
-				for (unsigned i = 0; i < n_fra; i++)
-					file.read(reinterpret_cast<char*>(&this->noise_buff[i][0]), fra_size * sizeof(R));
-			}
-			else
-			{
-				if (sizeof_float == sizeof(double))
-				{
-					std::vector<double> tmp(fra_size);
-					for (unsigned i = 0; i < n_fra; i++)
-					{
-						file.read(reinterpret_cast<char*>(tmp.data()), fra_size * sizeof(double));
-						for (auto j = 0; j < fra_size; j++)
-							this->noise_buff[i][j] = (R)tmp[j];
-					}
-				}
-				else if (sizeof_float == sizeof(float))
-				{
-					std::vector<float> tmp(fra_size);
-					for (unsigned i = 0; i < n_fra; i++)
-					{
-						file.read(reinterpret_cast<char*>(tmp.data()), fra_size * sizeof(float));
-						for (auto j = 0; j < fra_size; j++)
-							this->noise_buff[i][j] = (R)tmp[j];
-					}
-				}
-				else
-				{
-					file.close();
-
-					std::stringstream message;
-					message << "Something went wrong ('sizeof_float' = " << sizeof_float << ").";
-					throw tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
-				}
-			}
-		}
-		else
-		{
-			file.close();
+	unsigned n_fra = 0;
+	int fra_size = 0;
 
-			std::stringstream message;
-			message << "The frame size is wrong (read: " << fra_size << ", expected: " << this->N << ").";
-			throw tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
-		}
+	if (this->file_data != nullptr)
+	{
+		std::memcpy(&n_fra,    this->file_data,                  sizeof(n_fra   ));
+		std::memcpy(&fra_size, this->file_data + sizeof(n_fra), sizeof(fra_size));
+	}
 
-		file.close();
+	if (n_fra <= 0 || fra_size <= 0)
+	{
+		std::stringstream message;
+		message << "'n_fra' and 'fra_size' have to be bigger than 0 ('n_fra' = "
+		        << n_fra << ", 'fra_size' = " << fra_size << ").";
+		throw tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
 	}
-	else
+
+	if (fra_size != this->N)
 	{
-		throw tools::invalid_argument(__FILE__, __LINE__, __func__, "Can't open '" + filename + "' file");
+		std::stringstream message;
+		message << "The frame size is wrong (read: " << fra_size << ", expected: " << this->N << ").";
+		throw tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	const auto length = this->file_size - sizeof(n_fra) - sizeof(fra_size);
+	this->sizeof_float = (unsigned)(length / ((size_t)n_fra * fra_size));
+
+	if (this->sizeof_float != sizeof(float) && this->sizeof_float != sizeof(double))
+	{
+		std::stringstream message;
+		message << "Something went wrong ('sizeof_float' = " << this->sizeof_float << ").";
+		throw tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
 	}
+
+	this->n_fra_file   = n_fra;
+	this->n_fra_played = (int)n_fra;
 }
 
 template <typename R>
 Channel_user<R>
 ::~Channel_user()
 {
+#ifdef CHANNEL_USER_MMAP
+	if (this->file_data != nullptr)
+		munmap((void*)this->file_data, this->file_size);
+#endif
+}
+
+template <typename R>
+void Channel_user<R>
+::select_frames(const int first, const int step)
+{
+	if (first < 0 || step <= 0)
+	{
+		std::stringstream message;
+		message << "'first' has to be positive and 'step' has to be greater than 0 ('first' = " << first
+		        << ", 'step' = " << step << ").";
+		throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	if (first < (int)this->n_fra_file)
+	{
+		this->fra_first    = first;
+		this->n_fra_played = ((int)this->n_fra_file - first + step -1) / step;
+	}
+	else // less frames than subsets: play a single frame
+	{
+		this->fra_first    = first % (int)this->n_fra_file;
+		this->n_fra_played = 1;
+	}
+
+	this->fra_step      = step;
+	this->noise_counter = 0;
+}
+
+template <typename R>
+void Channel_user<R>
+::read_noise(R *noise)
+{
+	const auto fra_id = (size_t)this->fra_first + (size_t)this->noise_counter * this->fra_step;
+	const auto data   = this->file_data + 2 * sizeof(unsigned) + fra_id * this->N * this->sizeof_float;
+
+	if (this->sizeof_float == sizeof(R))
+		std::memcpy(noise, data, this->N * sizeof(R));
+	else if (this->sizeof_float == sizeof(double))
+		std::copy((const double*)data, (const double*)data + this->N, noise);
+	else
+		std::copy((const float*)data, (const float*)data + this->N, noise);
+
+	this->noise_counter = (this->noise_counter +1) % this->n_fra_played;
 }
 
 template <typename R>
@@ -129,13 +186,7 @@ void Channel_user<R>
 				Y_N[i] += X_N[f * this->N +i];
 
 		for (auto f = 0; f < this->n_frames; f++)
-		{
-			std::copy(this->noise_buff[this->noise_counter].begin(),
-			          this->noise_buff[this->noise_counter].end  (),
-			          this->noise.data() + f * this->N);
-
-			this->noise_counter = (this->noise_counter +1) % (int)this->noise_buff.size();
-		}
+			this->read_noise(this->noise.data() + f * this->N);
 
 		for (auto i = 0; i < this->N; i++)
 			Y_N[i] += this->noise[i];
@@ -147,14 +198,10 @@ void Channel_user<R>
 
 		for (auto f = f_start; f < f_stop; f++)
 		{
-			std::copy(this->noise_buff[this->noise_counter].begin(),
-			          this->noise_buff[this->noise_counter].end  (),
-			          this->noise.data() + f * this->N);
+			this->read_noise(this->noise.data() + f * this->N);
 
 			for (auto i = 0; i < this->N; i++)
 				Y_N[f * this->N +i] = X_N[f * this->N +i] + this->noise[f * this->N +i];
-
-			this->noise_counter = (this->noise_counter +1) % (int)this->noise_buff.size();
 		}
 	}
 }
@@ -10,12 +10,30 @@ namespace aff3ct
 {
 namespace module
 {
+/*!
+ * \class Channel_user
+ *
+ * \brief Adds the noise frames read from a binary file (header: the number of frames and the frame size as two 32-bit
+ *        integers, followed by the noise stored as 32-bit or 64-bit floats).
+ *
+ * The file is memory-mapped (when the system allows it) and the frames are read lazily: the memory usage does not
+ * depend on the size of the file and the mapping is shared between the channels of the different threads.
+ */
 template <typename R = float>
 class Channel_user : public Channel<R>
 {
 private:
 	const bool add_users;
-	mipp::vector<mipp::vector<R>> noise_buff;
+
+	const char        *file_data;    // the mapped file
+	size_t             file_size;    // size of the file in bytes
+	std::vector<char>  file_buff;    // the content of the file when it can't be mapped
+	unsigned           n_fra_file;   // number of frames in the file
+	unsigned           sizeof_float; // number of bytes of a noise value in the file
+
+	int fra_first;                   // first frame played
+	int fra_step;                    // gap between two played frames
+	int n_fra_played;                // number of played frames
 	int noise_counter;
 
 public:
@@ -23,6 +41,18 @@ public:
 	virtual ~Channel_user();
 
 	void add_noise(const R *X_N, R *Y_N, const int frame_id = -1);  using Channel<R>::add_noise;
+
+	/*!
+	 * \brief Plays only the frames 'first', 'first + step', 'first + 2 * step', etc. of the file (allows to split the
+	 *        frames between several channels).
+	 *
+	 * \param first: the first frame to play.
+	 * \param step:  the gap between two played frames.
+	 */
+	void select_frames(const int first, const int step);
+
+private:
+	void read_noise(R *noise);
 };
 }
 }
@@ -18,6 +18,7 @@ Codec_polar<B,Q>
   Codec_SISO_SIHO<B,Q>(enc_params.K, enc_params.N_cw, pct_params ? pct_params->N : enc_params.N_cw, enc_params.tail_length, enc_params.n_frames),
   adaptive_fb(fb_params.sigma == -1.f),
   frozen_bits(fb_params.N_cw, true),
+  generated_fb(),
   generated_decoder((dec_params.implem.find("_SNR") != std::string::npos)),
   fb_generator     (nullptr),
   puncturer_wangliu(nullptr),
@@ -172,9 +173,17 @@ void Codec_polar<B,Q>
 	if (adaptive_fb && !generated_decoder)
 	{
 		fb_generator->set_sigma(sigma);
-		fb_generator->generate(frozen_bits);
 
-		this->notify_frozenbits_update();
+		// the encoder and the decoder are not notified (and the decoder patterns are not parsed again) when the frozen
+		// bits did not change since the last SNR point
+		std::vector<bool> fb(this->frozen_bits.size());
+		fb_generator->generate(fb);
+		if (fb != this->generated_fb)
+		{
+			this->generated_fb = fb;
+			std::copy(fb.begin(), fb.end(), this->frozen_bits.begin());
+			this->notify_frozenbits_update();
+		}
 	}
 }
 
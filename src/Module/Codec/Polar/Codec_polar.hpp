@@ -23,6 +23,7 @@ class Codec_polar : public Codec_SISO_SIHO<B,Q>, public tools::Frozenbits_notifi
 protected:
 	const bool adaptive_fb;
 	std::vector<bool> frozen_bits; // known bits (alias frozen bits) are set to true
+	std::vector<bool> generated_fb; // last frozen bits given by the generator (before the puncturing)
 	const bool generated_decoder;
 	tools::Frozenbits_generator *fb_generator;
 	Puncturer_polar_wangliu<B,Q> *puncturer_wangliu;
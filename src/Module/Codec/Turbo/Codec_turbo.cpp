@@ -27,7 +27,8 @@ Codec_turbo<B,Q>
 : Codec     <B,Q>(enc_params.K, enc_params.N_cw, pct_params ? pct_params->N : enc_params.N_cw, enc_params.tail_length, enc_params.n_frames),
   Codec_SIHO<B,Q>(enc_params.K, enc_params.N_cw, pct_params ? pct_params->N : enc_params.N_cw, enc_params.tail_length, enc_params.n_frames),
   sub_enc(nullptr),
-  sub_dec(nullptr)
+  sub_dec(nullptr),
+  sub_dec_i(nullptr)
 {
 	const std::string name = "Codec_turbo";
 	this->set_name(name);
@@ -112,8 +113,14 @@ Codec_turbo<B,Q>
 	catch (tools::cannot_allocate const&)
 	{
 		sub_dec = factory::Decoder_RSC::build_siso<B,Q>(*dec_params.sub1, trellis, json_stream, dec_params.n_ite);
-		decoder_turbo = factory::Decoder_turbo::build<B,Q>(dec_params, this->get_interleaver_llr(), *sub_dec, *sub_dec,
-		                                                   this->get_encoder());
+
+		// the sub-block decoder keeps the metrics at the borders of its sub-blocks from one iteration to the next one:
+		// the natural and the interleaved domains can not share the same decoder
+		if (dec_params.sub1->implem == "SUB_BLOCK")
+			sub_dec_i = factory::Decoder_RSC::build_siso<B,Q>(*dec_params.sub1, trellis, json_stream, dec_params.n_ite);
+
+		decoder_turbo = factory::Decoder_turbo::build<B,Q>(dec_params, this->get_interleaver_llr(), *sub_dec,
+		                                                   sub_dec_i ? *sub_dec_i : *sub_dec, this->get_encoder());
 		this->set_decoder_siho(decoder_turbo);
 	}
 
@@ -157,8 +164,9 @@ template <typename B, typename Q>
 Codec_turbo<B,Q>
 ::~Codec_turbo()
 {
-	if (sub_enc != nullptr) { delete sub_enc; sub_enc = nullptr; }
-	if (sub_dec != nullptr) { delete sub_dec; sub_dec = nullptr; }
+	if (sub_enc   != nullptr) { delete sub_enc;   sub_enc   = nullptr; }
+	if (sub_dec   != nullptr) { delete sub_dec;   sub_dec   = nullptr; }
+	if (sub_dec_i != nullptr) { delete sub_dec_i; sub_dec_i = nullptr; }
 
 	if (post_pros.size())
 		for (auto i = 0; i < (int)post_pros.size(); i++)
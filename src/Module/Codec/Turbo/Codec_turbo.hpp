@@ -27,6 +27,7 @@ protected:
 	std::vector<std::vector<int>>                  trellis;
 	module::Encoder_RSC_sys<B>*                    sub_enc;
 	module::Decoder_SISO   <Q>*                    sub_dec;
+	module::Decoder_SISO   <Q>*                    sub_dec_i; // only for the SISO decoders which keep a state
 	std::vector<tools::Post_processing_SISO<B,Q>*> post_pros;
 	std::ofstream                                  json_stream;
 
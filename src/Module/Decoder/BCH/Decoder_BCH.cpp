@@ -14,7 +14,7 @@ Decoder_BCH<B, R>
 ::Decoder_BCH(const int& K, const int& N, const tools::BCH_polynomial_generator &GF_poly, const int n_frames)
 : Decoder               (K, N, n_frames, 1),
   Decoder_SIHO_HIHO<B,R>(K, N, n_frames, 1),
-  elp(N+2, std::vector<int>(N)), discrepancy(N+2), l(N+2), u_lu(N+2), s(N+1), loc(200), reg(201),
+  elp(N+2, std::vector<int>(N)), discrepancy(N+2), l(N+2), u_lu(N+2), reg(201), s(N+1), loc(200),
   m(GF_poly.get_m()), t(GF_poly.get_t()), d(GF_poly.get_d()), alpha_to(GF_poly.get_alpha_to()), index_of(GF_poly.get_index_of()),
   YH_N(N)
 {
@@ -36,8 +36,8 @@ Decoder_BCH<B, R>
 }
 
 template <typename B, typename R>
-void Decoder_BCH<B, R>
-::_decode(B *Y_N)
+bool Decoder_BCH<B, R>
+::_syndromes(const B *Y_N)
 {
 	int i, j, t2, syn_error = 0;
 
@@ -60,7 +60,48 @@ void Decoder_BCH<B, R>
 		s[i] = index_of[s[i]];
 	}
 
-	if (syn_error)
+	return syn_error != 0;
+}
+
+template <typename B, typename R>
+int Decoder_BCH<B, R>
+::_chien_search(const std::vector<int> &elp, const int deg)
+{
+	int i, j, q;
+
+	/* Chien search: find roots of the error location polynomial */
+	for (i = 1; i <= deg; i++)
+		reg[i] = elp[i];
+	int count = 0;
+	for (i = 1; i <= this->N; i++)
+	{
+		q = 1;
+		for (j = 1; j <= deg; j++)
+			if (reg[j] != -1)
+			{
+				reg[j] = (reg[j] + j) % this->N;
+				q ^= alpha_to[reg[j]];
+			}
+		if (!q)
+		{ /* store root and error
+		   * location number indices */
+			loc[count] = this->N - i;
+			count++;
+		}
+	}
+
+	return count;
+}
+
+template <typename B, typename R>
+void Decoder_BCH<B, R>
+::_decode(B *Y_N)
+{
+	int i, j, t2;
+
+	t2 = 2 * t;
+
+	if (this->_syndromes(Y_N))
 	{ /* if there are errors, try to correct them */
 		/*
 		 * Compute the error location polynomial via the Berlekamp
@@ -170,26 +211,7 @@ void Decoder_BCH<B, R>
 			for (i = 0; i <= l[u]; i++)
 				elp[u][i] = index_of[elp[u][i]];
 
-			/* Chien search: find roots of the error location polynomial */
-			for (i = 1; i <= l[u]; i++)
-				reg[i] = elp[u][i];
-			int count = 0;
-			for (i = 1; i <= this->N; i++)
-			{
-				q = 1;
-				for (j = 1; j <= l[u]; j++)
-					if (reg[j] != -1)
-					{
-						reg[j] = (reg[j] + j) % this->N;
-						q ^= alpha_to[reg[j]];
-					}
-				if (!q)
-				{ /* store root and error
-				   * location number indices */
-					loc[count] = this->N - i;
-					count++;
-				}
-			}
+			const auto count = this->_chien_search(elp[u], l[u]);
 
 			if (count == l[u])
 				/* no. roots = degree of elp hence <= t errors */
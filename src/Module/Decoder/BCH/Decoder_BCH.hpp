@@ -19,11 +19,12 @@ private:
 	std::vector<int> discrepancy;
 	std::vector<int> l;
 	std::vector<int> u_lu;
-	std::vector<int> s;
-	std::vector<int> loc;
 	std::vector<int> reg;
 
 protected:
+	std::vector<int> s;        // syndromes (index form)
+	std::vector<int> loc;      // error locations
+
 	const int m;               // order of the Galois Field
 	const int t;               // correction power
 	const int d;               // minimum distance of the code (d=2t+1))
@@ -38,11 +39,13 @@ public:
 	virtual ~Decoder_BCH();
 
 protected:
-	void _decode        (      B *Y_N                            );
-	void _decode_hiho   (const B *Y_N, B *V_K, const int frame_id);
-	void _decode_hiho_cw(const B *Y_N, B *V_N, const int frame_id);
-	void _decode_siho   (const R *Y_N, B *V_K, const int frame_id);
-	void _decode_siho_cw(const R *Y_N, B *V_N, const int frame_id);
+	        void _decode        (      B *Y_N                            );
+	virtual bool _syndromes     (const B *Y_N                            );
+	virtual int  _chien_search  (const std::vector<int> &elp, const int deg);
+	        void _decode_hiho   (const B *Y_N, B *V_K, const int frame_id);
+	        void _decode_hiho_cw(const B *Y_N, B *V_N, const int frame_id);
+	        void _decode_siho   (const R *Y_N, B *V_K, const int frame_id);
+	        void _decode_siho_cw(const R *Y_N, B *V_N, const int frame_id);
 };
 }
 }
@@ -0,0 +1,148 @@
+#include <algorithm>
+
+#include "Decoder_BCH_fast.hpp"
+
+using namespace aff3ct;
+using namespace aff3ct::module;
+
+// number of positions evaluated at once by the Chien search
+constexpr int chien_blk = 64;
+
+template <typename B, typename R>
+Decoder_BCH_fast<B, R>
+::Decoder_BCH_fast(const int& K, const int& N, const tools::BCH_polynomial_generator &GF_poly, const int n_frames)
+: Decoder               (K, N, n_frames, 1),
+  Decoder_BCH<B,R>      (K, N, GF_poly, n_frames),
+  Y_packed((N + 7) / 8),
+  syn_tab(this->t * 256),
+  syn_poly(2 * this->t + 1),
+  reg_exp(this->t + 1),
+  q_blk(chien_blk)
+{
+	const std::string name = "Decoder_BCH_fast";
+	this->set_name(name);
+
+	// the contribution of the byte 'v' to the syndrome 'i' is the sum of alpha^(i*k) for each bit k set in 'v',
+	// only the odd syndromes are computed this way (S_2i = S_i^2 in GF(2^m))
+	for (auto i = 1; i < 2 * this->t; i += 2)
+	{
+		auto tab = syn_tab.data() + (i / 2) * 256;
+		for (auto v = 0; v < 256; v++)
+		{
+			tab[v] = 0;
+			for (auto k = 0; k < 8; k++)
+				if ((v >> k) & 1)
+					tab[v] ^= this->alpha_to[(i * k) % N];
+		}
+	}
+}
+
+template <typename B, typename R>
+Decoder_BCH_fast<B, R>
+::~Decoder_BCH_fast()
+{
+}
+
+template <typename B, typename R>
+bool Decoder_BCH_fast<B, R>
+::_syndromes(const B *Y_N)
+{
+	const auto N  = this->N;
+	const auto t2 = 2 * this->t;
+	const auto n_bytes = (int)Y_packed.size();
+
+	// pack the hard decisions: the bit k of the byte b is the position 8*b+k
+	std::fill(Y_packed.begin(), Y_packed.end(), (unsigned char)0);
+	for (auto j = 0; j < N; j++)
+		Y_packed[j >> 3] |= (unsigned char)((Y_N[j] != 0) << (j & 7));
+
+	// odd syndromes, Horner scheme on the bytes: S_i = (...(T_i[y_nb-1] * a^8i + T_i[y_nb-2]) * a^8i ...) + T_i[y_0]
+	for (auto i = 1; i < t2; i += 2)
+	{
+		const auto tab    = syn_tab.data() + (i / 2) * 256;
+		const auto shift  = (8 * i) % N;
+		auto       acc    = 0;
+
+		for (auto b = n_bytes -1; b >= 0; b--)
+		{
+			if (acc)
+			{
+				auto e = this->index_of[acc] + shift;
+				e = (e >= N) ? e - N : e;
+				acc = this->alpha_to[e];
+			}
+			acc ^= tab[Y_packed[b]];
+		}
+
+		syn_poly[i] = acc;
+	}
+
+	// even syndromes
+	for (auto i = 2; i <= t2; i += 2)
+	{
+		const auto h = syn_poly[i / 2];
+		syn_poly[i] = h ? this->alpha_to[(2 * this->index_of[h]) % N] : 0;
+	}
+
+	auto syn_error = false;
+	for (auto i = 1; i <= t2; i++)
+	{
+		syn_error |= syn_poly[i] != 0;
+		this->s[i] = this->index_of[syn_poly[i]];
+	}
+
+	return syn_error;
+}
+
+template <typename B, typename R>
+int Decoder_BCH_fast<B, R>
+::_chien_search(const std::vector<int> &elp, const int deg)
+{
+	const auto N = this->N;
+
+	for (auto j = 1; j <= deg; j++)
+		reg_exp[j] = elp[j];
+
+	// the loops are interchanged compared to the standard implementation: the polynomial terms are accumulated on a
+	// block of contiguous positions (no modulo and no branch in the inner loop) and the search stops when all the
+	// roots have been found
+	auto count = 0;
+	for (auto i0 = 1; i0 <= N && count < deg; i0 += chien_blk)
+	{
+		const auto n_pos = std::min(chien_blk, N - i0 + 1);
+		std::fill(q_blk.begin(), q_blk.begin() + n_pos, 1);
+
+		for (auto j = 1; j <= deg; j++)
+		{
+			if (reg_exp[j] == -1)
+				continue;
+
+			auto e = reg_exp[j];
+			for (auto p = 0; p < n_pos; p++)
+			{
+				e += j;
+				e = (e >= N) ? e - N : e;
+				q_blk[p] ^= this->alpha_to[e];
+			}
+			reg_exp[j] = e;
+		}
+
+		for (auto p = 0; p < n_pos; p++)
+			if (!q_blk[p])
+				this->loc[count++] = N - (i0 + p);
+	}
+
+	return count;
+}
+
+// ==================================================================================== explicit template instantiation
+#include "Tools/types.h"
+#ifdef MULTI_PREC
+template class aff3ct::module::Decoder_BCH_fast<B_8,Q_8>;
+template class aff3ct::module::Decoder_BCH_fast<B_16,Q_16>;
+template class aff3ct::module::Decoder_BCH_fast<B_32,Q_32>;
+template class aff3ct::module::Decoder_BCH_fast<B_64,Q_64>;
+#else
+template class aff3ct::module::Decoder_BCH_fast<B,Q>;
+#endif
+// ==================================================================================== explicit template instantiation
@@ -0,0 +1,33 @@
+#ifndef DECODER_BCH_FAST
+#define DECODER_BCH_FAST
+
+#include <vector>
+
+#include "Decoder_BCH.hpp"
+
+namespace aff3ct
+{
+namespace module
+{
+template <typename B = int, typename R = float>
+class Decoder_BCH_fast : public Decoder_BCH<B,R>
+{
+private:
+	std::vector<unsigned char> Y_packed; // hard decision input vector packed in bytes
+	std::vector<int>           syn_tab;  // per byte contribution to the odd syndromes (polynomial form)
+	std::vector<int>           syn_poly; // syndromes (polynomial form)
+	std::vector<int>           reg_exp;  // Chien search registers
+	std::vector<int>           q_blk;    // Chien search evaluations of a block of positions
+
+public:
+	Decoder_BCH_fast(const int& K, const int& N, const tools::BCH_polynomial_generator &GF, const int n_frames = 1);
+	virtual ~Decoder_BCH_fast();
+
+protected:
+	bool _syndromes   (const B *Y_N                                   );
+	int  _chien_search(const std::vector<int> &elp, const int deg);
+};
+}
+}
+
+#endif /* DECODER_BCH_FAST */
@@ -36,9 +36,9 @@ namespace module
 template <typename B = int, typename R = float>
 class Decoder_SIHO : virtual public Decoder
 {
-private:
-	std::vector<R> Y_N;
-	std::vector<B> V_KN;
+protected:
+	std::vector<R> Y_N;  // buffer of the last wave (or of the wave of a single frame) when it is not full
+	std::vector<B> V_KN; // buffer of the last wave (or of the wave of a single frame) when it is not full
 
 public:
 	/*!
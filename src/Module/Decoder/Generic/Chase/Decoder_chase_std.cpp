@@ -1,6 +1,8 @@
 #include <chrono>
 #include <iostream>
 #include <algorithm>
+#include <numeric>
+#include <limits>
 
 #include "Tools/Exception/exception.hpp"
 #include "Tools/Algo/Bit_packer.hpp"
@@ -24,7 +26,16 @@ Decoder_chase_std<B,R>
   hamming(hamming),
   min_euclidean_dist(std::numeric_limits<float>::max()),
   min_hamming_dist(std::numeric_limits<uint32_t>::max()),
-  best_test(0)
+  best_test(0),
+  n_synd_words(std::max(1, (N - K + 63) / 64)),
+  info_idx(N, -1),
+  parity_idx(N, -1),
+  syndrome(n_synd_words),
+  info_cols(K * n_synd_words),
+  is_info_col(K, 0),
+  flip_cols(max_flips * n_synd_words),
+  U_K_tmp(K),
+  X_N_tmp(N)
 {
 	const std::string name = "Decoder_chase_std";
 	this->set_name(name);
@@ -139,22 +150,98 @@ void Decoder_chase_std<B,R>
 			V_N[this->less_reliable_llrs[b]] = !V_N[this->less_reliable_llrs[b]];
 }
 
+template <typename B, typename R>
+void Decoder_chase_std<B,R>
+::_decode_siho_cw_syndrome(const R *Y_N, B *V_N)
+{
+	this->_update_syndrome_map();
+
+	if (this->_init_syndrome(V_N))
+		return;
+
+	this->_sort_less_reliable(Y_N);
+	this->_init_flip_cols();
+
+	this->_flip_syndrome(0);
+	if (this->_is_syndrome_null())
+	{
+		V_N[less_reliable_llrs[0]] = !V_N[less_reliable_llrs[0]];
+		return;
+	}
+	this->_flip_syndrome(0);
+
+	this->min_hamming_dist   = std::numeric_limits<uint32_t>::max();
+	this->min_euclidean_dist = std::numeric_limits<float>::max();
+
+	// enumerate the test patterns in Gray code order: only one bit changes between two consecutive patterns and the
+	// syndrome is updated with a single column, the patterns 0 and 1 have already been checked
+	uint32_t max = 1 << max_flips;
+	uint32_t cur_hamming_dist = 0;
+	for (uint32_t t = 1; t < max; t++)
+	{
+		uint32_t b = 0;
+		while (!((t >> b) & 1))
+			b++;
+
+		const uint32_t g = t ^ (t >> 1);
+		if ((g >> b) & 1) cur_hamming_dist++; else cur_hamming_dist--;
+		this->_flip_syndrome(b);
+
+		if (g < 2 || !this->_is_syndrome_null())
+			continue;
+
+		// the ties are broken as in the exhaustive version: the smallest pattern wins
+		if (this->hamming)
+		{
+			if (cur_hamming_dist < this->min_hamming_dist ||
+			   (cur_hamming_dist == this->min_hamming_dist && g < this->best_test))
+			{
+				this->min_hamming_dist = cur_hamming_dist;
+				this->best_test = g;
+			}
+		}
+		else
+		{
+			auto cur_euclidean_dist = 0.f;
+			for (size_t f = 0; f < this->max_flips; f++)
+				if ((g >> f) & 1)
+					cur_euclidean_dist += std::abs(Y_N[this->less_reliable_llrs[f]]);
+
+			if (cur_euclidean_dist < this->min_euclidean_dist ||
+			   (cur_euclidean_dist == this->min_euclidean_dist && g < this->best_test))
+			{
+				this->min_euclidean_dist = cur_euclidean_dist;
+				this->best_test = g;
+			}
+		}
+	}
+
+	for (size_t b = 0; b < this->max_flips; b++)
+		if ((best_test >> b) & 1)
+			V_N[this->less_reliable_llrs[b]] = !V_N[this->less_reliable_llrs[b]];
+}
+
 template <typename B, typename R>
 void Decoder_chase_std<B,R>
 ::_decode_siho_cw(const R *Y_N, B *V_N, const int frame_id)
 {
 	tools::hard_decide(Y_N, V_N, this->N);
 
-	if (this->max_flips && !this->encoder.is_codeword(V_N))
+	if (!this->max_flips)
+		return;
+
+	// with a systematic encoder, the test patterns are checked with an incremental syndrome instead of a call to
+	// 'encoder.is_codeword' per pattern (the encoder is used to compute the syndrome columns, it is not possible when
+	// it memorizes the encoded frames)
+	if (this->encoder.is_sys() && !this->encoder.is_memorizing())
 	{
-		std::iota(less_reliable_llrs.begin(), less_reliable_llrs.end(), 0);
+		this->_decode_siho_cw_syndrome(Y_N, V_N);
+		return;
+	}
 
-		std::partial_sort(less_reliable_llrs.begin(),
-		                  less_reliable_llrs.begin() + this->max_flips,
-		                  less_reliable_llrs.end(),
-		                  [&Y_N](const uint32_t i1, const uint32_t i2) { 
-			return std::abs(Y_N[i1]) < std::abs(Y_N[i2]);
-		});
+	if (!this->encoder.is_codeword(V_N))
+	{
+		this->_sort_less_reliable(Y_N);
 
 		V_N[less_reliable_llrs[0]] = !V_N[less_reliable_llrs[0]];
 		if (!this->encoder.is_codeword(V_N))
@@ -174,6 +261,124 @@ void Decoder_chase_std<B,R>
 	}
 }
 
+template <typename B, typename R>
+void Decoder_chase_std<B,R>
+::_sort_less_reliable(const R *Y_N)
+{
+	std::iota(less_reliable_llrs.begin(), less_reliable_llrs.end(), 0);
+
+	std::partial_sort(less_reliable_llrs.begin(),
+	                  less_reliable_llrs.begin() + this->max_flips,
+	                  less_reliable_llrs.end(),
+	                  [&Y_N](const uint32_t i1, const uint32_t i2) { 
+		return std::abs(Y_N[i1]) < std::abs(Y_N[i2]);
+	});
+}
+
+template <typename B, typename R>
+void Decoder_chase_std<B,R>
+::_update_syndrome_map()
+{
+	// the information bits positions can change during the simulation (e.g. the frozen bits of the polar codes)
+	const auto &info_bits_pos = this->encoder.get_info_bits_pos();
+	if (info_bits_pos == this->cur_info_bits_pos)
+		return;
+
+	this->cur_info_bits_pos = info_bits_pos;
+
+	std::fill(this->info_idx.begin(), this->info_idx.end(), -1);
+	for (auto k = 0; k < this->K; k++)
+		this->info_idx[info_bits_pos[k]] = k;
+
+	auto p = 0;
+	for (auto n = 0; n < this->N; n++)
+		this->parity_idx[n] = (this->info_idx[n] == -1) ? p++ : -1;
+
+	std::fill(this->is_info_col.begin(), this->is_info_col.end(), (uint8_t)0);
+}
+
+template <typename B, typename R>
+bool Decoder_chase_std<B,R>
+::_init_syndrome(const B *V_N)
+{
+	for (auto k = 0; k < this->K; k++)
+		this->U_K_tmp[k] = V_N[this->cur_info_bits_pos[k]];
+
+	this->encoder.encode(this->U_K_tmp.data(), this->X_N_tmp.data(), 0);
+
+	std::fill(this->syndrome.begin(), this->syndrome.end(), (uint64_t)0);
+	for (auto n = 0; n < this->N; n++)
+	{
+		const auto p = this->parity_idx[n];
+		if (p != -1 && (this->X_N_tmp[n] != 0) != (V_N[n] != 0))
+			this->syndrome[p >> 6] |= (uint64_t)1 << (p & 63);
+	}
+
+	return this->_is_syndrome_null();
+}
+
+template <typename B, typename R>
+void Decoder_chase_std<B,R>
+::_init_flip_cols()
+{
+	const auto n_words = this->n_synd_words;
+
+	std::fill(this->flip_cols.begin(), this->flip_cols.end(), (uint64_t)0);
+	for (uint32_t b = 0; b < this->max_flips; b++)
+	{
+		const auto n   = this->less_reliable_llrs[b];
+		auto       col = this->flip_cols.data() + b * n_words;
+
+		const auto p = this->parity_idx[n];
+		if (p != -1)
+		{
+			// a parity bit only changes its own syndrome bit
+			col[p >> 6] = (uint64_t)1 << (p & 63);
+			continue;
+		}
+
+		// an information bit changes the syndrome by the parity bits of its unit codeword (the code is linear)
+		const auto k = this->info_idx[n];
+		auto info_col = this->info_cols.data() + k * n_words;
+		if (!this->is_info_col[k])
+		{
+			std::fill(this->U_K_tmp.begin(), this->U_K_tmp.end(), (B)0);
+			this->U_K_tmp[k] = (B)1;
+			this->encoder.encode(this->U_K_tmp.data(), this->X_N_tmp.data(), 0);
+
+			std::fill(info_col, info_col + n_words, (uint64_t)0);
+			for (auto i = 0; i < this->N; i++)
+			{
+				const auto q = this->parity_idx[i];
+				if (q != -1 && this->X_N_tmp[i])
+					info_col[q >> 6] |= (uint64_t)1 << (q & 63);
+			}
+			this->is_info_col[k] = 1;
+		}
+
+		std::copy(info_col, info_col + n_words, col);
+	}
+}
+
+template <typename B, typename R>
+bool Decoder_chase_std<B,R>
+::_is_syndrome_null() const
+{
+	uint64_t acc = 0;
+	for (auto w = 0; w < this->n_synd_words; w++)
+		acc |= this->syndrome[w];
+	return acc == 0;
+}
+
+template <typename B, typename R>
+void Decoder_chase_std<B,R>
+::_flip_syndrome(const uint32_t b)
+{
+	const auto col = this->flip_cols.data() + b * this->n_synd_words;
+	for (auto w = 0; w < this->n_synd_words; w++)
+		this->syndrome[w] ^= col[w];
+}
+
 // ==================================================================================== explicit template instantiation 
 #include "Tools/types.h"
 #ifdef MULTI_PREC
@@ -1,6 +1,9 @@
 #ifndef DECODER_CHASE_STD_HPP_
 #define DECODER_CHASE_STD_HPP_
 
+#include <cstdint>
+#include <vector>
+
 #include "Module/Encoder/Encoder.hpp"
 
 #include "../../Decoder_SIHO_HIHO.hpp"
@@ -22,6 +25,19 @@ protected:
 	uint32_t min_hamming_dist;
 	uint32_t best_test;
 
+	// incremental syndrome (systematic encoders only): the syndrome is the difference between the parity bits
+	// re-encoded from the information bits and the received parity bits, packed in 64-bit words
+	const int n_synd_words;
+	std::vector<uint32_t> cur_info_bits_pos;
+	std::vector<int> info_idx;          // index of each position in the information bits (-1 for the parity bits)
+	std::vector<int> parity_idx;        // index of each position in the syndrome (-1 for the information bits)
+	std::vector<uint64_t> syndrome;
+	std::vector<uint64_t> info_cols;    // syndrome variation when flipping an information bit (lazily computed)
+	std::vector<uint8_t> is_info_col;
+	std::vector<uint64_t> flip_cols;    // syndrome variation of each of the 'max_flips' least reliable positions
+	std::vector<B> U_K_tmp;
+	std::vector<B> X_N_tmp;
+
 public:
 	Decoder_chase_std(const int K, const int N, Encoder<B> &encoder, const uint32_t max_flips = 3, 
 	                  const bool hamming = false, const int n_frames = 1);
@@ -33,6 +49,16 @@ protected:
 
 	void _decode_siho_cw_euclidean(const R *Y_N, B *V_N);
 	void _decode_siho_cw_hamming  (              B *V_N);
+
+	void _decode_siho_cw_syndrome (const R *Y_N, B *V_N);
+
+private:
+	void _sort_less_reliable(const R *Y_N);
+	void _update_syndrome_map();
+	bool _init_syndrome (const B *V_N);
+	void _init_flip_cols();
+	bool _is_syndrome_null() const;
+	void _flip_syndrome (const uint32_t b);
 };
 }
 }
@@ -1,5 +1,8 @@
 #include <chrono>
+#include <bitset>
+#include <thread>
 #include <iostream>
+#include <algorithm>
 
 #include "Tools/Exception/exception.hpp"
 #include "Tools/Algo/Bit_packer.hpp"
@@ -10,15 +13,44 @@
 using namespace aff3ct;
 using namespace aff3ct::module;
 
+// number of bits of an information word below which the search is not split between several threads
+constexpr int min_K_threads = 16;
+
+static inline uint32_t popcount64(const uint64_t x)
+{
+	return (uint32_t)std::bitset<64>(x).count();
+}
+
 template <typename B, typename R>
 Decoder_maximum_likelihood_std<B,R>
-::Decoder_maximum_likelihood_std(const int K, const int N, Encoder<B> &encoder, const bool hamming, const int n_frames)
+::Decoder_maximum_likelihood_std(const int K, const int N, Encoder<B> &encoder, const bool hamming, const int n_frames,
+                                 const int n_threads)
 : Decoder                        (K, N,          n_frames, 1),
   Decoder_maximum_likelihood<B,R>(K, N, encoder, n_frames   ),
   hamming(hamming),
+  n_threads(n_threads),
   u_max(0),
   min_euclidean_dist(std::numeric_limits<float>::max()),
-  min_hamming_dist(std::numeric_limits<uint32_t>::max())
+  min_hamming_dist(std::numeric_limits<uint32_t>::max()),
+  n_words((N + 63) / 64),
+  N_pad(((N + mipp::nElReg<float>() -1) / mipp::nElReg<float>()) * mipp::nElReg<float>()),
+  is_linear(false),
+  gen_rows(K * n_words),
+  gen_signs(K * N_pad),
+  Y_N_pad(N_pad, 0.f),
+  hard_Y_N_packed(n_words),
+  Z_N(n_threads, mipp::vector<float>(N_pad)),
+  C_N(n_threads, std::vector<uint64_t>(n_words)),
+  best_corr(n_threads),
+  best_dist(n_threads),
+  best_u(n_threads),
+  n_chunks(1),
+  n_low_bits(K),
+  n_workers(1),
+  search_id(0),
+  n_running(0),
+  search_euclidean(true),
+  stop_workers(false)
 {
 	const std::string name = "Decoder_maximum_likelihood_std";
 	this->set_name(name);
@@ -30,17 +62,46 @@ Decoder_maximum_likelihood_std<B,R>
 		throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
 	}
 
+	if (n_threads <= 0)
+	{
+		std::stringstream message;
+		message << "'n_threads' has to be greater than 0 ('n_threads' = " << n_threads << ").";
+		throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
 	// determine the maximum sequence 'u' of information bits
 	if (K == 64)
 		this->u_max = std::numeric_limits<uint64_t>::max();
 	else
 		this->u_max = ((uint64_t)1 << (uint64_t)(K)) -1;
+
+	// each chunk of information words has a fixed prefix (the most significant bits), the small codes are explored by
+	// the calling thread only
+	auto n_prefix_bits = 0;
+	if (n_threads > 1 && K >= min_K_threads)
+		while ((1 << n_prefix_bits) < n_threads)
+			n_prefix_bits++;
+
+	this->n_chunks   = 1 << n_prefix_bits;
+	this->n_low_bits = K - n_prefix_bits;
+	this->n_workers  = std::min(n_threads, this->n_chunks);
+
+	for (auto tid = 1; tid < this->n_workers; tid++)
+		this->workers.push_back(std::thread(&Decoder_maximum_likelihood_std<B,R>::_worker, this, tid));
 }
 
 template <typename B, typename R>
 Decoder_maximum_likelihood_std<B,R>
 ::~Decoder_maximum_likelihood_std()
 {
+	{
+		std::lock_guard<std::mutex> lock(this->mutex_search);
+		this->stop_workers = true;
+	}
+	this->cond_start.notify_all();
+
+	for (auto &t : this->workers)
+		t.join();
 }
 
 template <typename B, typename R>
@@ -60,50 +121,355 @@ void Decoder_maximum_likelihood_std<B,R>
 	{
 		tools::hard_decide(Y_N, this->hard_Y_N.data(), this->N);
 		this->_decode_hiho_cw(this->hard_Y_N.data(), V_N, frame_id);
+		return;
 	}
-	else
+
+	this->_update_generator();
+
+	if (!this->is_linear)
+	{
+		this->_decode_siho_cw_enc(Y_N, V_N);
+		return;
+	}
+
+	// minimizing the Euclidean distance to the BPSK symbols is the same as maximizing the correlation
+	for (auto n = 0; n < this->N; n++)
+		this->Y_N_pad[n] = (float)Y_N[n];
+
+	this->_search(true);
+	this->_store_best(this->best_u[0], V_N);
+}
+
+template <typename B, typename R>
+void Decoder_maximum_likelihood_std<B,R>
+::_decode_hiho(const B *Y_N, B *V_K, const int frame_id)
+{
+	this->_decode_hiho_cw(Y_N, this->best_X_N.data(), frame_id);
+	std::copy(this->best_U_K.begin(), this->best_U_K.end(), V_K);
+}
+
+template <typename B, typename R>
+void Decoder_maximum_likelihood_std<B,R>
+::_decode_hiho_cw(const B *Y_N, B *V_N, const int frame_id)
+{
+	this->_update_generator();
+
+	if (!this->is_linear)
+	{
+		this->_decode_hiho_cw_enc(Y_N, V_N);
+		return;
+	}
+
+	std::fill(this->hard_Y_N_packed.begin(), this->hard_Y_N_packed.end(), (uint64_t)0);
+	for (auto n = 0; n < this->N; n++)
+		this->hard_Y_N_packed[n >> 6] |= (uint64_t)(Y_N[n] != 0) << (n & 63);
+
+	this->_search(false);
+	this->_store_best(this->best_u[0], V_N);
+}
+
+template <typename B, typename R>
+void Decoder_maximum_likelihood_std<B,R>
+::_update_generator()
+{
+	// the generator matrix is computed again when the information bits change (e.g. the frozen bits of the polar codes)
+	const auto &info_bits_pos = this->encoder.get_info_bits_pos();
+	if (info_bits_pos == this->cur_info_bits_pos)
+		return;
+
+	this->cur_info_bits_pos = info_bits_pos;
+
+	// the all zero information word has to give the all zero codeword
+	std::fill(this->U_K.begin(), this->U_K.end(), (B)0);
+	this->encoder.encode(this->U_K.data(), this->X_N.data(), 0);
+	this->is_linear = std::all_of(this->X_N.begin(), this->X_N.begin() + this->N, [](const B x) { return x == 0; });
+
+	std::fill(this->gen_rows .begin(), this->gen_rows .end(), (uint64_t)0);
+	std::fill(this->gen_signs.begin(), this->gen_signs.end(), 0.f);
+	for (auto k = 0; k < this->K; k++)
+	{
+		std::fill(this->U_K.begin(), this->U_K.end(), (B)0);
+		this->U_K[k] = (B)1;
+		this->encoder.encode(this->U_K.data(), this->X_N.data(), 0);
+
+		for (auto n = 0; n < this->N; n++)
+			if (this->X_N[n])
+			{
+				this->gen_rows[k * this->n_words + (n >> 6)] |= (uint64_t)1 << (n & 63);
+				this->gen_signs[k * this->N_pad + n] = -0.f;
+			}
+	}
+
+	// check the linearity of the encoder on a few information words, the encoders which do not depend on the
+	// information bits (e.g. AZCW, USER) are decoded by encoding all the information words
+	const uint64_t patterns[3] = {0x5555555555555555ull, 0xAAAAAAAAAAAAAAAAull, 0x0F0F0F0F0F0F0F0Full};
+	for (auto p = 0; p < 3 && this->is_linear; p++)
+	{
+		const auto u = patterns[p] & this->u_max;
+		for (auto k = 0; k < this->K; k++)
+			this->U_K[k] = (B)((u >> k) & 1);
+		this->encoder.encode(this->U_K.data(), this->X_N.data(), 0);
+
+		auto &c = this->C_N[0];
+		std::fill(c.begin(), c.end(), (uint64_t)0);
+		for (auto k = 0; k < this->K; k++)
+			if ((u >> k) & 1)
+				for (auto w = 0; w < this->n_words; w++)
+					c[w] ^= this->gen_rows[k * this->n_words + w];
+
+		for (auto n = 0; n < this->N; n++)
+			if ((this->X_N[n] != 0) != (bool)((c[n >> 6] >> (n & 63)) & 1))
+				this->is_linear = false;
+	}
+}
+
+template <typename B, typename R>
+void Decoder_maximum_likelihood_std<B,R>
+::_worker(const int tid)
+{
+	uint64_t last_id = 0;
+	while (true)
+	{
+		bool euclidean;
+		{
+			std::unique_lock<std::mutex> lock(this->mutex_search);
+			this->cond_start.wait(lock, [&]() { return this->stop_workers || this->search_id != last_id; });
+			if (this->stop_workers)
+				return;
+			last_id   = this->search_id;
+			euclidean = this->search_euclidean;
+		}
+
+		this->_search_chunks(tid, euclidean);
+
+		{
+			std::lock_guard<std::mutex> lock(this->mutex_search);
+			if (--this->n_running == 0)
+				this->cond_done.notify_one();
+		}
+	}
+}
+
+template <typename B, typename R>
+void Decoder_maximum_likelihood_std<B,R>
+::_search_chunks(const int tid, const bool euclidean)
+{
+	this->best_corr[tid] = -std::numeric_limits<float>::max();
+	this->best_dist[tid] = std::numeric_limits<uint32_t>::max();
+	this->best_u   [tid] = std::numeric_limits<uint64_t>::max();
+
+	// each chunk is enumerated in Gray code order
+	for (auto c = tid; c < this->n_chunks; c += this->n_workers)
+		if (euclidean)
+			this->_search_chunk_euclidean(tid, (uint64_t)c, this->n_low_bits);
+		else
+			this->_search_chunk_hamming(tid, (uint64_t)c, this->n_low_bits);
+}
+
+template <typename B, typename R>
+void Decoder_maximum_likelihood_std<B,R>
+::_search(const bool euclidean)
+{
+	const auto n_workers = this->n_workers;
+
+	if (n_workers > 1)
 	{
-		this->min_euclidean_dist = std::numeric_limits<float>::max();
+		{
+			std::lock_guard<std::mutex> lock(this->mutex_search);
+			this->search_euclidean = euclidean;
+			this->n_running        = n_workers -1;
+			this->search_id++;
+		}
+		this->cond_start.notify_all();
+	}
+
+	this->_search_chunks(0, euclidean);
+
+	if (n_workers > 1)
+	{
+		std::unique_lock<std::mutex> lock(this->mutex_search);
+		this->cond_done.wait(lock, [&]() { return this->n_running == 0; });
+	}
 
-		// for all the possible sequences of information bits
-		for (uint64_t u = 0; u <= this->u_max; u++)
+	// merge the results, the ties are broken in favor of the smallest information word
+	for (auto tid = 1; tid < n_workers; tid++)
+	{
+		const auto better = euclidean ? (this->best_corr[tid] >  this->best_corr[0])
+		                              : (this->best_dist[tid] <  this->best_dist[0]);
+		const auto equal  = euclidean ? (this->best_corr[tid] == this->best_corr[0])
+		                              : (this->best_dist[tid] == this->best_dist[0]);
+
+		if (better || (equal && this->best_u[tid] < this->best_u[0]))
 		{
-			// convert the information bits to the codeword
-			std::fill(this->U_K.begin(), this->U_K.end(), (B)0);
-			auto data = (uint64_t*)this->U_K.data();
-			data[0] = u;
-			tools::Bit_packer<B>::unpack(this->U_K.data(), this->K);
-			this->encoder.encode(this->U_K.data(), this->X_N.data(), 0);
-
-			// compute the Euclidean distance between the input LLR and the current codeword
-			auto cur_euclidean_dist = this->compute_euclidean_dist(this->X_N.data(), Y_N);
-
-			// update the best codeword
-			if (cur_euclidean_dist < this->min_euclidean_dist)
+			this->best_corr[0] = this->best_corr[tid];
+			this->best_dist[0] = this->best_dist[tid];
+			this->best_u   [0] = this->best_u   [tid];
+		}
+	}
+}
+
+template <typename B, typename R>
+void Decoder_maximum_likelihood_std<B,R>
+::_search_chunk_euclidean(const int tid, const uint64_t prefix, const int n_low_bits)
+{
+	constexpr auto n_el = mipp::nElReg<float>();
+	const auto N_pad = this->N_pad;
+	auto Z = this->Z_N[tid].data();
+
+	// multiply the LLRs by the BPSK symbols of the first codeword of the chunk
+	const auto u0 = (n_low_bits == 64) ? (uint64_t)0 : prefix << n_low_bits;
+	std::copy(this->Y_N_pad.begin(), this->Y_N_pad.end(), Z);
+	for (auto k = n_low_bits; k < this->K; k++)
+		if ((u0 >> k) & 1)
+			for (auto n = 0; n < N_pad; n += n_el)
 			{
-				this->min_euclidean_dist = cur_euclidean_dist;
-				std::copy(this->X_N.begin(), this->X_N.begin() + this->N, V_N);
-				std::copy(this->U_K.begin(), this->U_K.begin() + this->K, this->best_U_K.begin());
+				const auto r_z = mipp::Reg<float>(&Z[n]) ^ mipp::Reg<float>(&this->gen_signs[k * N_pad + n]);
+				r_z.store(&Z[n]);
 			}
 
-			// trick to avoid infinite loop when u_max is the max 64-bit unsigned integer
-			if (this->u_max == std::numeric_limits<uint64_t>::max())
-				break;
+	auto &best_corr = this->best_corr[tid];
+	auto &best_u    = this->best_u   [tid];
+
+	auto update = [&](const float corr, const uint64_t u)
+	{
+		if (corr > best_corr || (corr == best_corr && u < best_u))
+		{
+			best_corr = corr;
+			best_u    = u;
 		}
+	};
+
+	mipp::Reg<float> r_acc = 0.f;
+	for (auto n = 0; n < N_pad; n += n_el)
+		r_acc += mipp::Reg<float>(&Z[n]);
+	update(mipp::hadd<float>(r_acc), u0);
+
+	// flip the sign of the symbols of one row and compute the new correlation in the same pass
+	const auto t_max = (n_low_bits == 64) ? std::numeric_limits<uint64_t>::max() : ((uint64_t)1 << n_low_bits) -1;
+	for (uint64_t t = 1; t <= t_max && t != 0; t++)
+	{
+		auto b = 0;
+		while (!((t >> b) & 1))
+			b++;
+
+		const auto signs = this->gen_signs.data() + b * N_pad;
+		r_acc = 0.f;
+		for (auto n = 0; n < N_pad; n += n_el)
+		{
+			const auto r_z = mipp::Reg<float>(&Z[n]) ^ mipp::Reg<float>(&signs[n]);
+			r_z.store(&Z[n]);
+			r_acc += r_z;
+		}
+
+		update(mipp::hadd<float>(r_acc), u0 | (t ^ (t >> 1)));
 	}
 }
 
 template <typename B, typename R>
 void Decoder_maximum_likelihood_std<B,R>
-::_decode_hiho(const B *Y_N, B *V_K, const int frame_id)
+::_search_chunk_hamming(const int tid, const uint64_t prefix, const int n_low_bits)
 {
-	this->_decode_hiho_cw(Y_N, this->best_X_N.data(), frame_id);
-	std::copy(this->best_U_K.begin(), this->best_U_K.end(), V_K);
+	const auto n_words = this->n_words;
+	auto C = this->C_N[tid].data();
+	const auto Y = this->hard_Y_N_packed.data();
+
+	const auto u0 = (n_low_bits == 64) ? (uint64_t)0 : prefix << n_low_bits;
+	std::fill(C, C + n_words, (uint64_t)0);
+	for (auto k = n_low_bits; k < this->K; k++)
+		if ((u0 >> k) & 1)
+			for (auto w = 0; w < n_words; w++)
+				C[w] ^= this->gen_rows[k * n_words + w];
+
+	auto &best_dist = this->best_dist[tid];
+	auto &best_u    = this->best_u   [tid];
+
+	auto update = [&](const uint32_t dist, const uint64_t u)
+	{
+		if (dist < best_dist || (dist == best_dist && u < best_u))
+		{
+			best_dist = dist;
+			best_u    = u;
+		}
+	};
+
+	uint32_t dist = 0;
+	for (auto w = 0; w < n_words; w++)
+		dist += popcount64(C[w] ^ Y[w]);
+	update(dist, u0);
+
+	const auto t_max = (n_low_bits == 64) ? std::numeric_limits<uint64_t>::max() : ((uint64_t)1 << n_low_bits) -1;
+	for (uint64_t t = 1; t <= t_max && t != 0; t++)
+	{
+		auto b = 0;
+		while (!((t >> b) & 1))
+			b++;
+
+		const auto row = this->gen_rows.data() + b * n_words;
+		dist = 0;
+		for (auto w = 0; w < n_words; w++)
+		{
+			C[w] ^= row[w];
+			dist += popcount64(C[w] ^ Y[w]);
+		}
+
+		update(dist, u0 | (t ^ (t >> 1)));
+	}
 }
 
 template <typename B, typename R>
 void Decoder_maximum_likelihood_std<B,R>
-::_decode_hiho_cw(const B *Y_N, B *V_N, const int frame_id)
+::_store_best(const uint64_t u, B *V_N)
+{
+	auto &c = this->C_N[0];
+	std::fill(c.begin(), c.end(), (uint64_t)0);
+	for (auto k = 0; k < this->K; k++)
+	{
+		this->best_U_K[k] = (B)((u >> k) & 1);
+		if ((u >> k) & 1)
+			for (auto w = 0; w < this->n_words; w++)
+				c[w] ^= this->gen_rows[k * this->n_words + w];
+	}
+
+	for (auto n = 0; n < this->N; n++)
+		V_N[n] = (B)((c[n >> 6] >> (n & 63)) & 1);
+}
+
+template <typename B, typename R>
+void Decoder_maximum_likelihood_std<B,R>
+::_decode_siho_cw_enc(const R *Y_N, B *V_N)
+{
+	this->min_euclidean_dist = std::numeric_limits<float>::max();
+
+	// for all the possible sequences of information bits
+	for (uint64_t u = 0; u <= this->u_max; u++)
+	{
+		// convert the information bits to the codeword
+		std::fill(this->U_K.begin(), this->U_K.end(), (B)0);
+		auto data = (uint64_t*)this->U_K.data();
+		data[0] = u;
+		tools::Bit_packer<B>::unpack(this->U_K.data(), this->K);
+		this->encoder.encode(this->U_K.data(), this->X_N.data(), 0);
+
+		// compute the Euclidean distance between the input LLR and the current codeword
+		auto cur_euclidean_dist = this->compute_euclidean_dist(this->X_N.data(), Y_N);
+
+		// update the best codeword
+		if (cur_euclidean_dist < this->min_euclidean_dist)
+		{
+			this->min_euclidean_dist = cur_euclidean_dist;
+			std::copy(this->X_N.begin(), this->X_N.begin() + this->N, V_N);
+			std::copy(this->U_K.begin(), this->U_K.begin() + this->K, this->best_U_K.begin());
+		}
+
+		// trick to avoid infinite loop when u_max is the max 64-bit unsigned integer
+		if (this->u_max == std::numeric_limits<uint64_t>::max())
+			break;
+	}
+}
+
+template <typename B, typename R>
+void Decoder_maximum_likelihood_std<B,R>
+::_decode_hiho_cw_enc(const B *Y_N, B *V_N)
 {
 	this->min_hamming_dist = std::numeric_limits<uint32_t>::max();
 
@@ -1,6 +1,13 @@
 #ifndef DECODER_MAXIMUM_LIKELIHOOD_STD_HPP_
 #define DECODER_MAXIMUM_LIKELIHOOD_STD_HPP_
 
+#include <mutex>
+#include <thread>
+#include <vector>
+#include <cstdint>
+#include <condition_variable>
+#include <mipp.h>
+
 #include "Decoder_maximum_likelihood.hpp"
 
 namespace aff3ct
@@ -12,13 +19,47 @@ class Decoder_maximum_likelihood_std : public Decoder_maximum_likelihood<B,R>
 {
 protected:
 	const bool hamming;
+	const int n_threads;
 	uint64_t u_max;
 	float min_euclidean_dist;
 	uint32_t min_hamming_dist;
 
+	// generator matrix of the code (the rows are the codewords of the unit information words), it is used to
+	// enumerate the codewords in Gray code order: two consecutive codewords only differ by one row
+	const int n_words;                        // number of 64-bit words in a packed row
+	const int N_pad;                          // N rounded to the SIMD register size
+	bool is_linear;
+	std::vector<uint32_t> cur_info_bits_pos;
+	std::vector<uint64_t> gen_rows;           // packed rows (K * n_words)
+	mipp::vector<float> gen_signs;            // rows as sign masks (-0.f when the bit is set, K * N_pad)
+
+	mipp::vector<float> Y_N_pad;              // LLRs converted in float and padded with zeros
+	std::vector<uint64_t> hard_Y_N_packed;
+
+	// buffers of each thread
+	std::vector<mipp::vector<float>> Z_N;     // LLRs multiplied by the BPSK symbols of the current codeword
+	std::vector<std::vector<uint64_t>> C_N;   // current packed codeword
+	std::vector<float> best_corr;
+	std::vector<uint32_t> best_dist;
+	std::vector<uint64_t> best_u;
+
+	// the information words are split in 'n_chunks' chunks explored by 'n_workers' threads: the calling thread and
+	// 'n_workers -1' persistent threads created by the constructor, waiting for a search between two frames
+	int n_chunks;
+	int n_low_bits;
+	int n_workers;
+	std::vector<std::thread> workers;
+	std::mutex mutex_search;
+	std::condition_variable cond_start;
+	std::condition_variable cond_done;
+	uint64_t search_id;
+	int n_running;
+	bool search_euclidean;
+	bool stop_workers;
+
 public:
 	Decoder_maximum_likelihood_std(const int K, const int N, Encoder<B> &encoder, const bool hamming = false,
-	                               const int n_frames = 1);
+	                               const int n_frames = 1, const int n_threads = 1);
 	virtual ~Decoder_maximum_likelihood_std();
 
 protected:
@@ -26,6 +67,18 @@ protected:
 	void _decode_siho_cw(const R *Y_N,  B *V_N, const int frame_id);
 	void _decode_hiho   (const B *Y_N,  B *V_K, const int frame_id);
 	void _decode_hiho_cw(const B *Y_N,  B *V_N, const int frame_id);
+
+private:
+	void _update_generator();
+	void _search(const bool euclidean);
+	void _search_chunks(const int tid, const bool euclidean);
+	void _worker(const int tid);
+	void _search_chunk_euclidean(const int tid, const uint64_t prefix, const int n_low_bits);
+	void _search_chunk_hamming  (const int tid, const uint64_t prefix, const int n_low_bits);
+	void _store_best(const uint64_t u, B *V_N);
+
+	void _decode_siho_cw_enc(const R *Y_N, B *V_N);
+	void _decode_hiho_cw_enc(const B *Y_N, B *V_N);
 };
 
 template <typename B = int, typename R = float>
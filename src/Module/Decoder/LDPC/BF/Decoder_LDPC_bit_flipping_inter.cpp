@@ -0,0 +1,266 @@
+#include <chrono>
+#include <cmath>
+#include <sstream>
+#include <algorithm>
+
+#include "Tools/Exception/exception.hpp"
+#include "Tools/Perf/bit_sliced.h"
+
+#include "Decoder_LDPC_bit_flipping_inter.hpp"
+
+using namespace aff3ct;
+using namespace aff3ct::module;
+
+// maximum number of bit planes of the energy counters
+constexpr int max_planes = 16;
+
+template <typename B, typename R>
+Decoder_LDPC_bit_flipping_inter<B,R>
+::Decoder_LDPC_bit_flipping_inter(const int K, const int N, const int n_ite, const tools::Sparse_matrix &H,
+                                  const std::vector<unsigned> &info_bits_pos, const int n_rel_bits,
+                                  const bool enable_syndrome, const int syndrome_depth, const int n_frames)
+: Decoder               (K, N,                                            n_frames, tools::bs_n_frames<B>()),
+  Decoder_LDPC_BP<B,R>  (K, N, n_ite, H, enable_syndrome, syndrome_depth, n_frames, tools::bs_n_frames<B>()),
+  info_bits_pos         (info_bits_pos                                                                     ),
+  n_rel_bits            (n_rel_bits                                                                        ),
+  cur_rel_bits          (n_rel_bits                                                                        ),
+  HY_N                  (N                      * mipp::nElReg<B>()                                        ),
+  rel                   (N * std::max(n_rel_bits, 1) * mipp::nElReg<B>()                                  ),
+  V_N                   (N                      * mipp::nElReg<B>()                                        ),
+  syndrome              (H.get_n_cols()         * mipp::nElReg<B>()                                        ),
+  done                  (                         mipp::nElReg<B>()                                        ),
+  cur_depths            (tools::bs_n_frames<B>()                                                           )
+{
+	const std::string name = "Decoder_LDPC_bit_flipping_inter";
+	this->set_name(name);
+
+	if (n_rel_bits < 0 || n_rel_bits > 8)
+	{
+		std::stringstream message;
+		message << "'n_rel_bits' has to be between 0 and 8 ('n_rel_bits' = " << n_rel_bits << ").";
+		throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	const auto q        = std::max(n_rel_bits, 1);
+	const auto max_rel  = (1 << q) -1;
+	const auto chk_wght = 1 << (q -1);
+
+	const auto &VN_to_CN = H.get_row_to_cols();
+	for (auto i = 0; i < (int)VN_to_CN.size(); i++)
+	{
+		const auto node_degree = (int)VN_to_CN[i].size();
+		if (tools::bs_n_planes(2 * chk_wght * node_degree + 2 * max_rel) > max_planes)
+		{
+			std::stringstream message;
+			message << "The degree of the variable nodes is too big ('i' = " << i << ", 'node_degree' = "
+			        << node_degree << ", 'n_rel_bits' = " << n_rel_bits << ").";
+			throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+		}
+	}
+}
+
+template <typename B, typename R>
+Decoder_LDPC_bit_flipping_inter<B,R>
+::~Decoder_LDPC_bit_flipping_inter()
+{
+}
+
+template <typename B, typename R>
+void Decoder_LDPC_bit_flipping_inter<B,R>
+::_load(const R *Y_N)
+{
+	constexpr int E = mipp::nElReg<B>();
+	const auto q        = this->n_rel_bits;
+	const auto max_rel  = (1 << q) -1;
+	const auto chk_wght = q ? 1 << (q -1) : 1;
+
+	tools::bs_hard_decide(Y_N, HY_N.data(), this->N);
+
+	// quantize the reliabilities: the mean magnitude of the frame is mapped to the weight of a check
+	std::fill(rel.begin(), rel.end(), (B)0);
+	for (auto f = 0; f < tools::bs_n_frames<B>(); f++)
+	{
+		const auto Y_f = Y_N + f * this->N;
+
+		auto sum = 0.f;
+		for (auto i = 0; i < this->N; i++)
+			sum += std::abs((float)Y_f[i]);
+		const auto factor = (sum > 0.f) ? (float)chk_wght * (float)this->N / sum : 0.f;
+
+		for (auto i = 0; i < this->N; i++)
+		{
+			const auto r = std::min(max_rel, (int)(std::abs((float)Y_f[i]) * factor + 0.5f));
+			for (auto p = 0; p < q; p++)
+				if ((r >> p) & 1)
+					tools::bs_set(&rel[(i * q + p) * E], f);
+		}
+	}
+
+	this->cur_rel_bits = q;
+}
+
+template <typename B, typename R>
+void Decoder_LDPC_bit_flipping_inter<B,R>
+::_decode()
+{
+	constexpr int E = mipp::nElReg<B>();
+	const auto r_zero = mipp::Reg<B>((B)0);
+	const auto r_ones = ~r_zero;
+	const auto &VN_to_CN = this->H.get_row_to_cols();
+	const auto &CN_to_VN = this->H.get_col_to_rows();
+	const auto hard     = this->cur_rel_bits == 0; // all the channel bits have a reliability of 1
+	const auto q        = hard ? 1 : this->cur_rel_bits;
+	const auto max_rel  = (1 << q) -1;
+	const auto chk_wght = 1 << (q -1); // weight of a check in the energy
+	const auto chk_pos  = q;           // bit position of 2 * 'chk_wght' in the energy counters
+
+	std::copy(HY_N.begin(), HY_N.end(), V_N.begin());
+	std::fill(this->done.begin(), this->done.end(), (B)0);
+	std::fill(this->cur_depths.begin(), this->cur_depths.end(), 0);
+
+	for (auto ite = 0; ite < this->n_ite; ite++)
+	{
+		// compute the syndrome (for each check nodes)
+		auto r_unsat = r_zero;
+		for (auto i = 0; i < (int)CN_to_VN.size(); i++)
+		{
+			auto r_syn = r_zero;
+			for (auto j = 0; j < (int)CN_to_VN[i].size(); j++)
+				r_syn ^= mipp::Reg<B>(&V_N[CN_to_VN[i][j] * E]);
+			r_syn.store(&syndrome[i * E]);
+			r_unsat |= r_syn;
+		}
+
+		if (this->enable_syndrome)
+		{
+			B unsat[E];
+			r_unsat.storeu(unsat);
+			if (this->check_syndrome_bit_sliced(unsat, this->done.data(), this->cur_depths))
+				break;
+		}
+
+		// flip the bits of negative energy (for each variable nodes), the energy r * (agree ? 1 : -1) + c * (d - 2u) is
+		// negative when M = 2c * u + (agree ? max_rel - r : max_rel + r) >= c * d + max_rel +1 (c = 'chk_wght')
+		const auto r_done = mipp::Reg<B>(this->done.data());
+		for (auto i = 0; i < this->N; i++)
+		{
+			const auto node_degree = (int)VN_to_CN[i].size();
+			const auto n_planes    = tools::bs_n_planes(2 * chk_wght * node_degree + 2 * max_rel);
+			const auto r_V         = mipp::Reg<B>(&V_N [i * E]);
+			const auto r_dis       = mipp::Reg<B>(&HY_N[i * E]) ^ r_V;
+
+			mipp::Reg<B> planes[max_planes];
+			for (auto p = 0; p < q; p++)
+				planes[p] = (hard ? r_ones : mipp::Reg<B>(&rel[(i * q + p) * E])) ^ ~r_dis;
+			for (auto p = q; p < n_planes; p++)
+				planes[p] = r_zero;
+
+			for (auto p = 0; p < q; p++)
+				tools::bs_add(planes, n_planes, r_dis, p);
+			for (auto j = 0; j < node_degree; j++)
+				tools::bs_add(planes, n_planes, mipp::Reg<B>(&syndrome[VN_to_CN[i][j] * E]), chk_pos);
+
+			const auto threshold = chk_wght * node_degree + max_rel +1;
+			const auto r_flip    = mipp::andnb(r_done, tools::bs_greater_equal(planes, n_planes, threshold));
+			(r_V ^ r_flip).store(&V_N[i * E]);
+		}
+	}
+}
+
+template <typename B, typename R>
+void Decoder_LDPC_bit_flipping_inter<B,R>
+::_decode_hiho(const B *Y_N, B *V_K, const int frame_id)
+{
+//	auto t_load = std::chrono::steady_clock::now();  // ---------------------------------------------------------- LOAD
+	tools::bs_pack(Y_N, HY_N.data(), this->N);
+	this->cur_rel_bits = 0;
+//	auto d_load = std::chrono::steady_clock::now() - t_load;
+
+//	auto t_decod = std::chrono::steady_clock::now(); // -------------------------------------------------------- DECODE
+	this->_decode();
+//	auto d_decod = std::chrono::steady_clock::now() - t_decod;
+
+//	auto t_store = std::chrono::steady_clock::now(); // --------------------------------------------------------- STORE
+	tools::bs_unpack(V_N.data(), V_K, info_bits_pos.data(), this->K);
+//	auto d_store = std::chrono::steady_clock::now() - t_store;
+
+//	(*this)[dec::tsk::decode_hiho].update_timer(dec::tm::decode_hiho::load,   d_load);
+//	(*this)[dec::tsk::decode_hiho].update_timer(dec::tm::decode_hiho::decode, d_decod);
+//	(*this)[dec::tsk::decode_hiho].update_timer(dec::tm::decode_hiho::store,  d_store);
+}
+
+template <typename B, typename R>
+void Decoder_LDPC_bit_flipping_inter<B,R>
+::_decode_hiho_cw(const B *Y_N, B *V_N, const int frame_id)
+{
+//	auto t_load = std::chrono::steady_clock::now();  // ---------------------------------------------------------- LOAD
+	tools::bs_pack(Y_N, HY_N.data(), this->N);
+	this->cur_rel_bits = 0;
+//	auto d_load = std::chrono::steady_clock::now() - t_load;
+
+//	auto t_decod = std::chrono::steady_clock::now(); // -------------------------------------------------------- DECODE
+	this->_decode();
+//	auto d_decod = std::chrono::steady_clock::now() - t_decod;
+
+//	auto t_store = std::chrono::steady_clock::now(); // --------------------------------------------------------- STORE
+	tools::bs_unpack(this->V_N.data(), V_N, this->N);
+//	auto d_store = std::chrono::steady_clock::now() - t_store;
+
+//	(*this)[dec::tsk::decode_hiho_cw].update_timer(dec::tm::decode_hiho_cw::load,   d_load);
+//	(*this)[dec::tsk::decode_hiho_cw].update_timer(dec::tm::decode_hiho_cw::decode, d_decod);
+//	(*this)[dec::tsk::decode_hiho_cw].update_timer(dec::tm::decode_hiho_cw::store,  d_store);
+}
+
+template <typename B, typename R>
+void Decoder_LDPC_bit_flipping_inter<B,R>
+::_decode_siho(const R *Y_N, B *V_K, const int frame_id)
+{
+//	auto t_load = std::chrono::steady_clock::now();  // ---------------------------------------------------------- LOAD
+	this->_load(Y_N);
+//	auto d_load = std::chrono::steady_clock::now() - t_load;
+
+//	auto t_decod = std::chrono::steady_clock::now(); // -------------------------------------------------------- DECODE
+	this->_decode();
+//	auto d_decod = std::chrono::steady_clock::now() - t_decod;
+
+//	auto t_store = std::chrono::steady_clock::now(); // --------------------------------------------------------- STORE
+	tools::bs_unpack(V_N.data(), V_K, info_bits_pos.data(), this->K);
+//	auto d_store = std::chrono::steady_clock::now() - t_store;
+
+//	(*this)[dec::tsk::decode_siho].update_timer(dec::tm::decode_siho::load,   d_load);
+//	(*this)[dec::tsk::decode_siho].update_timer(dec::tm::decode_siho::decode, d_decod);
+//	(*this)[dec::tsk::decode_siho].update_timer(dec::tm::decode_siho::store,  d_store);
+}
+
+template <typename B, typename R>
+void Decoder_LDPC_bit_flipping_inter<B,R>
+::_decode_siho_cw(const R *Y_N, B *V_N, const int frame_id)
+{
+//	auto t_load = std::chrono::steady_clock::now();  // ---------------------------------------------------------- LOAD
+	this->_load(Y_N);
+//	auto d_load = std::chrono::steady_clock::now() - t_load;
+
+//	auto t_decod = std::chrono::steady_clock::now(); // -------------------------------------------------------- DECODE
+	this->_decode();
+//	auto d_decod = std::chrono::steady_clock::now() - t_decod;
+
+//	auto t_store = std::chrono::steady_clock::now(); // --------------------------------------------------------- STORE
+	tools::bs_unpack(this->V_N.data(), V_N, this->N);
+//	auto d_store = std::chrono::steady_clock::now() - t_store;
+
+//	(*this)[dec::tsk::decode_siho_cw].update_timer(dec::tm::decode_siho_cw::load,   d_load);
+//	(*this)[dec::tsk::decode_siho_cw].update_timer(dec::tm::decode_siho_cw::decode, d_decod);
+//	(*this)[dec::tsk::decode_siho_cw].update_timer(dec::tm::decode_siho_cw::store,  d_store);
+}
+
+// ==================================================================================== explicit template instantiation
+#include "Tools/types.h"
+#ifdef MULTI_PREC
+template class aff3ct::module::Decoder_LDPC_bit_flipping_inter<B_8,Q_8>;
+template class aff3ct::module::Decoder_LDPC_bit_flipping_inter<B_16,Q_16>;
+template class aff3ct::module::Decoder_LDPC_bit_flipping_inter<B_32,Q_32>;
+template class aff3ct::module::Decoder_LDPC_bit_flipping_inter<B_64,Q_64>;
+#else
+template class aff3ct::module::Decoder_LDPC_bit_flipping_inter<B,Q>;
+#endif
+// ==================================================================================== explicit template instantiation
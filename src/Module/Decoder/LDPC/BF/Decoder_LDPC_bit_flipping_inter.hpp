@@ -0,0 +1,68 @@
+#ifndef DECODER_LDPC_BIT_FLIPPING_INTER_HPP_
+#define DECODER_LDPC_BIT_FLIPPING_INTER_HPP_
+
+#include <vector>
+#include <mipp.h>
+
+#include "Tools/Algo/Sparse_matrix/Sparse_matrix.hpp"
+
+#include "Module/Decoder/LDPC/BP/Decoder_LDPC_BP.hpp"
+
+namespace aff3ct
+{
+namespace module
+{
+/*!
+ * \class Decoder_LDPC_bit_flipping_inter
+ *
+ * \brief Weighted gradient descent bit-flipping decoder of 'tools::bs_n_frames<B>()' frames at once (bit-sliced).
+ *
+ * The decided bits, the syndrome and the channel reliabilities are stored one bit per frame: a register stores the same
+ * bit of 'mipp::RegisterSizeBit' frames (see 'Tools/Perf/bit_sliced.h'). The reliability 'r' of a channel bit is the
+ * magnitude of its LLR quantized on 'n_rel_bits' bits, the mean magnitude of the frame being quantized to the weight
+ * 'c' = 2^('n_rel_bits' -1) of a check. At each iteration, all the bits of negative energy are flipped in parallel,
+ * the energy of a bit 'x' of degree 'd' is:
+ *   r * (x == channel bit ? 1 : -1) + c * (d - 2 * (number of unsatisfied checks of x)).
+ * The energies are computed with bit-sliced counters. With 'n_rel_bits' = 0 (and in hard input decoding) all the
+ * channel bits have a reliability of 1 ('r' = 'c' = 1): a bit is flipped when a strict majority of its checks are
+ * unsatisfied (Gallager bit-flipping) and the channel bit breaks the ties. Without this term, the neighbour bits are
+ * flipped back and forth at each iteration.
+ *
+ * The stop criterion is evaluated per frame: the bits of a frame are frozen once its syndrome is validated and the
+ * decoding stops when all the frames are validated.
+ */
+template <typename B = int, typename R = float>
+class Decoder_LDPC_bit_flipping_inter : public Decoder_LDPC_BP<B,R>
+{
+protected:
+	const std::vector<unsigned> &info_bits_pos;
+	const int                    n_rel_bits;
+	      int                    cur_rel_bits; // 'n_rel_bits' in soft input decoding, 0 in hard input decoding
+	mipp::vector<B>              HY_N;         // channel bits (bit-sliced frames)
+	mipp::vector<B>              rel;          // bit planes of the channel reliabilities (bit-sliced frames)
+	mipp::vector<B>              V_N;          // decided bits (bit-sliced frames)
+	mipp::vector<B>              syndrome;     // unsatisfied checks (bit-sliced frames)
+	mipp::vector<B>              done;         // frames for which the syndrome has been validated
+	std::vector<int>             cur_depths;   // syndrome depth of each frame
+
+public:
+	Decoder_LDPC_bit_flipping_inter(const int K, const int N, const int n_ite, const tools::Sparse_matrix &H,
+	                                const std::vector<unsigned> &info_bits_pos,
+	                                const int n_rel_bits = 2,
+	                                const bool enable_syndrome = true,
+	                                const int syndrome_depth = 1,
+	                                const int n_frames = 1);
+	virtual ~Decoder_LDPC_bit_flipping_inter();
+
+protected:
+	void _load          (const R *Y_N                            );
+	void _decode        (                                        );
+	void _decode_hiho   (const B *Y_N, B *V_K, const int frame_id);
+	void _decode_hiho_cw(const B *Y_N, B *V_N, const int frame_id);
+	void _decode_siho   (const R *Y_N, B *V_K, const int frame_id);
+	void _decode_siho_cw(const R *Y_N, B *V_N, const int frame_id);
+};
+}
+}
+
+#endif /* DECODER_LDPC_BIT_FLIPPING_INTER_HPP_ */
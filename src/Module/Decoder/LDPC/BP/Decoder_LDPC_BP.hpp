@@ -1,7 +1,10 @@
 #ifndef DECODER_LDPC_BP_HPP_
 #define DECODER_LDPC_BP_HPP_
 
+#include <vector>
+
 #include "Tools/Algo/Sparse_matrix/Sparse_matrix.hpp"
+#include "Tools/Perf/bit_sliced.h"
 
 #include "../../Decoder_SISO_SIHO.hpp"
 
@@ -94,6 +97,35 @@ public:
 
 		return false;
 	}
+
+	// bit-sliced frames (see 'Tools/Perf/bit_sliced.h'): 'unsat' flags the frames with at least one unsatisfied check,
+	// the frames which validate the syndrome 'syndrome_depth' times in a row are added to 'done' (one depth per frame),
+	// returns true when all the frames are done
+	template <typename T>
+	bool check_syndrome_bit_sliced(const T* unsat, T* done, std::vector<int> &cur_depths)
+	{
+		if (this->enable_syndrome)
+		{
+			auto all_done = true;
+			for (auto f = 0; f < tools::bs_n_frames<T>(); f++)
+			{
+				if (tools::bs_get(done, f))
+					continue;
+
+				const auto syndrome = tools::bs_get(unsat, f);
+				cur_depths[f] = (syndrome == 0) ? (cur_depths[f] +1) % this->syndrome_depth : 0;
+
+				if ((syndrome == 0) && (cur_depths[f] == 0))
+					tools::bs_set(done, f);
+				else
+					all_done = false;
+			}
+
+			return all_done;
+		}
+
+		return false;
+	}
 };
 }
 }
@@ -83,7 +83,8 @@ void Decoder_LDPC_BP_flooding_Gallager_A<B,R>
 
 			for (auto j = 0; j < node_degree; j++)
 			{
-				auto cur_state = Y_N[i];
+				// the hard decisions can be 0/1 or 0/-1 (vectorized hard_decide): the messages are kept in 0/1
+				auto cur_state = (int8_t)(Y_N[i] != 0);
 				if (ite > 0)
 				{
 					auto count = 0;
@@ -0,0 +1,310 @@
+#include <chrono>
+#include <sstream>
+#include <algorithm>
+
+#include "Tools/Exception/exception.hpp"
+#include "Tools/Perf/bit_sliced.h"
+
+#include "Decoder_LDPC_BP_flooding_Gallager_inter.hpp"
+
+using namespace aff3ct;
+using namespace aff3ct::module;
+
+// maximum number of bit planes of the counters in the variable nodes
+constexpr int max_planes = 16;
+
+template <typename B, typename R>
+Decoder_LDPC_BP_flooding_Gallager_inter<B,R>
+::Decoder_LDPC_BP_flooding_Gallager_inter(const int K, const int N, const int n_ite, const tools::Sparse_matrix &H,
+                                          const std::vector<unsigned> &info_bits_pos, const bool gallager_b,
+                                          const bool enable_syndrome, const int syndrome_depth, const int n_frames)
+: Decoder               (K, N,                                            n_frames, tools::bs_n_frames<B>()),
+  Decoder_LDPC_BP<B,R>  (K, N, n_ite, H, enable_syndrome, syndrome_depth, n_frames, tools::bs_n_frames<B>()),
+  info_bits_pos         (info_bits_pos                                                                     ),
+  gallager_b            (gallager_b                                                                        ),
+  transpose             (H.get_n_connections()                                                             ),
+  thresholds            (N                                                                                 ),
+  HY_N                  (N                      * mipp::nElReg<B>()                                        ),
+  V_N                   (N                      * mipp::nElReg<B>()                                        ),
+  C_to_V_messages       (H.get_n_connections()  * mipp::nElReg<B>(), (B)0                                  ),
+  V_to_C_messages       (H.get_n_connections()  * mipp::nElReg<B>(), (B)0                                  ),
+  done                  (                         mipp::nElReg<B>()                                        ),
+  cur_depths            (tools::bs_n_frames<B>()                                                           )
+{
+	const std::string name = "Decoder_LDPC_BP_flooding_Gallager_inter";
+	this->set_name(name);
+
+	const auto &CN_to_VN = H.get_col_to_rows();
+	const auto &VN_to_CN = H.get_row_to_cols();
+
+	for (auto i = 0; i < (int)VN_to_CN.size(); i++)
+	{
+		const auto node_degree = (int)VN_to_CN[i].size();
+
+		if (tools::bs_n_planes(node_degree +1) > max_planes)
+		{
+			std::stringstream message;
+			message << "The degree of the variable nodes has to be smaller than " << ((1 << max_planes) -1)
+			        << " ('i' = " << i << ", 'node_degree' = " << node_degree << ").";
+			throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+		}
+
+		thresholds[i] = gallager_b ? (node_degree -1) / 2 +1 : node_degree -1;
+	}
+
+	std::vector<unsigned> offsets(VN_to_CN.size(), 0);
+	for (auto i = 1; i < (int)VN_to_CN.size(); i++)
+		offsets[i] = offsets[i -1] + (unsigned)VN_to_CN[i -1].size();
+
+	std::vector<unsigned> connections(VN_to_CN.size(), 0);
+	auto k = 0;
+	for (auto i = 0; i < (int)CN_to_VN.size(); i++)
+		for (auto j = 0; j < (int)CN_to_VN[i].size(); j++)
+		{
+			const auto id_V = CN_to_VN[i][j];
+			transpose[k++] = offsets[id_V] + connections[id_V]++;
+		}
+}
+
+template <typename B, typename R>
+Decoder_LDPC_BP_flooding_Gallager_inter<B,R>
+::~Decoder_LDPC_BP_flooding_Gallager_inter()
+{
+}
+
+template <typename B, typename R>
+void Decoder_LDPC_BP_flooding_Gallager_inter<B,R>
+::_decode()
+{
+	constexpr int E = mipp::nElReg<B>();
+	const auto r_zero = mipp::Reg<B>((B)0);
+	const auto &VN_to_CN = this->H.get_row_to_cols();
+	const auto &CN_to_VN = this->H.get_col_to_rows();
+
+	std::fill(this->done.begin(), this->done.end(), (B)0);
+	std::fill(this->cur_depths.begin(), this->cur_depths.end(), 0);
+
+	for (auto ite = 0; ite < this->n_ite; ite++)
+	{
+		auto C_to_V_mess_ptr = C_to_V_messages.data();
+		auto V_to_C_mess_ptr = V_to_C_messages.data();
+
+		// V -> C (for each variable nodes)
+		for (auto i = 0; i < this->N; i++)
+		{
+			const auto node_degree = (int)VN_to_CN[i].size();
+			const auto r_Y = mipp::Reg<B>(&HY_N[i * E]);
+
+			if (ite == 0)
+			{
+				for (auto j = 0; j < node_degree; j++)
+					r_Y.store(&V_to_C_mess_ptr[j * E]);
+			}
+			else
+			{
+				// count the incoming messages which disagree with the channel
+				const auto n_planes = tools::bs_n_planes(node_degree);
+				mipp::Reg<B> planes[max_planes];
+				for (auto p = 0; p < n_planes; p++)
+					planes[p] = r_zero;
+				for (auto j = 0; j < node_degree; j++)
+					tools::bs_add(planes, n_planes, mipp::Reg<B>(&C_to_V_mess_ptr[j * E]) ^ r_Y);
+
+				// the message 'j' is excluded from its own count
+				const auto r_ge  = tools::bs_greater_equal(planes, n_planes, thresholds[i]    );
+				const auto r_ge1 = tools::bs_greater_equal(planes, n_planes, thresholds[i] +1);
+				for (auto j = 0; j < node_degree; j++)
+				{
+					const auto r_dis  = mipp::Reg<B>(&C_to_V_mess_ptr[j * E]) ^ r_Y;
+					const auto r_flip = (r_dis & r_ge1) | mipp::andnb(r_dis, r_ge);
+					(r_Y ^ r_flip).store(&V_to_C_mess_ptr[j * E]);
+				}
+			}
+
+			C_to_V_mess_ptr += node_degree * E; // jump to the next node
+			V_to_C_mess_ptr += node_degree * E; // jump to the next node
+		}
+
+		// C -> V (for each check nodes)
+		auto transpose_ptr = this->transpose.data();
+		for (auto i = 0; i < (int)CN_to_VN.size(); i++)
+		{
+			const auto node_degree = (int)CN_to_VN[i].size();
+
+			// accumulate the incoming information in CN
+			auto r_acc = r_zero;
+			for (auto j = 0; j < node_degree; j++)
+				r_acc ^= mipp::Reg<B>(&V_to_C_messages[transpose_ptr[j] * E]);
+
+			// regenerate the CN outcoming values
+			for (auto j = 0; j < node_degree; j++)
+			{
+				const auto r_out = r_acc ^ mipp::Reg<B>(&V_to_C_messages[transpose_ptr[j] * E]);
+				r_out.store(&C_to_V_messages[transpose_ptr[j] * E]);
+			}
+
+			transpose_ptr += node_degree; // jump to the next node
+		}
+
+		if (this->enable_syndrome && ite != this->n_ite -1)
+		{
+			this->decide();
+			if (this->check_syndrome())
+				break;
+		}
+	}
+
+	this->decide();
+}
+
+template <typename B, typename R>
+void Decoder_LDPC_BP_flooding_Gallager_inter<B,R>
+::decide()
+{
+	constexpr int E = mipp::nElReg<B>();
+	const auto r_zero = mipp::Reg<B>((B)0);
+	const auto r_done = mipp::Reg<B>(this->done.data());
+	const auto &VN_to_CN = this->H.get_row_to_cols();
+
+	auto C_to_V_ptr = C_to_V_messages.data();
+	// for the N variable nodes (make a majority vote with the entering messages)
+	for (auto i = 0; i < this->N; i++)
+	{
+		const auto node_degree = (int)VN_to_CN[i].size();
+		const auto n_votes     = node_degree + ((node_degree % 2 == 0) ? 1 : 0);
+		const auto n_planes    = tools::bs_n_planes(n_votes);
+
+		mipp::Reg<B> planes[max_planes];
+		for (auto p = 0; p < n_planes; p++)
+			planes[p] = r_zero;
+		for (auto j = 0; j < node_degree; j++)
+			tools::bs_add(planes, n_planes, mipp::Reg<B>(&C_to_V_ptr[j * E]));
+		if (node_degree % 2 == 0)
+			tools::bs_add(planes, n_planes, mipp::Reg<B>(&HY_N[i * E]));
+
+		// take the hard decision (the bits of the validated frames are not modified)
+		const auto r_dec = tools::bs_greater_equal(planes, n_planes, n_votes / 2 +1);
+		const auto r_V   = (r_done & mipp::Reg<B>(&V_N[i * E])) | mipp::andnb(r_done, r_dec);
+		r_V.store(&V_N[i * E]);
+
+		C_to_V_ptr += node_degree * E; // jump to the next node
+	}
+}
+
+template <typename B, typename R>
+bool Decoder_LDPC_BP_flooding_Gallager_inter<B,R>
+::check_syndrome()
+{
+	constexpr int E = mipp::nElReg<B>();
+	const auto &CN_to_VN = this->H.get_col_to_rows();
+
+	auto r_unsat = mipp::Reg<B>((B)0);
+	for (auto i = 0; i < (int)CN_to_VN.size(); i++)
+	{
+		auto r_syn = mipp::Reg<B>((B)0);
+		for (auto j = 0; j < (int)CN_to_VN[i].size(); j++)
+			r_syn ^= mipp::Reg<B>(&V_N[CN_to_VN[i][j] * E]);
+		r_unsat |= r_syn;
+	}
+
+	B unsat[E];
+	r_unsat.storeu(unsat);
+
+	return this->check_syndrome_bit_sliced(unsat, this->done.data(), this->cur_depths);
+}
+
+template <typename B, typename R>
+void Decoder_LDPC_BP_flooding_Gallager_inter<B,R>
+::_decode_hiho(const B *Y_N, B *V_K, const int frame_id)
+{
+//	auto t_load = std::chrono::steady_clock::now();  // ---------------------------------------------------------- LOAD
+	tools::bs_pack(Y_N, HY_N.data(), this->N);
+//	auto d_load = std::chrono::steady_clock::now() - t_load;
+
+//	auto t_decod = std::chrono::steady_clock::now(); // -------------------------------------------------------- DECODE
+	this->_decode();
+//	auto d_decod = std::chrono::steady_clock::now() - t_decod;
+
+//	auto t_store = std::chrono::steady_clock::now(); // --------------------------------------------------------- STORE
+	tools::bs_unpack(V_N.data(), V_K, info_bits_pos.data(), this->K);
+//	auto d_store = std::chrono::steady_clock::now() - t_store;
+
+//	(*this)[dec::tsk::decode_hiho].update_timer(dec::tm::decode_hiho::load,   d_load);
+//	(*this)[dec::tsk::decode_hiho].update_timer(dec::tm::decode_hiho::decode, d_decod);
+//	(*this)[dec::tsk::decode_hiho].update_timer(dec::tm::decode_hiho::store,  d_store);
+}
+
+template <typename B, typename R>
+void Decoder_LDPC_BP_flooding_Gallager_inter<B,R>
+::_decode_hiho_cw(const B *Y_N, B *V_N, const int frame_id)
+{
+//	auto t_load = std::chrono::steady_clock::now();  // ---------------------------------------------------------- LOAD
+	tools::bs_pack(Y_N, HY_N.data(), this->N);
+//	auto d_load = std::chrono::steady_clock::now() - t_load;
+
+//	auto t_decod = std::chrono::steady_clock::now(); // -------------------------------------------------------- DECODE
+	this->_decode();
+//	auto d_decod = std::chrono::steady_clock::now() - t_decod;
+
+//	auto t_store = std::chrono::steady_clock::now(); // --------------------------------------------------------- STORE
+	tools::bs_unpack(this->V_N.data(), V_N, this->N);
+//	auto d_store = std::chrono::steady_clock::now() - t_store;
+
+//	(*this)[dec::tsk::decode_hiho_cw].update_timer(dec::tm::decode_hiho_cw::load,   d_load);
+//	(*this)[dec::tsk::decode_hiho_cw].update_timer(dec::tm::decode_hiho_cw::decode, d_decod);
+//	(*this)[dec::tsk::decode_hiho_cw].update_timer(dec::tm::decode_hiho_cw::store,  d_store);
+}
+
+template <typename B, typename R>
+void Decoder_LDPC_BP_flooding_Gallager_inter<B,R>
+::_decode_siho(const R *Y_N, B *V_K, const int frame_id)
+{
+//	auto t_load = std::chrono::steady_clock::now();  // ---------------------------------------------------------- LOAD
+	tools::bs_hard_decide(Y_N, HY_N.data(), this->N);
+//	auto d_load = std::chrono::steady_clock::now() - t_load;
+
+//	auto t_decod = std::chrono::steady_clock::now(); // -------------------------------------------------------- DECODE
+	this->_decode();
+//	auto d_decod = std::chrono::steady_clock::now() - t_decod;
+
+//	auto t_store = std::chrono::steady_clock::now(); // --------------------------------------------------------- STORE
+	tools::bs_unpack(V_N.data(), V_K, info_bits_pos.data(), this->K);
+//	auto d_store = std::chrono::steady_clock::now() - t_store;
+
+//	(*this)[dec::tsk::decode_siho].update_timer(dec::tm::decode_siho::load,   d_load);
+//	(*this)[dec::tsk::decode_siho].update_timer(dec::tm::decode_siho::decode, d_decod);
+//	(*this)[dec::tsk::decode_siho].update_timer(dec::tm::decode_siho::store,  d_store);
+}
+
+template <typename B, typename R>
+void Decoder_LDPC_BP_flooding_Gallager_inter<B,R>
+::_decode_siho_cw(const R *Y_N, B *V_N, const int frame_id)
+{
+//	auto t_load = std::chrono::steady_clock::now();  // ---------------------------------------------------------- LOAD
+	tools::bs_hard_decide(Y_N, HY_N.data(), this->N);
+//	auto d_load = std::chrono::steady_clock::now() - t_load;
+
+//	auto t_decod = std::chrono::steady_clock::now(); // -------------------------------------------------------- DECODE
+	this->_decode();
+//	auto d_decod = std::chrono::steady_clock::now() - t_decod;
+
+//	auto t_store = std::chrono::steady_clock::now(); // --------------------------------------------------------- STORE
+	tools::bs_unpack(this->V_N.data(), V_N, this->N);
+//	auto d_store = std::chrono::steady_clock::now() - t_store;
+
+//	(*this)[dec::tsk::decode_siho_cw].update_timer(dec::tm::decode_siho_cw::load,   d_load);
+//	(*this)[dec::tsk::decode_siho_cw].update_timer(dec::tm::decode_siho_cw::decode, d_decod);
+//	(*this)[dec::tsk::decode_siho_cw].update_timer(dec::tm::decode_siho_cw::store,  d_store);
+}
+
+// ==================================================================================== explicit template instantiation
+#include "Tools/types.h"
+#ifdef MULTI_PREC
+template class aff3ct::module::Decoder_LDPC_BP_flooding_Gallager_inter<B_8,Q_8>;
+template class aff3ct::module::Decoder_LDPC_BP_flooding_Gallager_inter<B_16,Q_16>;
+template class aff3ct::module::Decoder_LDPC_BP_flooding_Gallager_inter<B_32,Q_32>;
+template class aff3ct::module::Decoder_LDPC_BP_flooding_Gallager_inter<B_64,Q_64>;
+#else
+template class aff3ct::module::Decoder_LDPC_BP_flooding_Gallager_inter<B,Q>;
+#endif
+// ==================================================================================== explicit template instantiation
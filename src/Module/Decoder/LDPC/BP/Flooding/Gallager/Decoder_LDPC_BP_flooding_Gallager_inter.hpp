@@ -0,0 +1,66 @@
+#ifndef DECODER_LDPC_BP_FLOODING_GALLAGER_INTER_HPP_
+#define DECODER_LDPC_BP_FLOODING_GALLAGER_INTER_HPP_
+
+#include <vector>
+#include <mipp.h>
+
+#include "Tools/Algo/Sparse_matrix/Sparse_matrix.hpp"
+
+#include "Module/Decoder/LDPC/BP/Decoder_LDPC_BP.hpp"
+
+namespace aff3ct
+{
+namespace module
+{
+/*!
+ * \class Decoder_LDPC_BP_flooding_Gallager_inter
+ *
+ * \brief Gallager A/B hard decision decoder of 'tools::bs_n_frames<B>()' frames at once (bit-sliced).
+ *
+ * Each message is one bit per frame: a register stores the same message of 'mipp::RegisterSizeBit' frames (see
+ * 'Tools/Perf/bit_sliced.h'). The check nodes are XORs, the variable nodes count the disagreeing incoming messages
+ * with bit-sliced counters: a variable node sends the opposite of its channel bit when at least 'b' of the other
+ * incoming messages disagree with it, 'b' = d -1 for Gallager A (same decoding as the Decoder_LDPC_BP_flooding_GALA) and
+ * 'b' = floor((d -1) / 2) +1 for Gallager B (majority of the other messages), 'd' being the variable node degree.
+ *
+ * The stop criterion is evaluated per frame: the decided bits of a frame are frozen once its syndrome is validated and
+ * the decoding stops when all the frames are validated.
+ */
+template <typename B = int, typename R = float>
+class Decoder_LDPC_BP_flooding_Gallager_inter : public Decoder_LDPC_BP<B,R>
+{
+protected:
+	const std::vector<unsigned> &info_bits_pos;
+	const bool                   gallager_b;
+	std::vector<unsigned>        transpose;
+	std::vector<int>             thresholds;      // flipping threshold of each variable node
+	mipp::vector<B>              HY_N;            // channel bits (bit-sliced frames)
+	mipp::vector<B>              V_N;             // decided bits (bit-sliced frames)
+	mipp::vector<B>              C_to_V_messages; // check    nodes to variable nodes messages
+	mipp::vector<B>              V_to_C_messages; // variable nodes to check    nodes messages
+	mipp::vector<B>              done;            // frames for which the syndrome has been validated
+	std::vector<int>             cur_depths;      // syndrome depth of each frame
+
+public:
+	Decoder_LDPC_BP_flooding_Gallager_inter(const int K, const int N, const int n_ite, const tools::Sparse_matrix &H,
+	                                        const std::vector<unsigned> &info_bits_pos,
+	                                        const bool gallager_b = false,
+	                                        const bool enable_syndrome = true,
+	                                        const int syndrome_depth = 1,
+	                                        const int n_frames = 1);
+	virtual ~Decoder_LDPC_BP_flooding_Gallager_inter();
+
+protected:
+	void _decode        (                                        );
+	void _decode_hiho   (const B *Y_N, B *V_K, const int frame_id);
+	void _decode_hiho_cw(const B *Y_N, B *V_N, const int frame_id);
+	void _decode_siho   (const R *Y_N, B *V_K, const int frame_id);
+	void _decode_siho_cw(const R *Y_N, B *V_N, const int frame_id);
+
+	void decide       ();
+	bool check_syndrome();
+};
+}
+}
+
+#endif /* DECODER_LDPC_BP_FLOODING_GALLAGER_INTER_HPP_ */
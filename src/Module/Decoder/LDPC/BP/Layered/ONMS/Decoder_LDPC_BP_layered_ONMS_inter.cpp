@@ -13,6 +13,99 @@
 using namespace aff3ct;
 using namespace aff3ct::module;
 
+// --------------------------------------------------------------------------------------------------------------------
+// --------------------------------------------------------------------------------------------------------- SIMD TOOLS
+
+//                                                                                                           saturation
+template <typename R>
+inline mipp::Reg<R> simd_sat(const mipp::Reg<R> val, const R saturation)
+{
+	return val;
+}
+template <>
+inline mipp::Reg<short> simd_sat(const mipp::Reg<short> v, const short s)
+{
+	return mipp::sat(v, (short)-s, (short)+s);
+}
+template <>
+inline mipp::Reg<signed char> simd_sat(const mipp::Reg<signed char> v, const signed char s)
+{
+	return mipp::sat(v, (signed char)-s, (signed char)+s);
+}
+
+//                                                                                               saturated add and sub
+// in fixed-point the results are saturated to [-max, +max] instead of wrapping around (the range stays symmetric so
+// 'abs' and the negation can't overflow), an overflow is detected on the signs of the operands and of the result
+template <typename R>
+inline mipp::Reg<R> simd_adds(const mipp::Reg<R> a, const mipp::Reg<R> b)
+{
+	return a + b;
+}
+template <typename R>
+inline mipp::Reg<R> simd_subs(const mipp::Reg<R> a, const mipp::Reg<R> b)
+{
+	return a - b;
+}
+template <typename R>
+inline mipp::Reg<R> simd_sat_ovf(const mipp::Reg<R> a, const mipp::Reg<R> res, const mipp::Reg<R> ovf)
+{
+	const auto p_max = mipp::Reg<R>( std::numeric_limits<R>::max());
+	const auto n_max = mipp::Reg<R>(-std::numeric_limits<R>::max());
+	const auto bound = mipp::blend(n_max, p_max, mipp::sign(a));
+	return mipp::blend(bound, mipp::max(res, n_max), mipp::sign(ovf));
+}
+template <>
+inline mipp::Reg<short> simd_adds(const mipp::Reg<short> a, const mipp::Reg<short> b)
+{
+	const auto res = a + b; // overflow if the operands have the same sign and the result has not
+	return simd_sat_ovf(a, res, mipp::andnb(a ^ b, a ^ res));
+}
+template <>
+inline mipp::Reg<short> simd_subs(const mipp::Reg<short> a, const mipp::Reg<short> b)
+{
+	const auto res = a - b; // overflow if the operands have different signs and the result has not the sign of 'a'
+	return simd_sat_ovf(a, res, (a ^ b) & (a ^ res));
+}
+template <>
+inline mipp::Reg<signed char> simd_adds(const mipp::Reg<signed char> a, const mipp::Reg<signed char> b)
+{
+	const auto res = a + b;
+	return simd_sat_ovf(a, res, mipp::andnb(a ^ b, a ^ res));
+}
+template <>
+inline mipp::Reg<signed char> simd_subs(const mipp::Reg<signed char> a, const mipp::Reg<signed char> b)
+{
+	const auto res = a - b;
+	return simd_sat_ovf(a, res, (a ^ b) & (a ^ res));
+}
+
+//                                                                                                        normalization
+template <typename R, int F = 0> inline mipp::Reg<R> simd_normalize(const mipp::Reg<R> val, const float factor)
+{
+	return val * mipp::Reg<R>((R)factor);
+}
+template <> inline mipp::Reg<short      > simd_normalize<short      ,1>(const mipp::Reg<short      > v, const float f) { return (v >> 3);                        } // v * 0.125
+template <> inline mipp::Reg<short      > simd_normalize<short      ,2>(const mipp::Reg<short      > v, const float f) { return            (v >> 2);             } // v * 0.250
+template <> inline mipp::Reg<short      > simd_normalize<short      ,3>(const mipp::Reg<short      > v, const float f) { return (v >> 3) + (v >> 2);             } // v * 0.375
+template <> inline mipp::Reg<short      > simd_normalize<short      ,4>(const mipp::Reg<short      > v, const float f) { return                       (v >> 1);  } // v * 0.500
+template <> inline mipp::Reg<short      > simd_normalize<short      ,5>(const mipp::Reg<short      > v, const float f) { return (v >> 3) +            (v >> 1);  } // v * 0.625
+template <> inline mipp::Reg<short      > simd_normalize<short      ,6>(const mipp::Reg<short      > v, const float f) { return            (v >> 2) + (v >> 1);  } // v * 0.750
+template <> inline mipp::Reg<short      > simd_normalize<short      ,7>(const mipp::Reg<short      > v, const float f) { return (v >> 3) + (v >> 2) + (v >> 1);  } // v * 0.825
+template <> inline mipp::Reg<short      > simd_normalize<short      ,8>(const mipp::Reg<short      > v, const float f) { return v;                               } // v * 1.000
+template <> inline mipp::Reg<signed char> simd_normalize<signed char,1>(const mipp::Reg<signed char> v, const float f) { return (v >> 3);                        } // v * 0.125
+template <> inline mipp::Reg<signed char> simd_normalize<signed char,2>(const mipp::Reg<signed char> v, const float f) { return            (v >> 2);             } // v * 0.250
+template <> inline mipp::Reg<signed char> simd_normalize<signed char,3>(const mipp::Reg<signed char> v, const float f) { return (v >> 3) + (v >> 2);             } // v * 0.375
+template <> inline mipp::Reg<signed char> simd_normalize<signed char,4>(const mipp::Reg<signed char> v, const float f) { return                       (v >> 1);  } // v * 0.500
+template <> inline mipp::Reg<signed char> simd_normalize<signed char,5>(const mipp::Reg<signed char> v, const float f) { return (v >> 3) +            (v >> 1);  } // v * 0.625
+template <> inline mipp::Reg<signed char> simd_normalize<signed char,6>(const mipp::Reg<signed char> v, const float f) { return            (v >> 2) + (v >> 1);  } // v * 0.750
+template <> inline mipp::Reg<signed char> simd_normalize<signed char,7>(const mipp::Reg<signed char> v, const float f) { return (v >> 3) + (v >> 2) + (v >> 1);  } // v * 0.825
+template <> inline mipp::Reg<signed char> simd_normalize<signed char,8>(const mipp::Reg<signed char> v, const float f) { return v;                               } // v * 1.000
+template <> inline mipp::Reg<float      > simd_normalize<float      ,8>(const mipp::Reg<float      > v, const float f) { return v;                               } // v * 1.000
+template <> inline mipp::Reg<double     > simd_normalize<double     ,8>(const mipp::Reg<double     > v, const float f) { return v;                               } // v * 1.000
+
+// --------------------------------------------------------------------------------------------------------- SIMD TOOLS
+// --------------------------------------------------------------------------------------------------------------------
+
 template <typename B, typename R>
 Decoder_LDPC_BP_layered_ONMS_inter<B,R>
 ::Decoder_LDPC_BP_layered_ONMS_inter(const int K, const int N, const int n_ite,
@@ -35,13 +128,15 @@ Decoder_LDPC_BP_layered_ONMS_inter<B,R>
   var_nodes             (this->n_dec_waves, mipp::vector<mipp::Reg<R>>(N)                             ),
   branches              (this->n_dec_waves, mipp::vector<mipp::Reg<R>>(H.get_n_connections())         ),
   Y_N_reorderered       (N                                                                            ),
-  V_reorderered         (N                                                                            )
+  V_reorderered         (N                                                                            ),
+  lane_frame            (mipp::nElReg<R>(), -1                                                        ),
+  lane_ite              (mipp::nElReg<R>(),  0                                                        ),
+  lane_depth            (mipp::nElReg<R>(),  0                                                        ),
+  lane_synd             (mipp::nElReg<R>(),  0                                                        ),
+  lanes_V               (nullptr                                                                      )
 {
 	const std::string name = "Decoder_LDPC_BP_layered_ONMS_inter";
 	this->set_name(name);
-	
-	if (typeid(R) == typeid(signed char))
-		throw tools::runtime_error(__FILE__, __LINE__, __func__, "This decoder does not work in 8-bit fixed-point.");
 
 	if (saturation <= 0)
 	{
@@ -62,6 +157,7 @@ void Decoder_LDPC_BP_layered_ONMS_inter<B,R>
 ::reset()
 {
 	this->init_flag = true;
+	this->lanes_V   = nullptr;
 }
 
 template <typename B, typename R>
@@ -84,8 +180,9 @@ void Decoder_LDPC_BP_layered_ONMS_inter<B,R>
 	for (auto f = 0; f < mipp::nElReg<R>(); f++) frames[f] = Y_N + f * this->N;
 	tools::Reorderer_static<R,mipp::nElReg<R>()>::apply(frames, (R*)this->Y_N_reorderered.data(), this->N);
 
+	// var_nodes contain previous extrinsic information
 	for (auto i = 0; i < (int)var_nodes[cur_wave].size(); i++)
-		this->var_nodes[cur_wave][i] += this->Y_N_reorderered[i]; // var_nodes contain previous extrinsic information
+		this->var_nodes[cur_wave][i] = simd_adds(this->var_nodes[cur_wave][i], this->Y_N_reorderered[i]);
 }
 
 template <typename B, typename R>
@@ -123,7 +220,7 @@ void Decoder_LDPC_BP_layered_ONMS_inter<B,R>
 	// prepare for next round by processing extrinsic information
 	const auto cur_wave = frame_id / this->simd_inter_frame_level;
 	for (auto i = 0; i < this->N; i++)
-		this->var_nodes[cur_wave][i] -= Y_N_reorderered[i];
+		this->var_nodes[cur_wave][i] = simd_subs(this->var_nodes[cur_wave][i], Y_N_reorderered[i]);
 
 	std::vector<R*> frames(mipp::nElReg<R>());
 	for (auto f = 0; f < mipp::nElReg<R>(); f++) frames[f] = Y_N2 + f * this->N;
@@ -134,6 +231,9 @@ template <typename B, typename R>
 void Decoder_LDPC_BP_layered_ONMS_inter<B,R>
 ::_decode_siho(const R *Y_N, B *V_K, const int frame_id)
 {
+	if (this->decode_lanes(Y_N, V_K, frame_id, false))
+		return;
+
 //	auto t_load = std::chrono::steady_clock::now(); // ----------------------------------------------------------- LOAD
 	this->_load(Y_N, frame_id);
 //	auto d_load = std::chrono::steady_clock::now() - t_load;
@@ -189,6 +289,9 @@ template <typename B, typename R>
 void Decoder_LDPC_BP_layered_ONMS_inter<B,R>
 ::_decode_siho_cw(const R *Y_N, B *V_N, const int frame_id)
 {
+	if (this->decode_lanes(Y_N, V_N, frame_id, true))
+		return;
+
 //	auto t_load = std::chrono::steady_clock::now(); // ----------------------------------------------------------- LOAD
 	this->_load(Y_N, frame_id);
 //	auto d_load = std::chrono::steady_clock::now() - t_load;
@@ -237,6 +340,185 @@ void Decoder_LDPC_BP_layered_ONMS_inter<B,R>
 //	(*this)[dec::tsk::decode_siho_cw].update_timer(dec::tm::decode_siho_cw::store,  d_store);
 }
 
+template <typename B, typename R>
+bool Decoder_LDPC_BP_layered_ONMS_inter<B,R>
+::is_lane_decoding() const
+{
+	// the lanes can only be refilled when all the frames are decoded from scratch (no extrinsic information from a
+	// previous SISO decoding) and when there are more frames than lanes
+	return this->init_flag         &&
+	       this->enable_syndrome   &&
+	       this->n_ite > 0         &&
+	       this->n_frames > this->simd_inter_frame_level;
+}
+
+template <typename B, typename R>
+bool Decoder_LDPC_BP_layered_ONMS_inter<B,R>
+::decode_lanes(const R *Y_N, B *V, const int frame_id, const bool cw)
+{
+	const auto V_size = cw ? this->N : this->K;
+
+	// the wave loop of 'Decoder_SIHO' calls '_decode_siho' wave by wave: the whole batch is decoded on the first wave
+	// (the waves of a single frame decoding are given in the internal buffer), the next waves only retrieve their
+	// decided bits
+	if (this->lanes_V != nullptr)
+	{
+		const auto n_wave_frames = std::min(this->simd_inter_frame_level, this->n_frames - frame_id);
+		const auto V_wave        = this->lanes_V + frame_id * V_size;
+		if (V != V_wave)
+			std::copy(V_wave, V_wave + n_wave_frames * V_size, V);
+
+		if (frame_id + this->simd_inter_frame_level >= this->n_frames)
+			this->lanes_V = nullptr;
+		return true;
+	}
+
+	if (frame_id != 0 || Y_N == Decoder_SIHO<B,R>::Y_N.data() || !this->is_lane_decoding())
+		return false;
+
+	if (typeid(R) == typeid(short) || typeid(R) == typeid(signed char))
+	{
+		     if (normalize_factor == 0.125f) this->BP_decode_lanes<1>(Y_N, V, cw);
+		else if (normalize_factor == 0.250f) this->BP_decode_lanes<2>(Y_N, V, cw);
+		else if (normalize_factor == 0.375f) this->BP_decode_lanes<3>(Y_N, V, cw);
+		else if (normalize_factor == 0.500f) this->BP_decode_lanes<4>(Y_N, V, cw);
+		else if (normalize_factor == 0.625f) this->BP_decode_lanes<5>(Y_N, V, cw);
+		else if (normalize_factor == 0.750f) this->BP_decode_lanes<6>(Y_N, V, cw);
+		else if (normalize_factor == 0.875f) this->BP_decode_lanes<7>(Y_N, V, cw);
+		else if (normalize_factor == 1.000f) this->BP_decode_lanes<8>(Y_N, V, cw);
+		else
+		{
+			std::stringstream message;
+			message << "'normalize_factor' can only be 0.125f, 0.250f, 0.375f, 0.500f, 0.625f, 0.750f, 0.875f or 1.000f"
+			        << " ('normalize_factor' = " << normalize_factor << ").";
+			throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+		}
+	}
+	else // float or double
+	{
+		if (normalize_factor == 1.000f) this->BP_decode_lanes<8>(Y_N, V, cw);
+		else                            this->BP_decode_lanes<0>(Y_N, V, cw);
+	}
+
+	// the decoder memory does not contain the extrinsic information of the current frames anymore
+	this->init_flag = true;
+
+	this->lanes_V = V;
+	return true;
+}
+
+// BP algorithm where each lane stops as soon as its frame is decoded and takes the next frame of the batch: the
+// throughput depends on the average number of iterations instead of the number of iterations of the slowest frame
+template <typename B, typename R>
+template <int F>
+void Decoder_LDPC_BP_layered_ONMS_inter<B,R>
+::BP_decode_lanes(const R *Y_N, B *V, const bool cw)
+{
+	const auto n_lanes = this->simd_inter_frame_level;
+	const auto V_size  = cw ? this->N : this->K;
+
+	auto next_frame = 0;
+	auto n_busy     = 0;
+	for (auto l = 0; l < n_lanes; l++)
+	{
+		lane_frame[l] = next_frame < this->n_frames ? next_frame++ : -1;
+		lane_ite  [l] = 0;
+		lane_depth[l] = 0;
+		this->load_lane(lane_frame[l] >= 0 ? Y_N + lane_frame[l] * this->N : nullptr, l);
+		n_busy += lane_frame[l] >= 0 ? 1 : 0;
+	}
+
+	while (n_busy)
+	{
+		this->BP_process<F>(this->var_nodes[0], this->branches[0]);
+		this->check_syndrome_lanes();
+
+		for (auto l = 0; l < n_lanes; l++)
+		{
+			if (lane_frame[l] < 0)
+				continue;
+
+			lane_ite  [l]++;
+			lane_depth[l] = lane_synd[l] ? 0 : lane_depth[l] +1;
+
+			if (lane_depth[l] == this->syndrome_depth || lane_ite[l] == this->n_ite)
+			{
+				// retire the decoded frame and refill the lane
+				this->store_lane(V + lane_frame[l] * V_size, l, cw);
+
+				lane_ite  [l] = 0;
+				lane_depth[l] = 0;
+				if (next_frame < this->n_frames)
+				{
+					lane_frame[l] = next_frame++;
+					this->load_lane(Y_N + lane_frame[l] * this->N, l);
+				}
+				else
+				{
+					lane_frame[l] = -1;
+					n_busy--;
+				}
+			}
+		}
+	}
+}
+
+template <typename B, typename R>
+void Decoder_LDPC_BP_layered_ONMS_inter<B,R>
+::load_lane(const R *Y_N, const int lane)
+{
+	const auto n_lanes = this->simd_inter_frame_level;
+	auto var_nodes = (R*)this->var_nodes[0].data();
+	auto branches  = (R*)this->branches [0].data();
+
+	const auto n_branches = (int)this->branches[0].size();
+	for (auto i = 0; i < n_branches; i++)
+		branches[i * n_lanes + lane] = (R)0;
+
+	if (Y_N != nullptr)
+		for (auto i = 0; i < this->N; i++)
+			var_nodes[i * n_lanes + lane] = Y_N[i];
+	else
+		for (auto i = 0; i < this->N; i++)
+			var_nodes[i * n_lanes + lane] = (R)0;
+}
+
+template <typename B, typename R>
+void Decoder_LDPC_BP_layered_ONMS_inter<B,R>
+::store_lane(B *V, const int lane, const bool cw)
+{
+	const auto n_lanes = this->simd_inter_frame_level;
+	const auto var_nodes = (const R*)this->var_nodes[0].data();
+
+	if (cw)
+		for (auto i = 0; i < this->N; i++)
+			V[i] = std::signbit((float)var_nodes[i * n_lanes + lane]) ? (B)1 : (B)0;
+	else
+		for (auto i = 0; i < this->K; i++)
+			V[i] = std::signbit((float)var_nodes[this->info_bits_pos[i] * n_lanes + lane]) ? (B)1 : (B)0;
+}
+
+template <typename B, typename R>
+void Decoder_LDPC_BP_layered_ONMS_inter<B,R>
+::check_syndrome_lanes()
+{
+	const auto zero = mipp::Msk<mipp::N<B>()>(false);
+	auto syndrome = zero;
+
+	for (auto i = 0; i < this->n_C_nodes; i++)
+	{
+		auto sign = zero;
+
+		const auto n_VN = (int)this->H[i].size();
+		for (auto j = 0; j < n_VN; j++)
+			sign ^= mipp::sign(this->var_nodes[0][this->H[i][j]]);
+
+		syndrome |= sign;
+	}
+
+	mipp::toReg<B>(syndrome).store(this->lane_synd.data());
+}
+
 // BP algorithm
 template <typename B, typename R>
 template <int F>
@@ -289,40 +571,6 @@ bool Decoder_LDPC_BP_layered_ONMS_inter<B,R>
 	return (mipp::testz(syndrome));
 }
 
-// --------------------------------------------------------------------------------------------------------------------
-// --------------------------------------------------------------------------------------------------------- SIMD TOOLS
-
-//                                                                                                           saturation
-template <typename R>
-inline mipp::Reg<R> simd_sat(const mipp::Reg<R> val, const R saturation)
-{
-	return val;
-}
-template <>
-inline mipp::Reg<short> simd_sat(const mipp::Reg<short> v, const short s)
-{
-	return mipp::sat(v, (short)-s, (short)+s);
-}
-
-//                                                                                                        normalization
-template <typename R, int F = 0> inline mipp::Reg<R> simd_normalize(const mipp::Reg<R> val, const float factor)
-{
-	return val * mipp::Reg<R>((R)factor);
-}
-template <> inline mipp::Reg<short > simd_normalize<short, 1>(const mipp::Reg<short > v, const float f) { return (v >> 3);                       } // v * 0.125
-template <> inline mipp::Reg<short > simd_normalize<short, 2>(const mipp::Reg<short > v, const float f) { return            (v >> 2);            } // v * 0.250
-template <> inline mipp::Reg<short > simd_normalize<short, 3>(const mipp::Reg<short > v, const float f) { return (v >> 3) + (v >> 2);            } // v * 0.375
-template <> inline mipp::Reg<short > simd_normalize<short, 4>(const mipp::Reg<short > v, const float f) { return                       (v >> 1); } // v * 0.500
-template <> inline mipp::Reg<short > simd_normalize<short, 5>(const mipp::Reg<short > v, const float f) { return (v >> 3) +            (v >> 1); } // v * 0.625
-template <> inline mipp::Reg<short > simd_normalize<short, 6>(const mipp::Reg<short > v, const float f) { return            (v >> 2) + (v >> 1); } // v * 0.750
-template <> inline mipp::Reg<short > simd_normalize<short, 7>(const mipp::Reg<short > v, const float f) { return (v >> 3) + (v >> 2) + (v >> 1); } // v * 0.825
-template <> inline mipp::Reg<short > simd_normalize<short, 8>(const mipp::Reg<short > v, const float f) { return v;                              } // v * 1.000
-template <> inline mipp::Reg<float > simd_normalize<float, 8>(const mipp::Reg<float > v, const float f) { return v;                              } // v * 1.000
-template <> inline mipp::Reg<double> simd_normalize<double,8>(const mipp::Reg<double> v, const float f) { return v;                              } // v * 1.000
-
-// --------------------------------------------------------------------------------------------------------- SIMD TOOLS
-// --------------------------------------------------------------------------------------------------------------------
-
 // BP algorithm
 template <typename B, typename R>
 template <int F>
@@ -343,7 +591,7 @@ void Decoder_LDPC_BP_layered_ONMS_inter<B,R>
 		const auto n_VN = (int)this->H[i].size();
 		for (auto j = 0; j < n_VN; j++)
 		{
-			contributions[j]  = var_nodes[this->H[i][j]] - branches[kr++];
+			contributions[j]  = simd_subs(var_nodes[this->H[i][j]], branches[kr++]);
 			const auto v_abs  = mipp::abs (contributions[j]);
 			const auto c_sign = mipp::sign(contributions[j]);
 			const auto v_temp = min1;
@@ -368,7 +616,7 @@ void Decoder_LDPC_BP_layered_ONMS_inter<B,R>
 			           v_res = mipp::copysign(v_res, v_sig);
 
 			branches[kw++] = v_res;
-			var_nodes[this->H[i][j]] = contributions[j] + v_res;
+			var_nodes[this->H[i][j]] = simd_adds(contributions[j], v_res);
 		}
 	}
 }
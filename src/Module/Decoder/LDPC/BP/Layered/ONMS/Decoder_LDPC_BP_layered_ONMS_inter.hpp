@@ -1,6 +1,7 @@
 #ifndef DECODER_LDPC_BP_LAYERED_ONMS_INTER_HPP_
 #define DECODER_LDPC_BP_LAYERED_ONMS_INTER_HPP_
 
+#include <vector>
 #include <mipp.h>
 
 #include "Tools/Algo/Sparse_matrix/Sparse_matrix.hpp"
@@ -35,6 +36,14 @@ protected:
 	mipp::vector<mipp::Reg<R>> Y_N_reorderered;
 	mipp::vector<mipp::Reg<B>> V_reorderered;
 
+	// per-lane early termination: each SIMD lane decodes its own frame and is refilled with the next frame of the
+	// batch as soon as its frame is decoded (used when 'n_frames' is greater than the number of lanes)
+	std::vector<int> lane_frame; // frame decoded in each lane (-1 if the lane is idle)
+	std::vector<int> lane_ite;   // number of iterations done by each lane on its current frame
+	std::vector<int> lane_depth; // number of consecutive iterations with a valid syndrome in each lane
+	mipp::vector<B>  lane_synd;  // syndrome of each lane (0 if valid)
+	const B         *lanes_V;    // decided bits of the batch being retrieved wave by wave (nullptr otherwise)
+
 public:
 	Decoder_LDPC_BP_layered_ONMS_inter(const int K, const int N, const int n_ite,
 	                                   const tools::Sparse_matrix &H,
@@ -60,6 +69,17 @@ protected:
 
 	bool check_syndrome(const int frame_id);
 
+	// per-lane early termination functions
+	bool is_lane_decoding(                                                     ) const;
+	bool decode_lanes    (const R *Y_N, B *V, const int frame_id, const bool cw);
+
+	template <int F = 1>
+	void BP_decode_lanes(const R *Y_N, B *V, const bool cw);
+
+	void load_lane           (const R *Y_N, const int lane                );
+	void store_lane          (      B *V,   const int lane, const bool cw);
+	void check_syndrome_lanes(                                            );
+
 	template <int F = 1>
 	void BP_process(mipp::vector<mipp::Reg<R>> &var_nodes, mipp::vector<mipp::Reg<R>> &branches);
 };
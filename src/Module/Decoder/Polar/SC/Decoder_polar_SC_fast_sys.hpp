@@ -16,6 +16,9 @@ namespace aff3ct
 {
 namespace module
 {
+// operations of the flattened decoding tree
+enum class polar_op_t : unsigned char { F, G, G0, GR, XO, XO0, H0, H, REP, SPC, GPC, GPC_REP };
+
 template <typename B, typename R, class API_polar>
 class Decoder_polar_ASCL_fast_CA_sys;
 
@@ -33,7 +36,19 @@ class Decoder_polar_SC_fast_sys : public Decoder_SIHO<B,R>, public tools::Frozen
 	friend Decoder_polar_ASCL_fast_CA_sys    <B,R,API_polar>;
 	friend Decoder_polar_ASCL_MEM_fast_CA_sys<B,R,API_polar>;
 
+public:
+	using op_fn = void (*)(mipp::vector<B>&, mipp::vector<R>&, const int, const int, const int, const int);
+
 protected:
+	struct polar_op
+	{
+		op_fn fn;
+		int   off_l;
+		int   off_s;
+		int   n_elmts;
+		int   n_sub;   // size of the sub-blocks of the generalized nodes (0 otherwise)
+	};
+
 	const int                m;            // graph depth
 	      mipp::vector<R   > l;            // lambda, LR or LLR
 	      mipp::vector<B   > s;            // bits, partial sums
@@ -41,6 +56,7 @@ protected:
 	const  std::vector<bool> &frozen_bits; // frozen bits
 
 	tools::Pattern_polar_parser polar_patterns;
+	std::vector<polar_op>       ops; // the decoding tree flattened in a list of operations (in execution order)
 
 public:
 	Decoder_polar_SC_fast_sys(const int& K, const int& N, const std::vector<bool>& frozen_bits, const int n_frames = 1);
@@ -61,7 +77,12 @@ protected:
 	        void _store         (              B *V_K                    );
 	        void _store_cw      (              B *V_N                    );
 
-	virtual void recursive_decode(const int off_l, const int off_s, const int reverse_depth, int &node_id);
+	        void flatten_tree     (                                                                          );
+	        void push_op          (const polar_op_t op_type, const int off_l, const int off_s, const int n_elmts,
+	                               const int n_sub = 0                                                       );
+	        void recursive_flatten(const int off_l, const int off_s, const int reverse_depth, int &node_id   );
+	        void flatten_g_rep    (const int off_l, const int off_s, const int reverse_depth, const int n_sub,
+	                               const polar_op_t source_op                                                );
 };
 }
 }
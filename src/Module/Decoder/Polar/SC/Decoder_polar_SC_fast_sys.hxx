@@ -16,6 +16,10 @@
 #include "Tools/Code/Polar/Patterns/Pattern_polar_rep_left.hpp"
 #include "Tools/Code/Polar/Patterns/Pattern_polar_spc.hpp"
 #include "Tools/Code/Polar/Patterns/Pattern_polar_std.hpp"
+#include "Tools/Code/Polar/Patterns/Pattern_polar_g_rep_r1.hpp"
+#include "Tools/Code/Polar/Patterns/Pattern_polar_g_rep_spc.hpp"
+#include "Tools/Code/Polar/Patterns/Pattern_polar_g_pc.hpp"
+#include "Tools/Code/Polar/Patterns/Pattern_polar_g_pc_rep.hpp"
 
 #include "Tools/Code/Polar/fb_extract.h"
 
@@ -27,95 +31,125 @@ namespace module
 {
 constexpr int static_level = 6; // 2^6 = 64
 
-template <typename B, typename R, class API_polar, int REV_D>
-struct Decoder_polar_SC_fast_sys_static
+// operations of the generalized parity-check nodes, the size of these nodes is never known at compile time (not
+// available for the APIs without the generalized nodes kernels)
+template <typename B, typename R, class API_polar, bool G_NODES = API_polar::has_generalized_nodes()>
+struct Decoder_polar_SC_fast_sys_gen_ops
 {
-	static void decode(const tools::Pattern_polar_parser &polar_patterns, mipp::vector<B> &s,
-	                   mipp::vector<R> &l, const int off_l, const int off_s, int &node_id)
+	static void gpc(mipp::vector<B> &s, mipp::vector<R> &l, const int off_l, const int off_s, const int n_elmts,
+	                const int n_sub)
 	{
-		constexpr int reverse_depth = REV_D;
-		constexpr int n_elmts = 1 << reverse_depth;
-		constexpr int n_elm_2 = n_elmts >> 1;
-
-		const tools::polar_node_t node_type = polar_patterns.get_node_type(node_id);
-
-		const bool is_terminal_pattern = (node_type == tools::polar_node_t::RATE_0) ||
-		                                 (node_type == tools::polar_node_t::RATE_1) ||
-		                                 (node_type == tools::polar_node_t::REP)    ||
-		                                 (node_type == tools::polar_node_t::SPC);
-
-		if (!is_terminal_pattern && reverse_depth)
-		{
-			// f
-			switch (node_type)
-			{
-				case tools::STANDARD: API_polar::template f<n_elm_2>(l, off_l, off_l + n_elm_2, off_l + n_elmts, n_elm_2); break;
-				case tools::REP_LEFT: API_polar::template f<n_elm_2>(l, off_l, off_l + n_elm_2, off_l + n_elmts, n_elm_2); break;
-				default:
-					break;
-			}
-
-			Decoder_polar_SC_fast_sys_static<B,R,API_polar,REV_D-1>
-			::decode(polar_patterns, s, l, off_l + n_elmts, off_s, ++node_id); // recursive call left
-
-			// g
-			switch (node_type)
-			{
-				case tools::STANDARD:    API_polar::template g <n_elm_2>(s, l, off_l, off_l + n_elm_2, off_s, off_l + n_elmts, n_elm_2); break;
-				case tools::RATE_0_LEFT: API_polar::template g0<n_elm_2>(   l, off_l, off_l + n_elm_2,        off_l + n_elmts, n_elm_2); break;
-				case tools::REP_LEFT:    API_polar::template gr<n_elm_2>(s, l, off_l, off_l + n_elm_2, off_s, off_l + n_elmts, n_elm_2); break;
-				default:
-					break;
-			}
+		API_polar::gpc(s, l, off_l, off_s, n_elmts, n_sub);
+	}
 
-			Decoder_polar_SC_fast_sys_static<B,R,API_polar,REV_D-1>
-			::decode(polar_patterns, s, l, off_l + n_elmts, off_s + n_elm_2, ++node_id); // recursive call right
+	static void gpc_rep(mipp::vector<B> &s, mipp::vector<R> &l, const int off_l, const int off_s, const int n_elmts,
+	                    const int n_sub)
+	{
+		API_polar::gpc_rep(s, l, off_l, off_s, n_elmts, n_sub);
+	}
 
-			// xor
-			switch (node_type)
-			{
-				case tools::STANDARD:    API_polar::template xo <n_elm_2>(s, off_s, off_s + n_elm_2, off_s, n_elm_2); break;
-				case tools::RATE_0_LEFT: API_polar::template xo0<n_elm_2>(s,        off_s + n_elm_2, off_s, n_elm_2); break;
-				case tools::REP_LEFT:    API_polar::template xo <n_elm_2>(s, off_s, off_s + n_elm_2, off_s, n_elm_2); break;
-				default:
-					break;
-			}
-		}
-		else
+	static typename Decoder_polar_SC_fast_sys<B,R,API_polar>::op_fn get(const polar_op_t op)
+	{
+		switch (op)
 		{
-			// h
-			switch (node_type)
-			{
-				case tools::RATE_0: // if (!polar_patterns.exist_node_type(tools::polar_node_t::RATE_0_LEFT, REV_D+1))
-				                    API_polar::template h0 <n_elmts>(s,           off_s, n_elmts); break;
-				case tools::RATE_1: API_polar::template h  <n_elmts>(s, l, off_l, off_s, n_elmts); break;
-				case tools::REP:    API_polar::template rep<n_elmts>(s, l, off_l, off_s, n_elmts); break;
-				case tools::SPC:    API_polar::template spc<n_elmts>(s, l, off_l, off_s, n_elmts); break;
-				default:
-					break;
-			}
+			case polar_op_t::GPC:     return &gpc;
+			case polar_op_t::GPC_REP: return &gpc_rep;
+			default:
+				return nullptr;
 		}
 	}
 };
 
 template <typename B, typename R, class API_polar>
-struct Decoder_polar_SC_fast_sys_static<B,R,API_polar,0>
+struct Decoder_polar_SC_fast_sys_gen_ops<B,R,API_polar,false>
+{
+	static typename Decoder_polar_SC_fast_sys<B,R,API_polar>::op_fn get(const polar_op_t op)
+	{
+		return nullptr;
+	}
+};
+
+// operations of the flattened decoding tree: 'n_elmts' is the size of the operation (half the node size for the f, g
+// and xor operations), when N_ELMTS is not 0 the size is known at compile time
+template <typename B, typename R, class API_polar, int N_ELMTS>
+struct Decoder_polar_SC_fast_sys_ops
 {
-	static void decode(const tools::Pattern_polar_parser &polar_patterns, mipp::vector<B> &s, mipp::vector<R> &l,
-	                   const int off_l, const int off_s, int &node_id)
+	static void f(mipp::vector<B> &s, mipp::vector<R> &l, const int off_l, const int off_s, const int n_elmts,
+	              const int n_sub)
+	{
+		API_polar::template f<N_ELMTS>(l, off_l, off_l + n_elmts, off_l + 2 * n_elmts, n_elmts);
+	}
+
+	static void g(mipp::vector<B> &s, mipp::vector<R> &l, const int off_l, const int off_s, const int n_elmts,
+	              const int n_sub)
 	{
-		constexpr int reverse_depth = 0;
-		constexpr int n_elmts = 1 << reverse_depth;
+		API_polar::template g<N_ELMTS>(s, l, off_l, off_l + n_elmts, off_s, off_l + 2 * n_elmts, n_elmts);
+	}
+
+	static void g0(mipp::vector<B> &s, mipp::vector<R> &l, const int off_l, const int off_s, const int n_elmts,
+	               const int n_sub)
+	{
+		API_polar::template g0<N_ELMTS>(l, off_l, off_l + n_elmts, off_l + 2 * n_elmts, n_elmts);
+	}
 
-		const tools::polar_node_t node_t = polar_patterns.get_node_type(node_id);
+	static void gr(mipp::vector<B> &s, mipp::vector<R> &l, const int off_l, const int off_s, const int n_elmts,
+	               const int n_sub)
+	{
+		API_polar::template gr<N_ELMTS>(s, l, off_l, off_l + n_elmts, off_s, off_l + 2 * n_elmts, n_elmts);
+	}
+
+	static void xo(mipp::vector<B> &s, mipp::vector<R> &l, const int off_l, const int off_s, const int n_elmts,
+	               const int n_sub)
+	{
+		API_polar::template xo<N_ELMTS>(s, off_s, off_s + n_elmts, off_s, n_elmts);
+	}
+
+	static void xo0(mipp::vector<B> &s, mipp::vector<R> &l, const int off_l, const int off_s, const int n_elmts,
+	                const int n_sub)
+	{
+		API_polar::template xo0<N_ELMTS>(s, off_s + n_elmts, off_s, n_elmts);
+	}
+
+	static void h0(mipp::vector<B> &s, mipp::vector<R> &l, const int off_l, const int off_s, const int n_elmts,
+	               const int n_sub)
+	{
+		API_polar::template h0<N_ELMTS>(s, off_s, n_elmts);
+	}
 
-		switch (node_t)
+	static void h(mipp::vector<B> &s, mipp::vector<R> &l, const int off_l, const int off_s, const int n_elmts,
+	              const int n_sub)
+	{
+		API_polar::template h<N_ELMTS>(s, l, off_l, off_s, n_elmts);
+	}
+
+	static void rep(mipp::vector<B> &s, mipp::vector<R> &l, const int off_l, const int off_s, const int n_elmts,
+	                const int n_sub)
+	{
+		API_polar::template rep<N_ELMTS>(s, l, off_l, off_s, n_elmts);
+	}
+
+	static void spc(mipp::vector<B> &s, mipp::vector<R> &l, const int off_l, const int off_s, const int n_elmts,
+	                const int n_sub)
+	{
+		API_polar::template spc<N_ELMTS>(s, l, off_l, off_s, n_elmts);
+	}
+
+	static typename Decoder_polar_SC_fast_sys<B,R,API_polar>::op_fn get(const polar_op_t op)
+	{
+		switch (op)
 		{
-			case tools::RATE_0: // if (!polar_patterns.exist_node_type(tools::polar_node_t::RATE_0_LEFT, 1))
-				                API_polar::template h0<n_elmts>(s,           off_s, n_elmts); break;
-			case tools::RATE_1: API_polar::template h <n_elmts>(s, l, off_l, off_s, n_elmts); break;
+			case polar_op_t::F:   return &f;
+			case polar_op_t::G:   return &g;
+			case polar_op_t::G0:  return &g0;
+			case polar_op_t::GR:  return &gr;
+			case polar_op_t::XO:  return &xo;
+			case polar_op_t::XO0: return &xo0;
+			case polar_op_t::H0:  return &h0;
+			case polar_op_t::H:   return &h;
+			case polar_op_t::REP: return &rep;
+			case polar_op_t::SPC: return &spc;
 			default:
-				break;
+				return Decoder_polar_SC_fast_sys_gen_ops<B,R,API_polar>::get(op);
 		}
 	}
 };
@@ -170,6 +204,8 @@ Decoder_polar_SC_fast_sys<B,R,API_polar>
 		        << k << ").";
 		throw tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
 	}
+
+	this->flatten_tree();
 }
 
 template <typename B, typename R, class API_polar>
@@ -191,6 +227,14 @@ Decoder_polar_SC_fast_sys<B,R,API_polar>
 
 	static_assert(sizeof(B) == sizeof(R), "");
 
+	if (!API_polar::has_generalized_nodes() && (this->polar_patterns.exist_node_type(tools::polar_node_t::G_PC) ||
+	                                            this->polar_patterns.exist_node_type(tools::polar_node_t::G_PC_REP)))
+	{
+		std::stringstream message;
+		message << "The G-PC nodes are not supported by this Polar API.";
+		throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
 	if (!tools::is_power_of_2(this->N))
 	{
 		std::stringstream message;
@@ -214,6 +258,8 @@ Decoder_polar_SC_fast_sys<B,R,API_polar>
 		        << k << ").";
 		throw tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
 	}
+
+	this->flatten_tree();
 }
 
 template <typename B, typename R, class API_polar>
@@ -228,6 +274,7 @@ void Decoder_polar_SC_fast_sys<B,R,API_polar>
 ::notify_frozenbits_update()
 {
 	polar_patterns.notify_frozenbits_update();
+	this->flatten_tree();
 }
 
 template <typename B, typename R, class API_polar>
@@ -266,8 +313,9 @@ void Decoder_polar_SC_fast_sys<B,R,API_polar>
 		throw tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
 	}
 
-	int first_id = 0, off_l = 0, off_s = 0;
-	this->recursive_decode(off_l, off_s, m, first_id);
+	// straight-line execution of the decoding tree (no recursion and no node type checks)
+	for (const auto &op : this->ops)
+		op.fn(this->s, this->l, op.off_l, op.off_s, op.n_elmts, op.n_sub);
 }
 
 template <typename B, typename R, class API_polar>
@@ -328,74 +376,132 @@ void Decoder_polar_SC_fast_sys<B,R,API_polar>
 
 template <typename B, typename R, class API_polar>
 void Decoder_polar_SC_fast_sys<B,R,API_polar>
-::recursive_decode(const int off_l, const int off_s, const int reverse_depth, int &node_id)
+::flatten_tree()
 {
-	if (reverse_depth == static_level)
+	this->ops.clear();
+
+	int first_id = 0, off_l = 0, off_s = 0;
+	this->recursive_flatten(off_l, off_s, m, first_id);
+}
+
+template <typename B, typename R, class API_polar>
+void Decoder_polar_SC_fast_sys<B,R,API_polar>
+::push_op(const polar_op_t op_type, const int off_l, const int off_s, const int n_elmts, const int n_sub)
+{
+	// the sizes of the nodes close to the leaves are known at compile time
+	op_fn fn;
+	switch (n_elmts)
 	{
-		// use the static version of the decoder
-		Decoder_polar_SC_fast_sys_static<B,R,API_polar,static_level>
-		::decode(polar_patterns, this->s, this->l, off_l, off_s, node_id);
+		case  1: fn = Decoder_polar_SC_fast_sys_ops<B,R,API_polar, 1>::get(op_type); break;
+		case  2: fn = Decoder_polar_SC_fast_sys_ops<B,R,API_polar, 2>::get(op_type); break;
+		case  4: fn = Decoder_polar_SC_fast_sys_ops<B,R,API_polar, 4>::get(op_type); break;
+		case  8: fn = Decoder_polar_SC_fast_sys_ops<B,R,API_polar, 8>::get(op_type); break;
+		case 16: fn = Decoder_polar_SC_fast_sys_ops<B,R,API_polar,16>::get(op_type); break;
+		case 32: fn = Decoder_polar_SC_fast_sys_ops<B,R,API_polar,32>::get(op_type); break;
+		case 64: fn = Decoder_polar_SC_fast_sys_ops<B,R,API_polar,64>::get(op_type); break;
+		default: fn = Decoder_polar_SC_fast_sys_ops<B,R,API_polar, 0>::get(op_type); break;
 	}
-	else
-	{
-		const int n_elmts = 1 << reverse_depth;
-		const int n_elm_2 = n_elmts >> 1;
-		const auto node_type = polar_patterns.get_node_type(node_id);
 
-		const bool is_terminal_pattern = (node_type == tools::polar_node_t::RATE_0) ||
-		                                 (node_type == tools::polar_node_t::RATE_1) ||
-		                                 (node_type == tools::polar_node_t::REP)    ||
-		                                 (node_type == tools::polar_node_t::SPC);
+	this->ops.push_back({fn, off_l, off_s, n_elmts, n_sub});
+}
 
-		if (!is_terminal_pattern && reverse_depth)
+template <typename B, typename R, class API_polar>
+void Decoder_polar_SC_fast_sys<B,R,API_polar>
+::recursive_flatten(const int off_l, const int off_s, const int reverse_depth, int &node_id)
+{
+	const int n_elmts = 1 << reverse_depth;
+	const int n_elm_2 = n_elmts >> 1;
+	const auto node_type = polar_patterns.get_node_type(node_id);
+
+	const bool is_terminal_pattern = (node_type == tools::polar_node_t::RATE_0)    ||
+	                                 (node_type == tools::polar_node_t::RATE_1)    ||
+	                                 (node_type == tools::polar_node_t::REP)       ||
+	                                 (node_type == tools::polar_node_t::SPC)       ||
+	                                 (node_type == tools::polar_node_t::G_REP_R1)  ||
+	                                 (node_type == tools::polar_node_t::G_REP_SPC) ||
+	                                 (node_type == tools::polar_node_t::G_PC)      ||
+	                                 (node_type == tools::polar_node_t::G_PC_REP);
+
+	if (!is_terminal_pattern && reverse_depth)
+	{
+		// f
+		switch (node_type)
 		{
-			// f
-			switch (node_type)
-			{
-				case tools::STANDARD: API_polar::f(l, off_l, off_l + n_elm_2, off_l + n_elmts, n_elm_2); break;
-				case tools::REP_LEFT: API_polar::f(l, off_l, off_l + n_elm_2, off_l + n_elmts, n_elm_2); break;
-				default:
-					break;
-			}
+			case tools::STANDARD: this->push_op(polar_op_t::F, off_l, off_s, n_elm_2); break;
+			case tools::REP_LEFT: this->push_op(polar_op_t::F, off_l, off_s, n_elm_2); break;
+			default:
+				break;
+		}
 
-			this->recursive_decode(off_l + n_elmts, off_s, reverse_depth -1, ++node_id); // recursive call left
+		this->recursive_flatten(off_l + n_elmts, off_s, reverse_depth -1, ++node_id); // recursive call left
 
-			// g
-			switch (node_type)
-			{
-				case tools::STANDARD:    API_polar::g (s, l, off_l, off_l + n_elm_2, off_s, off_l + n_elmts, n_elm_2); break;
-				case tools::RATE_0_LEFT: API_polar::g0(   l, off_l, off_l + n_elm_2,        off_l + n_elmts, n_elm_2); break;
-				case tools::REP_LEFT:    API_polar::gr(s, l, off_l, off_l + n_elm_2, off_s, off_l + n_elmts, n_elm_2); break;
-				default:
-					break;
-			}
+		// g
+		switch (node_type)
+		{
+			case tools::STANDARD:    this->push_op(polar_op_t::G,  off_l, off_s, n_elm_2); break;
+			case tools::RATE_0_LEFT: this->push_op(polar_op_t::G0, off_l, off_s, n_elm_2); break;
+			case tools::REP_LEFT:    this->push_op(polar_op_t::GR, off_l, off_s, n_elm_2); break;
+			default:
+				break;
+		}
 
-			this->recursive_decode(off_l + n_elmts, off_s + n_elm_2, reverse_depth -1, ++node_id); // recursive call right
+		this->recursive_flatten(off_l + n_elmts, off_s + n_elm_2, reverse_depth -1, ++node_id); // recursive call right
 
-			// xor
-			switch (node_type)
-			{
-				case tools::STANDARD:    API_polar::xo (s, off_s, off_s + n_elm_2, off_s, n_elm_2); break;
-				case tools::RATE_0_LEFT: API_polar::xo0(s,        off_s + n_elm_2, off_s, n_elm_2); break;
-				case tools::REP_LEFT:    API_polar::xo (s, off_s, off_s + n_elm_2, off_s, n_elm_2); break;
-				default:
-					break;
-			}
+		// xor
+		switch (node_type)
+		{
+			case tools::STANDARD:    this->push_op(polar_op_t::XO,  off_l, off_s, n_elm_2); break;
+			case tools::RATE_0_LEFT: this->push_op(polar_op_t::XO0, off_l, off_s, n_elm_2); break;
+			case tools::REP_LEFT:    this->push_op(polar_op_t::XO,  off_l, off_s, n_elm_2); break;
+			default:
+				break;
 		}
-		else
+	}
+	else
+	{
+		// h
+		switch (node_type)
 		{
-			// h
-			switch (node_type)
-			{
-				case tools::RATE_0: // if (!polar_patterns.exist_node_type(tools::polar_node_t::RATE_0_LEFT, REV_D+1))
-				                    API_polar::h0 (s,           off_s, n_elmts); break;
-				case tools::RATE_1: API_polar::h  (s, l, off_l, off_s, n_elmts); break;
-				case tools::REP:    API_polar::rep(s, l, off_l, off_s, n_elmts); break;
-				case tools::SPC:    API_polar::spc(s, l, off_l, off_s, n_elmts); break;
-				default:
-					break;
-			}
+			case tools::RATE_0: this->push_op(polar_op_t::H0,  off_l, off_s, n_elmts); break;
+			case tools::RATE_1: this->push_op(polar_op_t::H,   off_l, off_s, n_elmts); break;
+			case tools::REP:    this->push_op(polar_op_t::REP, off_l, off_s, n_elmts); break;
+			case tools::SPC:    this->push_op(polar_op_t::SPC, off_l, off_s, n_elmts); break;
+			default:
+				break;
 		}
+
+		const auto n_sub = polar_patterns.get_node_sub_size(node_id);
+		switch (node_type)
+		{
+			case tools::G_REP_R1:  this->flatten_g_rep(off_l, off_s, reverse_depth, n_sub, polar_op_t::H  ); break;
+			case tools::G_REP_SPC: this->flatten_g_rep(off_l, off_s, reverse_depth, n_sub, polar_op_t::SPC); break;
+			case tools::G_PC:      this->push_op(polar_op_t::GPC,     off_l, off_s, n_elmts, n_sub);          break;
+			case tools::G_PC_REP:  this->push_op(polar_op_t::GPC_REP, off_l, off_s, n_elmts, n_sub);          break;
+			default:
+				break;
+		}
+	}
+}
+
+template <typename B, typename R, class API_polar>
+void Decoder_polar_SC_fast_sys<B,R,API_polar>
+::flatten_g_rep(const int off_l, const int off_s, const int reverse_depth, const int n_sub,
+                const polar_op_t source_op)
+{
+	// the LLRs are folded down to the repeated source (g0 on each level), the source is decoded and then copied in
+	// all the repetitions (xo0 on each level), the frozen bits are never computed since xo0 overwrites them
+	auto n_elmts = 1 << reverse_depth;
+	auto cur_l = off_l, cur_s = off_s;
+	for (; n_elmts > n_sub; cur_l += n_elmts, cur_s += n_elmts >> 1, n_elmts >>= 1)
+		this->push_op(polar_op_t::G0, cur_l, cur_s, n_elmts >> 1);
+
+	this->push_op(source_op, cur_l, cur_s, n_sub);
+
+	for (n_elmts <<= 1; n_elmts <= (1 << reverse_depth); n_elmts <<= 1)
+	{
+		cur_s -= n_elmts >> 1;
+		cur_l -= n_elmts;
+		this->push_op(polar_op_t::XO0, cur_l, cur_s, n_elmts >> 1);
 	}
 }
 
@@ -0,0 +1,86 @@
+#ifndef DECODER_POLAR_SCAN_FAST_H_
+#define DECODER_POLAR_SCAN_FAST_H_
+
+#include <vector>
+#include <mipp.h>
+
+#include "Tools/Code/Polar/API/API_polar_dynamic_seq.hpp"
+#include "Tools/Code/Polar/decoder_polar_functions.h"
+#include "Tools/Code/Polar/Frozenbits_notifier.hpp"
+
+#include "../../Decoder_SISO_SIHO.hpp"
+
+namespace aff3ct
+{
+namespace module
+{
+// operations of the flattened SCAN decoding tree
+enum class polar_scan_op_t : unsigned char { F,   // LLRs of the left  child
+                                             G,   // LLRs of the right child
+                                             FB,  // feedback of the node from the feedbacks of its children
+                                             S }; // saturated feedback of a rate 0 sub-tree
+
+template <typename B = int, typename R = float,
+          class API_polar = tools::API_polar_dynamic_seq<B, R, tools::f_LLR <  R>,
+                                                               tools::g_LLR <B,R>,
+                                                               tools::g0_LLR<  R>,
+                                                               tools::h_LLR <B,R>,
+                                                               tools::xo_STD<B  >>>
+class Decoder_polar_SCAN_fast : public Decoder_SISO_SIHO<B,R>, public tools::Frozenbits_notifier
+{
+protected:
+	struct polar_scan_op
+	{
+		polar_scan_op_t type;
+		int             layer; // layer of the node (the children are in the layer 'layer -1')
+		int             off;   // position of the first bit of the node
+	};
+
+	const int m;        // coded bits log-length
+	const int max_iter;
+
+	const std::vector<bool>& frozen_bits;
+
+	// the LLRs and the feedbacks of the layer 't' are stored in [t * N, (t +1) * N) (times the number of frames in
+	// the SIMD registers for the inter-frame implementation)
+	mipp::vector<R> l;   // soft graph
+	mipp::vector<R> b;   // feedback graph
+	mipp::vector<R> tmp;
+
+	std::vector<int>           n_info;     // number of information bits before each position
+	std::vector<polar_scan_op> ops;        // one SCAN iteration (the rate 0 and rate 1 sub-trees are skipped)
+	std::vector<polar_scan_op> ops_leaves; // one SCAN iteration that also computes the LLRs of all the leaves
+
+	bool is_init;
+
+public:
+	Decoder_polar_SCAN_fast(const int &K, const int &N, const int &max_iter, const std::vector<bool> &frozen_bits,
+	                        const int n_frames = 1);
+	virtual ~Decoder_polar_SCAN_fast();
+
+	void reset();
+
+	virtual void notify_frozenbits_update();
+
+protected:
+	        void _load_init     (                                          );
+	        void _load          (const R *Y_N                              );
+	        void _decode        (const bool leaves                         );
+	virtual void _decode_siho   (const R *Y_N,  B *V_K , const int frame_id);
+	        void _decode_siho_cw(const R *Y_N,  B *V_N , const int frame_id);
+	virtual void _decode_siso   (const R *Y_N1, R *Y_N2, const int frame_id);
+	virtual void _store         (               B *V_K                     );
+	        void _store_cw      (               B *V_N                     );
+
+	        void flatten_tree   (const int layer, const int off, const bool leaves, std::vector<polar_scan_op> &ops);
+
+private:
+	inline void _f (const R *l_a, const R *l_b, R *l_c, const int n_elmts);
+	inline void _g0(const R *l_a, const R *l_b, R *l_c, const int n_elmts);
+};
+}
+}
+
+#include "Decoder_polar_SCAN_fast.hxx"
+
+#endif /* DECODER_POLAR_SCAN_FAST_H_ */
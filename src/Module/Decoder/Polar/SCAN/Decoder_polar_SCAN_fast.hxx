@@ -0,0 +1,309 @@
+#include <cmath>
+#include <sstream>
+#include <algorithm>
+
+#include "Tools/Exception/exception.hpp"
+#include "Tools/Math/utils.h"
+#include "Tools/Perf/Reorderer/Reorderer.hpp"
+
+#include "Decoder_polar_SCAN_fast.hpp"
+
+namespace aff3ct
+{
+namespace module
+{
+template <typename B, typename R, class API_polar>
+Decoder_polar_SCAN_fast<B,R,API_polar>
+::Decoder_polar_SCAN_fast(const int &K, const int &N, const int &max_iter, const std::vector<bool> &frozen_bits,
+                          const int n_frames)
+: Decoder               (K, N, n_frames, API_polar::get_n_frames()),
+  Decoder_SISO_SIHO<B,R>(K, N, n_frames, API_polar::get_n_frames()),
+  m                     ((int)std::log2(N)),
+  max_iter              (max_iter         ),
+  frozen_bits           (frozen_bits      ),
+  l                     ((m +1) * N * API_polar::get_n_frames()),
+  b                     ((m +1) * N * API_polar::get_n_frames()),
+  tmp                   (std::max(1, N / 2) * API_polar::get_n_frames()),
+  n_info                (N +1             ),
+  is_init               (false            )
+{
+	const std::string name = "Decoder_polar_SCAN_fast";
+	this->set_name(name);
+
+	if (!tools::is_power_of_2(this->N))
+	{
+		std::stringstream message;
+		message << "'N' has to be a power of 2 ('N' = " << N << ").";
+		throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	if (this->N != (int)frozen_bits.size())
+	{
+		std::stringstream message;
+		message << "'frozen_bits.size()' has to be equal to 'N' ('frozen_bits.size()' = " << frozen_bits.size()
+		        << ", 'N' = " << N << ").";
+		throw tools::length_error(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	auto k = 0; for (auto i = 0; i < this->N; i++) if (frozen_bits[i] == 0) k++;
+	if (this->K != k)
+	{
+		std::stringstream message;
+		message << "The number of information bits in the frozen_bits is invalid ('K' = " << K << ", 'k' = "
+		        << k << ").";
+		throw tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	if (max_iter <= 0)
+	{
+		std::stringstream message;
+		message << "'max_iter' has to be greater than 0 ('max_iter' = " << max_iter << ").";
+		throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	this->notify_frozenbits_update();
+}
+
+template <typename B, typename R, class API_polar>
+Decoder_polar_SCAN_fast<B,R,API_polar>
+::~Decoder_polar_SCAN_fast()
+{
+}
+
+template <typename B, typename R, class API_polar>
+void Decoder_polar_SCAN_fast<B,R,API_polar>
+::reset()
+{
+	this->is_init = false;
+}
+
+template <typename B, typename R, class API_polar>
+void Decoder_polar_SCAN_fast<B,R,API_polar>
+::notify_frozenbits_update()
+{
+	n_info[0] = 0;
+	for (auto i = 0; i < this->N; i++)
+		n_info[i +1] = n_info[i] + (frozen_bits[i] ? 0 : 1);
+
+	this->ops       .clear();
+	this->ops_leaves.clear();
+	if (m > 0 && n_info[this->N] > 0)
+	{
+		if (n_info[this->N] < this->N)
+			this->flatten_tree(m, 0, false, this->ops);
+		this->flatten_tree(m, 0, true, this->ops_leaves);
+	}
+
+	this->is_init = false;
+}
+
+template <typename B, typename R, class API_polar>
+void Decoder_polar_SCAN_fast<B,R,API_polar>
+::flatten_tree(const int layer, const int off, const bool leaves, std::vector<polar_scan_op> &ops)
+{
+	const auto n_elmts = 1 << (layer -1);
+
+	for (auto c = 0; c < 2; c++)
+	{
+		const auto off_c = off + c * n_elmts;
+		const auto k_c   = n_info[off_c + n_elmts] - n_info[off_c];
+
+		if (k_c == 0)
+		{
+			// the feedback of a rate 0 sub-tree is saturated and its LLRs are never read (the feedback of the
+			// leaves is initialized once in '_load_init')
+			if (layer > 1)
+				ops.push_back({polar_scan_op_t::S, layer -1, off_c});
+		}
+		else if (k_c < n_elmts || leaves)
+		{
+			// the feedback of a rate 1 sub-tree is always 0: it is only visited when the LLRs of the leaves are
+			// required
+			ops.push_back({c == 0 ? polar_scan_op_t::F : polar_scan_op_t::G, layer, off});
+			if (layer > 1)
+				this->flatten_tree(layer -1, off_c, leaves, ops);
+		}
+	}
+
+	if (n_info[off + 2 * n_elmts] - n_info[off] < 2 * n_elmts)
+		ops.push_back({polar_scan_op_t::FB, layer, off});
+}
+
+template <typename B, typename R, class API_polar>
+void Decoder_polar_SCAN_fast<B,R,API_polar>
+::_f(const R *l_a, const R *l_b, R *l_c, const int n_elmts)
+{
+	// the intra-frame SIMD functions process at least one full register, the smallest nodes are computed sequentially
+	if (API_polar::get_n_frames() == 1 && n_elmts < mipp::nElReg<R>())
+		tools::API_polar_dynamic_seq<B,R>::f(l_a, l_b, l_c, n_elmts);
+	else
+		API_polar::f(l_a, l_b, l_c, n_elmts);
+}
+
+template <typename B, typename R, class API_polar>
+void Decoder_polar_SCAN_fast<B,R,API_polar>
+::_g0(const R *l_a, const R *l_b, R *l_c, const int n_elmts)
+{
+	if (API_polar::get_n_frames() == 1 && n_elmts < mipp::nElReg<R>())
+		tools::API_polar_dynamic_seq<B,R>::g0(l_a, l_b, l_c, n_elmts);
+	else
+		API_polar::g0(l_a, l_b, l_c, n_elmts);
+}
+
+template <typename B, typename R, class API_polar>
+void Decoder_polar_SCAN_fast<B,R,API_polar>
+::_load_init()
+{
+	constexpr int n_frames = API_polar::get_n_frames();
+
+	std::fill(l.begin(), l.end(), tools::init_LLR<R>());
+	std::fill(b.begin(), b.end(), tools::init_LLR<R>());
+
+	// the feedback of the frozen leaves is saturated
+	for (auto i = 0; i < this->N; i++)
+		if (frozen_bits[i])
+			std::fill(b.begin() + (i +0) * n_frames, b.begin() + (i +1) * n_frames, tools::sat_val<R>());
+
+	this->is_init = true;
+}
+
+template <typename B, typename R, class API_polar>
+void Decoder_polar_SCAN_fast<B,R,API_polar>
+::_load(const R *Y_N)
+{
+	constexpr int n_frames = API_polar::get_n_frames();
+
+	if (!this->is_init)
+		_load_init();
+
+	auto l_root = l.data() + m * this->N * n_frames;
+	if (n_frames == 1)
+		std::copy(Y_N, Y_N + this->N, l_root);
+	else
+	{
+		std::vector<const R*> frames(n_frames);
+		for (auto f = 0; f < n_frames; f++)
+			frames[f] = Y_N + f * this->N;
+		tools::Reorderer_static<R,n_frames>::apply(frames, l_root, this->N);
+	}
+}
+
+template <typename B, typename R, class API_polar>
+void Decoder_polar_SCAN_fast<B,R,API_polar>
+::_decode(const bool leaves)
+{
+	constexpr int n_frames = API_polar::get_n_frames();
+	const auto N = this->N;
+
+	for (auto iter = 0; iter < max_iter; iter++)
+	{
+		const auto &cur_ops = (leaves && iter == max_iter -1) ? this->ops_leaves : this->ops;
+		for (const auto &op : cur_ops)
+		{
+			if (op.type == polar_scan_op_t::S)
+			{
+				const auto b_node = b.begin() + (op.layer * N + op.off) * n_frames;
+				std::fill(b_node, b_node + (1 << op.layer) * n_frames, tools::sat_val<R>());
+				continue;
+			}
+
+			const auto n_elmts = 1 << (op.layer -1);
+			const auto l_up    = l.data() + ((op.layer   ) * N + op.off) * n_frames; // LLRs of the node
+			const auto b_up    = b.data() + ((op.layer   ) * N + op.off) * n_frames; // feedback of the node
+			const auto l_ch    = l.data() + ((op.layer -1) * N + op.off) * n_frames; // LLRs of the children
+			const auto b_ch    = b.data() + ((op.layer -1) * N + op.off) * n_frames; // feedback of the children
+			const auto l_dw    = l_up + n_elmts * n_frames;
+			const auto b_dw    = b_up + n_elmts * n_frames;
+			const auto l_ch_dw = l_ch + n_elmts * n_frames;
+			const auto b_ch_dw = b_ch + n_elmts * n_frames;
+
+			switch (op.type)
+			{
+				case polar_scan_op_t::F:
+					_g0(l_dw, b_ch_dw, tmp.data(), n_elmts);
+					_f (l_up, tmp.data(), l_ch, n_elmts);
+					break;
+				case polar_scan_op_t::G:
+					_f (b_ch, l_up, tmp.data(), n_elmts);
+					_g0(l_dw, tmp.data(), l_ch_dw, n_elmts);
+					break;
+				case polar_scan_op_t::FB:
+					_g0(b_ch_dw, l_dw, tmp.data(), n_elmts);
+					_f (b_ch, tmp.data(), b_up, n_elmts);
+					_f (b_ch, l_up, tmp.data(), n_elmts);
+					_g0(b_ch_dw, tmp.data(), b_dw, n_elmts);
+					break;
+				default:
+					break;
+			}
+		}
+	}
+}
+
+template <typename B, typename R, class API_polar>
+void Decoder_polar_SCAN_fast<B,R,API_polar>
+::_decode_siho(const R *Y_N, B *V_K, const int frame_id)
+{
+	this->_load(Y_N);
+	this->_decode(true);
+	this->_store(V_K);
+}
+
+template <typename B, typename R, class API_polar>
+void Decoder_polar_SCAN_fast<B,R,API_polar>
+::_decode_siho_cw(const R *Y_N, B *V_N, const int frame_id)
+{
+	this->_load(Y_N);
+	this->_decode(false);
+	this->_store_cw(V_N);
+}
+
+template <typename B, typename R, class API_polar>
+void Decoder_polar_SCAN_fast<B,R,API_polar>
+::_decode_siso(const R *Y_N1, R *Y_N2, const int frame_id)
+{
+	constexpr int n_frames = API_polar::get_n_frames();
+
+	this->_load(Y_N1);
+	this->_decode(false);
+
+	const auto b_root = b.data() + m * this->N * n_frames;
+	if (n_frames == 1)
+		std::copy(b_root, b_root + this->N, Y_N2);
+	else
+	{
+		std::vector<R*> frames(n_frames);
+		for (auto f = 0; f < n_frames; f++)
+			frames[f] = Y_N2 + f * this->N;
+		tools::Reorderer_static<R,n_frames>::apply_rev(b_root, frames, this->N);
+	}
+}
+
+template <typename B, typename R, class API_polar>
+void Decoder_polar_SCAN_fast<B,R,API_polar>
+::_store(B *V_K)
+{
+	constexpr int n_frames = API_polar::get_n_frames();
+
+	for (auto f = 0; f < n_frames; f++)
+	{
+		auto k = 0;
+		for (auto i = 0; i < this->N; i++)
+			if (!frozen_bits[i])
+				V_K[f * this->K + k++] = tools::h_LLR<B,R>(l[i * n_frames + f]);
+	}
+}
+
+template <typename B, typename R, class API_polar>
+void Decoder_polar_SCAN_fast<B,R,API_polar>
+::_store_cw(B *V_N)
+{
+	constexpr int n_frames = API_polar::get_n_frames();
+
+	const auto off = m * this->N * n_frames;
+	for (auto f = 0; f < n_frames; f++)
+		for (auto i = 0; i < this->N; i++)
+			V_N[f * this->N + i] = tools::h_LLR<B,R>(b[off + i * n_frames + f] + l[off + i * n_frames + f]);
+}
+}
+}
@@ -0,0 +1,36 @@
+#ifndef DECODER_POLAR_SCAN_FAST_SYS_
+#define DECODER_POLAR_SCAN_FAST_SYS_
+
+#include <vector>
+
+#include "Decoder_polar_SCAN_fast.hpp"
+
+namespace aff3ct
+{
+namespace module
+{
+template <typename B = int, typename R = float,
+          class API_polar = tools::API_polar_dynamic_seq<B, R, tools::f_LLR <  R>,
+                                                               tools::g_LLR <B,R>,
+                                                               tools::g0_LLR<  R>,
+                                                               tools::h_LLR <B,R>,
+                                                               tools::xo_STD<B  >>>
+class Decoder_polar_SCAN_fast_sys : public Decoder_polar_SCAN_fast<B,R,API_polar>
+{
+public:
+	Decoder_polar_SCAN_fast_sys(const int &K, const int &N, const int &max_iter, const std::vector<bool> &frozen_bits,
+	                            const int n_frames = 1);
+	virtual ~Decoder_polar_SCAN_fast_sys();
+
+protected:
+	void _decode_siho(const R *Y_N, B *V_K, const int frame_id);
+	void _decode_siso(const R *sys, const R *par, R *ext, const int frame_id);
+	void _decode_siso(const R *Y_N1, R *Y_N2, const int frame_id);
+	void _store(B *V_K);
+};
+}
+}
+
+#include "Decoder_polar_SCAN_fast_sys.hxx"
+
+#endif /* DECODER_POLAR_SCAN_FAST_SYS_ */
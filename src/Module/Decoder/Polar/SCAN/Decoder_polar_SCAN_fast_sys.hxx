@@ -0,0 +1,89 @@
+#include "Decoder_polar_SCAN_fast_sys.hpp"
+
+namespace aff3ct
+{
+namespace module
+{
+template <typename B, typename R, class API_polar>
+Decoder_polar_SCAN_fast_sys<B,R,API_polar>
+::Decoder_polar_SCAN_fast_sys(const int &K, const int &N, const int &max_iter, const std::vector<bool> &frozen_bits,
+                              const int n_frames)
+: Decoder(K, N, n_frames, API_polar::get_n_frames()),
+  Decoder_polar_SCAN_fast<B,R,API_polar>(K, N, max_iter, frozen_bits, n_frames)
+{
+	const std::string name = "Decoder_polar_SCAN_fast_sys";
+	this->set_name(name);
+}
+
+template <typename B, typename R, class API_polar>
+Decoder_polar_SCAN_fast_sys<B,R,API_polar>
+::~Decoder_polar_SCAN_fast_sys()
+{
+}
+
+template <typename B, typename R, class API_polar>
+void Decoder_polar_SCAN_fast_sys<B,R,API_polar>
+::_decode_siho(const R *Y_N, B *V_K, const int frame_id)
+{
+	// the systematic bits are decided from the root of the graph: the LLRs of the leaves are not required
+	this->_load(Y_N);
+	this->_decode(false);
+	this->_store(V_K);
+}
+
+template <typename B, typename R, class API_polar>
+void Decoder_polar_SCAN_fast_sys<B,R,API_polar>
+::_decode_siso(const R *sys, const R *par, R *ext, const int frame_id)
+{
+	constexpr int n_frames = API_polar::get_n_frames();
+
+	// ----------------------------------------------------------------------------------------------------------- LOAD
+	this->_load_init();
+
+	const auto off = this->m * this->N * n_frames;
+	for (auto f = 0; f < n_frames; f++)
+	{
+		auto sys_idx = 0, par_idx = 0;
+		for (auto i = 0; i < this->N; i++)
+			this->l[off + i * n_frames + f] = (!this->frozen_bits[i]) ? sys[f *            this->K  + sys_idx++]
+			                                                          : par[f * (this->N - this->K) + par_idx++];
+	}
+
+	// --------------------------------------------------------------------------------------------------------- DECODE
+	this->_decode(false);
+
+	// ---------------------------------------------------------------------------------------------------------- STORE
+	for (auto f = 0; f < n_frames; f++)
+	{
+		auto sys_idx = 0;
+		for (auto i = 0; i < this->N; i++)
+			if (!this->frozen_bits[i]) // if "i" is NOT a frozen bit (information bit = sytematic bit)
+				ext[f * this->K + sys_idx++] = this->b[off + i * n_frames + f];
+	}
+}
+
+template <typename B, typename R, class API_polar>
+void Decoder_polar_SCAN_fast_sys<B,R,API_polar>
+::_decode_siso(const R *Y_N1, R *Y_N2, const int frame_id)
+{
+	Decoder_polar_SCAN_fast<B,R,API_polar>::_decode_siso(Y_N1, Y_N2, frame_id);
+}
+
+template <typename B, typename R, class API_polar>
+void Decoder_polar_SCAN_fast_sys<B,R,API_polar>
+::_store(B *V_K)
+{
+	constexpr int n_frames = API_polar::get_n_frames();
+
+	const auto off = this->m * this->N * n_frames;
+	for (auto f = 0; f < n_frames; f++)
+	{
+		auto k = 0;
+		for (auto i = 0; i < this->N; i++)
+			if (!this->frozen_bits[i]) // if i is not a frozen bit
+				V_K[f * this->K + k++] = tools::h_LLR<B,R>(this->b[off + i * n_frames + f] +
+				                                           this->l[off + i * n_frames + f]);
+	}
+}
+}
+}
@@ -0,0 +1,51 @@
+#ifndef DECODER_POLAR_SCL_INTER_FAST_CA_SYS
+#define DECODER_POLAR_SCL_INTER_FAST_CA_SYS
+
+#include "Tools/Code/Polar/decoder_polar_functions.h"
+#include "Tools/Code/Polar/API/API_polar_static_inter.hpp"
+#include "Module/CRC/CRC.hpp"
+
+#include "../Decoder_polar_SCL_inter_fast_sys.hpp"
+
+namespace aff3ct
+{
+namespace module
+{
+/*!
+ * \class Decoder_polar_SCL_inter_fast_CA_sys
+ *
+ * \brief CRC aided version of the inter-frame SIMD SCL decoder: in each frame, the best path is the path with the
+ *        best metric among the paths which verify the CRC.
+ */
+template <typename B = int, typename R = float,
+          class API_polar = tools::API_polar_static_inter<B, R, tools::f_LLR_i <  R>,
+                                                                tools::g_LLR_i <B,R>,
+                                                                tools::g0_LLR_i<  R>,
+                                                                tools::h_LLR_i <B,R>,
+                                                                tools::xo_STD_i<B  >>>
+class Decoder_polar_SCL_inter_fast_CA_sys : public Decoder_polar_SCL_inter_fast_sys<B,R,API_polar>
+{
+protected:
+	CRC<B>& crc;
+	std::vector<mipp::vector<B>> U_paths;   // information bits of the paths (interleaved frames)
+	std::vector<bool>            extracted; // true if the information bits of a path are in U_paths
+	std::vector<B>               U_test;    // information bits of a path in a frame
+	std::vector<int>             order;     // paths of a frame sorted by metrics
+
+public:
+	Decoder_polar_SCL_inter_fast_CA_sys(const int& K, const int& N, const int& L, const std::vector<bool>& frozen_bits,
+	                                    CRC<B>& crc, const int n_frames = 1);
+
+	virtual ~Decoder_polar_SCL_inter_fast_CA_sys(){};
+
+protected:
+	bool crc_check(const int path, const int frame);
+
+	virtual void select_best_path();
+};
+}
+}
+
+#include "Decoder_polar_SCL_inter_fast_CA_sys.hxx"
+
+#endif /* DECODER_POLAR_SCL_INTER_FAST_CA_SYS */
@@ -0,0 +1,82 @@
+#include <sstream>
+#include <numeric>
+#include <algorithm>
+
+#include "Tools/Exception/exception.hpp"
+#include "Tools/Code/Polar/fb_extract.h"
+
+#include "Decoder_polar_SCL_inter_fast_CA_sys.hpp"
+
+namespace aff3ct
+{
+namespace module
+{
+template <typename B, typename R, class API_polar>
+Decoder_polar_SCL_inter_fast_CA_sys<B,R,API_polar>
+::Decoder_polar_SCL_inter_fast_CA_sys(const int& K, const int& N, const int& L, const std::vector<bool>& frozen_bits,
+                                      CRC<B>& crc, const int n_frames)
+: Decoder(K, N, n_frames, API_polar::get_n_frames()),
+  Decoder_polar_SCL_inter_fast_sys<B,R,API_polar>(K, N, L, frozen_bits, n_frames),
+  crc(crc),
+  U_paths(L, mipp::vector<B>(K * API_polar::get_n_frames() + mipp::nElReg<B>())),
+  extracted(L, false),
+  U_test(K),
+  order(L)
+{
+	const std::string name = "Decoder_polar_SCL_inter_fast_CA_sys";
+	this->set_name(name);
+
+	if (crc.get_size() > K)
+	{
+		std::stringstream message;
+		message << "'crc.get_size()' has to be equal or smaller than 'K' ('crc.get_size()' = " << crc.get_size()
+		        << ", 'K' = " << K << ").";
+		throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+}
+
+template <typename B, typename R, class API_polar>
+bool Decoder_polar_SCL_inter_fast_CA_sys<B,R,API_polar>
+::crc_check(const int path, const int frame)
+{
+	constexpr int n_lanes = API_polar::get_n_frames();
+
+	// the information bits are extracted once for all the frames
+	if (!extracted[path])
+	{
+		tools::fb_extract<B,n_lanes>(this->polar_patterns.get_leaves_pattern_types(), this->s[path].data(),
+		                             U_paths[path].data());
+		extracted[path] = true;
+	}
+
+	for (auto k = 0; k < this->K; k++)
+		U_test[k] = U_paths[path][k * n_lanes + frame];
+
+	// check the CRC
+	return crc.check(U_test, 1);
+}
+
+template <typename B, typename R, class API_polar>
+void Decoder_polar_SCL_inter_fast_CA_sys<B,R,API_polar>
+::select_best_path()
+{
+	std::fill(extracted.begin(), extracted.end(), false);
+
+	for (auto f = 0; f < API_polar::get_n_frames(); f++)
+	{
+		const auto &metrics = this->metrics[f];
+
+		std::iota(order.begin(), order.begin() + this->n_active_paths, 0);
+		std::sort(order.begin(), order.begin() + this->n_active_paths,
+			[&metrics](int x, int y){
+				return metrics[x] < metrics[y];
+			});
+
+		auto i = 0;
+		while (i < this->n_active_paths && !crc_check(order[i], f)) i++;
+
+		this->best_path[f] = (i == this->n_active_paths) ? order[0] : order[i];
+	}
+}
+}
+}
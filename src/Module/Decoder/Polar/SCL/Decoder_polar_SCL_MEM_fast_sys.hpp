@@ -7,6 +7,7 @@
 
 #include "Tools/Code/Polar/API/API_polar_dynamic_seq.hpp"
 #include "Tools/Algo/Sort/LC_sorter.hpp"
+#include "Tools/Algo/Sort/LC_sorter_bitonic.hpp"
 #include "Tools/Code/Polar/decoder_polar_functions.h"
 #include "Tools/Code/Polar/Frozenbits_notifier.hpp"
 #include "Tools/Code/Polar/Pattern_polar_parser.hpp"
@@ -54,6 +55,7 @@ protected:
 
 	tools::LC_sorter<R>               sorter;
 //	tools::LC_sorter_simd<R>          sorter_simd;
+	tools::LC_sorter_bitonic<R>       sorter_paths;   // selects the best candidates among the path metrics
 	std::vector<int>                  best_idx;
 	mipp::vector<R>                   l_tmp;
 
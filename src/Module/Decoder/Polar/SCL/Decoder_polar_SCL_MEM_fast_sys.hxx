@@ -67,6 +67,7 @@ Decoder_polar_SCL_MEM_fast_sys<B,R,API_polar>
   path_2_array_s   (L, std::vector<int>(m)),
   sorter           (N),
 //sorter_simd      (N),
+  sorter_paths     (8 * L),
   best_idx         (L),
   l_tmp            (N)
 {
@@ -152,6 +153,7 @@ Decoder_polar_SCL_MEM_fast_sys<B,R,API_polar>
   path_2_array_s     (L, std::vector<int>(m)),
   sorter           (N),
 //sorter_simd      (N),
+  sorter_paths     (8 * L),
   best_idx         (L),
   l_tmp            (N)
 {
@@ -164,6 +166,12 @@ Decoder_polar_SCL_MEM_fast_sys<B,R,API_polar>
 	if (API_polar::get_n_frames() != 1)
 		throw tools::invalid_argument(__FILE__, __LINE__, __func__, "The inter-frame API_polar is not supported.");
 
+	if (this->polar_patterns.exist_node_type(tools::polar_node_t::G_REP_R1)  ||
+	    this->polar_patterns.exist_node_type(tools::polar_node_t::G_REP_SPC) ||
+	    this->polar_patterns.exist_node_type(tools::polar_node_t::G_PC)      ||
+	    this->polar_patterns.exist_node_type(tools::polar_node_t::G_PC_REP))
+		throw tools::invalid_argument(__FILE__, __LINE__, __func__, "The generalized nodes are not supported.");
+
 	if (!tools::is_power_of_2(this->N))
 	{
 		std::stringstream message;
@@ -698,7 +706,7 @@ void Decoder_polar_SCL_MEM_fast_sys<B,R,API_polar>
 
 		// L first of the lists are the L best paths
 		const auto n_list = (n_active_paths * 4 >= L) ? L : n_active_paths * 4;
-		sorter.partial_sort(metrics_vec[1].data(), best_idx, L * 4, n_list);
+		sorter_paths.partial_sort(metrics_vec[1].data(), best_idx, L * 4, n_list);
 
 		// count the number of duplications per path
 		for (auto i = 0; i < n_list; i++)
@@ -782,7 +790,7 @@ void Decoder_polar_SCL_MEM_fast_sys<B,R,API_polar>
 
 		// L first of the lists are the L best paths
 		const auto n_list = (n_active_paths * 4 >= L) ? L : n_active_paths * 4;
-		sorter.partial_sort(metrics_vec[1].data(), best_idx, L * 4, n_list);
+		sorter_paths.partial_sort(metrics_vec[1].data(), best_idx, L * 4, n_list);
 
 		// count the number of duplications per path
 		for (auto i = 0; i < n_list; i++)
@@ -876,7 +884,7 @@ void Decoder_polar_SCL_MEM_fast_sys<B,R,API_polar>
 	else // n_active_paths == L
 	{
 		// sort hypothetic metrics
-		sorter.partial_sort(metrics_vec[0].data(), best_idx, L * 2, L);
+		sorter_paths.partial_sort(metrics_vec[0].data(), best_idx, L * 2, L);
 
 		// count the number of duplications per path
 		for (auto i = 0; i < L; i++)
@@ -952,7 +960,7 @@ void Decoder_polar_SCL_MEM_fast_sys<B,R,API_polar>
 	else // n_active_paths == L
 	{
 		// sort hypothetic metrics
-		sorter.partial_sort(metrics_vec[0].data(), best_idx, L * 2, L);
+		sorter_paths.partial_sort(metrics_vec[0].data(), best_idx, L * 2, L);
 
 		// count the number of duplications per path
 		for (auto i = 0; i < L; i++)
@@ -1072,7 +1080,7 @@ void Decoder_polar_SCL_MEM_fast_sys<B,R,API_polar>
 
 	// L first of the lists are the L best paths
 	const auto n_list = (n_active_paths * n_cands >= L) ? L : n_active_paths * n_cands;
-	sorter.partial_sort(metrics_vec[2].data(), best_idx, n_cands * L, n_list);
+	sorter_paths.partial_sort(metrics_vec[2].data(), best_idx, n_cands * L, n_list);
 
 	// count the number of duplications per path
 	for (auto i = 0; i < n_list; i++)
@@ -1184,7 +1192,7 @@ void Decoder_polar_SCL_MEM_fast_sys<B,R,API_polar>
 
 	// L first of the lists are the L best paths
 	const auto n_list = (n_active_paths * n_cands >= L) ? L : n_active_paths * n_cands;
-	sorter.partial_sort(metrics_vec[2].data(), best_idx, n_cands * L, n_list);
+	sorter_paths.partial_sort(metrics_vec[2].data(), best_idx, n_cands * L, n_list);
 
 	// count the number of duplications per path
 	for (auto i = 0; i < n_list; i++)
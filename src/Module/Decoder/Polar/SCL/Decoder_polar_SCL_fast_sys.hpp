@@ -7,6 +7,7 @@
 #include "Tools/Code/Polar/Pattern_polar_parser.hpp"
 #include "Tools/Code/Polar/API/API_polar_dynamic_seq.hpp"
 #include "Tools/Algo/Sort/LC_sorter.hpp"
+#include "Tools/Algo/Sort/LC_sorter_bitonic.hpp"
 //#include "Tools/Algo/Sort/LC_sorter_simd.hpp"
 #include "Tools/Code/Polar/decoder_polar_functions.h"
 #include "Tools/Code/Polar/Frozenbits_notifier.hpp"
@@ -49,6 +50,7 @@ protected:
 
 	tools::LC_sorter<R>               sorter;
 //	tools::LC_sorter_simd<R>          sorter_simd;
+	tools::LC_sorter_bitonic<R>       sorter_paths;   // selects the best candidates among the path metrics
 	std::vector<int>                  best_idx;
 	mipp::vector<R>                   l_tmp;
 
@@ -77,6 +79,8 @@ protected:
 	inline void update_paths_r1 (const int rev_depth, const int off_l, const int off_s, const int n_elmts);
 	inline void update_paths_rep(const int rev_depth, const int off_l, const int off_s, const int n_elmts);
 	inline void update_paths_spc(const int rev_depth, const int off_l, const int off_s, const int n_elmts);
+	inline void update_paths_g_rep(const R *Y_N, const int rev_depth, const int off_l, const int off_s,
+	                               const int n_elmts, const int n_sub, const bool spc);
 
 	// those methods are used by the generated SCL decoders
 	template <int REV_D, int N_ELMTS> inline void update_paths_r0 (const int off_l, const int off_s);
@@ -94,6 +94,7 @@ Decoder_polar_SCL_fast_sys<B,R,API_polar>
   path_2_array     (L, std::vector<int>(m)),
   sorter           (N),
 //sorter_simd      (N),
+  sorter_paths     (8 * L),
   best_idx         (L),
   l_tmp            (N)
 {
@@ -175,6 +176,7 @@ Decoder_polar_SCL_fast_sys<B,R,API_polar>
   path_2_array     (L, std::vector<int>(m)),
   sorter           (N),
 //sorter_simd      (N),
+  sorter_paths     (8 * L),
   best_idx         (L),
   l_tmp            (N)
 {
@@ -187,6 +189,10 @@ Decoder_polar_SCL_fast_sys<B,R,API_polar>
 	if (API_polar::get_n_frames() != 1)
 		throw tools::invalid_argument(__FILE__, __LINE__, __func__, "The inter-frame API_polar is not supported.");
 
+	if (this->polar_patterns.exist_node_type(tools::polar_node_t::G_PC) ||
+	    this->polar_patterns.exist_node_type(tools::polar_node_t::G_PC_REP))
+		throw tools::invalid_argument(__FILE__, __LINE__, __func__, "The G-PC nodes are not supported.");
+
 	if (!tools::is_power_of_2(this->N))
 	{
 		std::stringstream message;
@@ -334,13 +340,17 @@ void Decoder_polar_SCL_fast_sys<B,R,API_polar>
 	const int n_elm_2 = n_elmts >> 1;
 	const auto node_type = polar_patterns.get_node_type(node_id);
 
+	const bool is_g_rep_pattern = (node_type == tools::polar_node_t::G_REP_R1) ||
+	                              (node_type == tools::polar_node_t::G_REP_SPC);
+
 	const bool is_terminal_pattern = (node_type == tools::polar_node_t::RATE_0) ||
 	                                 (node_type == tools::polar_node_t::RATE_1) ||
 	                                 (node_type == tools::polar_node_t::REP)    ||
-	                                 (node_type == tools::polar_node_t::SPC);
+	                                 (node_type == tools::polar_node_t::SPC)    ||
+	                                 is_g_rep_pattern;
 
 	// root node
-	if (rev_depth == m)
+	if (rev_depth == m && !is_g_rep_pattern)
 	{
 		// f
 		switch (node_type)
@@ -511,6 +521,12 @@ void Decoder_polar_SCL_fast_sys<B,R,API_polar>
 			case tools::REP:    update_paths_rep(rev_depth, off_l, off_s, n_elmts); break;
 			case tools::RATE_1: update_paths_r1 (rev_depth, off_l, off_s, n_elmts); break;
 			case tools::SPC:    update_paths_spc(rev_depth, off_l, off_s, n_elmts); break;
+			case tools::G_REP_R1:
+				update_paths_g_rep(Y_N, rev_depth, off_l, off_s, n_elmts, polar_patterns.get_node_sub_size(node_id), false);
+				break;
+			case tools::G_REP_SPC:
+				update_paths_g_rep(Y_N, rev_depth, off_l, off_s, n_elmts, polar_patterns.get_node_sub_size(node_id), true);
+				break;
 			default:
 				break;
 		}
@@ -633,7 +649,7 @@ void Decoder_polar_SCL_fast_sys<B,R,API_polar>
 
 		// L first of the lists are the L best paths
 		const auto n_list = (n_active_paths * 4 >= L) ? L : n_active_paths * 4;
-		sorter.partial_sort(metrics_vec[1].data(), best_idx, L * 4, n_list);
+		sorter_paths.partial_sort(metrics_vec[1].data(), best_idx, L * 4, n_list);
 
 		// count the number of duplications per path
 		for (auto i = 0; i < n_list; i++)
@@ -717,7 +733,7 @@ void Decoder_polar_SCL_fast_sys<B,R,API_polar>
 
 		// L first of the lists are the L best paths
 		const auto n_list = (n_active_paths * 4 >= L) ? L : n_active_paths * 4;
-		sorter.partial_sort(metrics_vec[1].data(), best_idx, L * 4, n_list);
+		sorter_paths.partial_sort(metrics_vec[1].data(), best_idx, L * 4, n_list);
 
 		// count the number of duplications per path
 		for (auto i = 0; i < n_list; i++)
@@ -743,6 +759,66 @@ void Decoder_polar_SCL_fast_sys<B,R,API_polar>
 	}
 }
 
+template <typename B, typename R, class API_polar>
+void Decoder_polar_SCL_fast_sys<B,R,API_polar>
+::update_paths_g_rep(const R *Y_N, const int r_d, const int off_l, const int off_s, const int n_elmts,
+                     const int n_sub, const bool spc)
+{
+	const auto r_d_src = (int)std::log2(n_sub);
+	auto off_l_src = off_l;
+
+	for (auto i = 0; i < n_active_paths; i++)
+	{
+		const auto path = paths[i];
+		const R* node_l = (r_d == m) ? Y_N : l[path_2_array[path][r_d]].data() + off_l;
+
+		// the codeword is the repetition of the source: for each position of the source, the cost of the repetitions
+		// is min(A,B) (A: cost of the 0s, B: cost of the 1s) plus |A - B| if the decided bit is not the best one, the
+		// second term is the penalty of the source decoding on the folded LLRs
+		if (n_active_paths > 1)
+		{
+			auto pen = (R)0;
+			for (auto j = 0; j < n_sub; j++)
+			{
+				auto pen0 = (R)0;
+				auto pen1 = (R)0;
+				for (auto k = j; k < n_elmts; k += n_sub)
+				{
+					pen0 = sat_m<R>(pen0 + sat_m<R>(-std::min(node_l[k], (R)0)));
+					pen1 = sat_m<R>(pen1 + sat_m<R>(+std::max(node_l[k], (R)0)));
+				}
+				pen = sat_m<R>(pen + std::min(pen0, pen1));
+			}
+			metrics[path] = sat_m<R>(metrics[path] + pen);
+		}
+
+		// fold the LLRs down to the source (the left children are frozen)
+		auto parent = node_l;
+		auto cur_off = off_l;
+		for (auto rd = r_d; rd > r_d_src; rd--)
+		{
+			const auto n_elm_2 = 1 << (rd -1);
+			cur_off = (rd == m) ? 0 : cur_off + (n_elm_2 << 1);
+			const auto child = l[up_ref_array_idx(path, rd -1)].data() + cur_off;
+			API_polar::g0(parent, parent + n_elm_2, child, n_elm_2);
+			parent = child;
+		}
+		off_l_src = cur_off;
+	}
+
+	const auto off_s_src = off_s + n_elmts - n_sub;
+	if (spc) update_paths_spc(r_d_src, off_l_src, off_s_src, n_sub);
+	else     update_paths_r1 (r_d_src, off_l_src, off_s_src, n_sub);
+
+	// repeat the decoded source
+	for (auto i = 0; i < n_active_paths; i++)
+	{
+		const auto src = s[paths[i]].begin() + off_s_src;
+		for (auto off = off_s; off < off_s_src; off += n_sub)
+			std::copy(src, src + n_sub, s[paths[i]].begin() + off);
+	}
+}
+
 template <typename B, typename R, class API_polar>
 void Decoder_polar_SCL_fast_sys<B,R,API_polar>
 ::flip_bits_r1(const int old_path, const int new_path, const int dup, const int off_s, const int n_elmts)
@@ -811,7 +887,7 @@ void Decoder_polar_SCL_fast_sys<B,R,API_polar>
 	else // n_active_paths == L
 	{
 		// sort hypothetic metrics
-		sorter.partial_sort(metrics_vec[0].data(), best_idx, L * 2, L);
+		sorter_paths.partial_sort(metrics_vec[0].data(), best_idx, L * 2, L);
 
 		// count the number of duplications per path
 		for (auto i = 0; i < L; i++)
@@ -887,7 +963,7 @@ void Decoder_polar_SCL_fast_sys<B,R,API_polar>
 	else // n_active_paths == L
 	{
 		// sort hypothetic metrics
-		sorter.partial_sort(metrics_vec[0].data(), best_idx, L * 2, L);
+		sorter_paths.partial_sort(metrics_vec[0].data(), best_idx, L * 2, L);
 
 		// count the number of duplications per path
 		for (auto i = 0; i < L; i++)
@@ -1007,7 +1083,7 @@ void Decoder_polar_SCL_fast_sys<B,R,API_polar>
 
 	// L first of the lists are the L best paths
 	const auto n_list = (n_active_paths * n_cands >= L) ? L : n_active_paths * n_cands;
-	sorter.partial_sort(metrics_vec[2].data(), best_idx, n_cands * L, n_list);
+	sorter_paths.partial_sort(metrics_vec[2].data(), best_idx, n_cands * L, n_list);
 
 	// count the number of duplications per path
 	for (auto i = 0; i < n_list; i++)
@@ -1119,7 +1195,7 @@ void Decoder_polar_SCL_fast_sys<B,R,API_polar>
 
 	// L first of the lists are the L best paths
 	const auto n_list = (n_active_paths * n_cands >= L) ? L : n_active_paths * n_cands;
-	sorter.partial_sort(metrics_vec[2].data(), best_idx, n_cands * L, n_list);
+	sorter_paths.partial_sort(metrics_vec[2].data(), best_idx, n_cands * L, n_list);
 
 	// count the number of duplications per path
 	for (auto i = 0; i < n_list; i++)
@@ -0,0 +1,108 @@
+#ifndef DECODER_POLAR_SCL_INTER_FAST_SYS
+#define DECODER_POLAR_SCL_INTER_FAST_SYS
+
+#include <vector>
+#include <mipp.h>
+
+#include "Tools/Code/Polar/Pattern_polar_parser.hpp"
+#include "Tools/Code/Polar/API/API_polar_static_inter.hpp"
+#include "Tools/Algo/Sort/LC_sorter_bitonic.hpp"
+#include "Tools/Code/Polar/decoder_polar_functions.h"
+#include "Tools/Code/Polar/Frozenbits_notifier.hpp"
+
+#include "../../Decoder_SIHO.hpp"
+
+namespace aff3ct
+{
+namespace module
+{
+/*!
+ * \class Decoder_polar_SCL_inter_fast_sys
+ *
+ * \brief Successive Cancellation List decoder of 'mipp::nElReg<R>()' frames at once (inter-frame SIMD).
+ *
+ * The frames are interleaved in the LLRs and the partial sums arrays: the f, g and xor functions of the API_polar are
+ * applied to all the frames at once. Each frame (each lane of the SIMD registers) has its own list of L paths: the path
+ * 'p' of the frame 'f' is stored in the lane 'f' of the arrays 'p'. The path metrics, the sort of the candidates and
+ * the duplications of the paths are made per frame, a path is duplicated in a frame by copying its lane with a masked
+ * blend (the other frames are not modified). The number of active paths only depends on the frozen bits, it is the
+ * same for all the frames.
+ *
+ * The rate 0, REP, rate 0 left and REP left nodes are used, the other nodes are split down to the information bits:
+ * the list decoding of the rate 1 and SPC nodes is exact (no Chase approximation like in the intra-frame decoders).
+ */
+template <typename B = int, typename R = float,
+          class API_polar = tools::API_polar_static_inter<B, R, tools::f_LLR_i <  R>,
+                                                                tools::g_LLR_i <B,R>,
+                                                                tools::g0_LLR_i<  R>,
+                                                                tools::h_LLR_i <B,R>,
+                                                                tools::xo_STD_i<B  >>>
+class Decoder_polar_SCL_inter_fast_sys : public Decoder_SIHO<B,R>, public tools::Frozenbits_notifier
+{
+protected:
+	static constexpr int n_lanes = API_polar::get_n_frames(); // number of frames decoded at once
+
+	const int                         m;              // graph depth
+	const int                         L;              // maximum paths number
+	const std::vector<bool>&          frozen_bits;
+	      tools::Pattern_polar_parser polar_patterns;
+
+	            int                   n_active_paths; // same number of active paths in all the frames
+	            mipp::vector<R>       y;              // channel llrs (interleaved frames)
+	std::vector<mipp::vector<R>>      l;              // llrs of the paths (interleaved frames)
+	std::vector<mipp::vector<B>>      s;              // partial sums of the paths (interleaved frames)
+	            mipp::vector<B>       s_bis;          // partial sums of the best paths (interleaved frames)
+	            mipp::vector<B>       U_bis;          // information bits of the best paths (interleaved frames)
+
+	// each following 2D vector is of size n_lanes * L (or n_lanes * 2L), one list per frame
+	std::vector<std::vector<R>>       metrics;        // path metrics
+	std::vector<std::vector<R>>       metrics_vec;    // metrics of the candidates to be sorted
+	std::vector<std::vector<int>>     src_path;       // path from which a path is duplicated
+	std::vector<std::vector<B>>       dec_bits;       // value of the bits decided in a path
+	            std::vector<int>      best_path;      // best path of each frame
+
+	tools::LC_sorter_bitonic<R>       sorter_paths;   // selects the best candidates among the path metrics
+	            std::vector<int>      best_idx;
+	            std::vector<int>      dup_count;
+	            std::vector<int>      free_paths;
+	            std::vector<R>        pen0;
+	            std::vector<R>        pen1;
+
+public:
+	Decoder_polar_SCL_inter_fast_sys(const int& K, const int& N, const int& L, const std::vector<bool>& frozen_bits,
+	                                 const int n_frames = 1);
+
+	virtual ~Decoder_polar_SCL_inter_fast_sys();
+
+	virtual void notify_frozenbits_update();
+
+protected:
+	        void _load          (const R *Y_N                            );
+	virtual void _decode        (                                        );
+	        void _decode_siho   (const R *Y_N, B *V_K, const int frame_id);
+	        void _decode_siho_cw(const R *Y_N, B *V_N, const int frame_id);
+	virtual void _store         (              B *V_K                    );
+	virtual void _store_cw      (              B *V_N                    );
+
+	virtual void init_buffers    ();
+	virtual void select_best_path();
+
+	void recursive_decode(const int off_l, const int off_s, const int rev_depth, int &node_id);
+
+	void update_paths_r0 (const int rev_depth, const int off_l, const int off_s, const int n_elmts);
+	void update_paths_rep(const int rev_depth, const int off_l, const int off_s, const int n_elmts);
+
+	void gather_best_paths();
+
+private:
+	inline const R* node_llrs(const int path, const int rev_depth, const int off_l) const;
+
+	template <typename T>
+	inline void copy_lanes(const T *src, T *dst, const bool lanes[], const int n_elmts);
+};
+}
+}
+
+#include "Decoder_polar_SCL_inter_fast_sys.hxx"
+
+#endif /* DECODER_POLAR_SCL_INTER_FAST_SYS */
@@ -0,0 +1,504 @@
+#include <algorithm>
+#include <sstream>
+#include <limits>
+#include <cmath>
+#include <mipp.h>
+
+#include "Tools/Exception/exception.hpp"
+#include "Tools/Math/utils.h"
+#include "Tools/Perf/Reorderer/Reorderer.hpp"
+
+#include "Tools/Code/Polar/Patterns/Pattern_polar_r0.hpp"
+#include "Tools/Code/Polar/Patterns/Pattern_polar_r0_left.hpp"
+#include "Tools/Code/Polar/Patterns/Pattern_polar_r1.hpp"
+#include "Tools/Code/Polar/Patterns/Pattern_polar_rep.hpp"
+#include "Tools/Code/Polar/Patterns/Pattern_polar_rep_left.hpp"
+#include "Tools/Code/Polar/Patterns/Pattern_polar_std.hpp"
+
+#include "Tools/Code/Polar/fb_extract.h"
+
+#include "Decoder_polar_SCL_fast_sys.hpp"
+#include "Decoder_polar_SCL_inter_fast_sys.hpp"
+
+namespace aff3ct
+{
+namespace module
+{
+template <typename B, typename R, class API_polar>
+Decoder_polar_SCL_inter_fast_sys<B,R,API_polar>
+::Decoder_polar_SCL_inter_fast_sys(const int& K, const int& N, const int& L, const std::vector<bool>& frozen_bits,
+                                   const int n_frames)
+: Decoder          (K, N, n_frames, API_polar::get_n_frames()),
+  Decoder_SIHO<B,R>(K, N, n_frames, API_polar::get_n_frames()),
+  m                ((int)std::log2(N)),
+  L                (L),
+  frozen_bits      (frozen_bits),
+  polar_patterns   (N,
+                    frozen_bits,
+                    {new tools::Pattern_polar_std,
+                     new tools::Pattern_polar_r0,
+                     new tools::Pattern_polar_r1(0, 0), // the rate 1 nodes are split down to the information bits
+                     new tools::Pattern_polar_r0_left,
+                     new tools::Pattern_polar_rep_left,
+                     new tools::Pattern_polar_rep},
+                    1,
+                    2),
+  n_active_paths   (1),
+  y                (N * API_polar::get_n_frames() + mipp::nElReg<R>()),
+  l                (L, mipp::vector<R>(N * API_polar::get_n_frames() + mipp::nElReg<R>())),
+  s                (L, mipp::vector<B>(N * API_polar::get_n_frames() + mipp::nElReg<B>())),
+  s_bis            (N * API_polar::get_n_frames() + mipp::nElReg<B>()),
+  U_bis            (K * API_polar::get_n_frames() + mipp::nElReg<B>()),
+  metrics          (API_polar::get_n_frames(), std::vector<R>(L)),
+  metrics_vec      (API_polar::get_n_frames(), std::vector<R>(2 * L)),
+  src_path         (API_polar::get_n_frames(), std::vector<int>(L)),
+  dec_bits         (API_polar::get_n_frames(), std::vector<B>(L)),
+  best_path        (API_polar::get_n_frames(), 0),
+  sorter_paths     (2 * L),
+  best_idx         (L),
+  dup_count        (L),
+  free_paths       (L),
+  pen0             (API_polar::get_n_frames()),
+  pen1             (API_polar::get_n_frames())
+{
+	const std::string name = "Decoder_polar_SCL_inter_fast_sys";
+	this->set_name(name);
+
+	static_assert(sizeof(B) == sizeof(R), "Sizes of the bits and reals have to be identical.");
+	static_assert(API_polar::get_n_frames() == mipp::nElReg<R>(), "An inter-frame API_polar is required.");
+
+	if (!tools::is_power_of_2(this->N))
+	{
+		std::stringstream message;
+		message << "'N' has to be a power of 2 ('N' = " << N << ").";
+		throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	if (this->N != (int)frozen_bits.size())
+	{
+		std::stringstream message;
+		message << "'frozen_bits.size()' has to be equal to 'N' ('frozen_bits.size()' = " << frozen_bits.size()
+		        << ", 'N' = " << N << ").";
+		throw tools::length_error(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	if (this->L <= 0 || !tools::is_power_of_2(this->L))
+	{
+		std::stringstream message;
+		message << "'L' has to be a positive power of 2 ('L' = " << L << ").";
+		throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	auto k = 0; for (auto i = 0; i < this->N; i++) if (frozen_bits[i] == 0) k++;
+	if (this->K != k)
+	{
+		std::stringstream message;
+		message << "The number of information bits in the frozen_bits is invalid ('K' = " << K << ", 'k' = "
+		        << k << ").";
+		throw tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
+	}
+}
+
+template <typename B, typename R, class API_polar>
+Decoder_polar_SCL_inter_fast_sys<B,R,API_polar>
+::~Decoder_polar_SCL_inter_fast_sys()
+{
+	polar_patterns.release_patterns();
+}
+
+template <typename B, typename R, class API_polar>
+void Decoder_polar_SCL_inter_fast_sys<B,R,API_polar>
+::notify_frozenbits_update()
+{
+	polar_patterns.notify_frozenbits_update();
+}
+
+template <typename B, typename R, class API_polar>
+void Decoder_polar_SCL_inter_fast_sys<B,R,API_polar>
+::init_buffers()
+{
+	n_active_paths = 1;
+	for (auto f = 0; f < n_lanes; f++)
+		metrics[f][0] = std::numeric_limits<R>::min();
+}
+
+template <typename B, typename R, class API_polar>
+void Decoder_polar_SCL_inter_fast_sys<B,R,API_polar>
+::_load(const R *Y_N)
+{
+	std::vector<const R*> frames(n_lanes);
+	for (auto f = 0; f < n_lanes; f++)
+		frames[f] = Y_N + f * this->N;
+	tools::Reorderer_static<R,n_lanes>::apply(frames, y.data(), this->N);
+}
+
+template <typename B, typename R, class API_polar>
+void Decoder_polar_SCL_inter_fast_sys<B,R,API_polar>
+::_decode()
+{
+	int first_node_id = 0, off_l = 0, off_s = 0;
+	this->recursive_decode(off_l, off_s, m, first_node_id);
+}
+
+template <typename B, typename R, class API_polar>
+void Decoder_polar_SCL_inter_fast_sys<B,R,API_polar>
+::_decode_siho(const R *Y_N, B *V_K, const int frame_id)
+{
+	if (!API_polar::isAligned(Y_N))
+		throw tools::runtime_error(__FILE__, __LINE__, __func__, "'Y_N' is misaligned memory.");
+
+	if (!API_polar::isAligned(V_K))
+		throw tools::runtime_error(__FILE__, __LINE__, __func__, "'V_K' is misaligned memory.");
+
+	this->_load(Y_N);
+	this->init_buffers();
+	this->_decode();
+	this->select_best_path();
+	this->_store(V_K);
+}
+
+template <typename B, typename R, class API_polar>
+void Decoder_polar_SCL_inter_fast_sys<B,R,API_polar>
+::_decode_siho_cw(const R *Y_N, B *V_N, const int frame_id)
+{
+	if (!API_polar::isAligned(Y_N))
+		throw tools::runtime_error(__FILE__, __LINE__, __func__, "'Y_N' is misaligned memory.");
+
+	if (!API_polar::isAligned(V_N))
+		throw tools::runtime_error(__FILE__, __LINE__, __func__, "'V_N' is misaligned memory.");
+
+	this->_load(Y_N);
+	this->init_buffers();
+	this->_decode();
+	this->select_best_path();
+	this->_store_cw(V_N);
+}
+
+template <typename B, typename R, class API_polar>
+const R* Decoder_polar_SCL_inter_fast_sys<B,R,API_polar>
+::node_llrs(const int path, const int rev_depth, const int off_l) const
+{
+	// the llrs of the root node are the channel llrs, they are shared by all the paths
+	return (rev_depth == m) ? y.data() : l[path].data() + off_l * n_lanes;
+}
+
+template <typename B, typename R, class API_polar>
+void Decoder_polar_SCL_inter_fast_sys<B,R,API_polar>
+::recursive_decode(const int off_l, const int off_s, const int rev_depth, int &node_id)
+{
+	const int n_elmts = 1 << rev_depth;
+	const int n_elm_2 = n_elmts >> 1;
+	const auto node_type = polar_patterns.get_node_type(node_id);
+
+	const bool is_terminal_pattern = (node_type == tools::polar_node_t::RATE_0) ||
+	                                 (node_type == tools::polar_node_t::RATE_1) ||
+	                                 (node_type == tools::polar_node_t::REP);
+
+	if (!is_terminal_pattern && rev_depth)
+	{
+		// the children of the root node are stored at the beginning of the arrays
+		const auto off_c = (rev_depth == m) ? 0 : off_l + n_elmts;
+
+		// f
+		switch (node_type)
+		{
+			case tools::STANDARD:
+			case tools::REP_LEFT:
+				for (auto p = 0; p < n_active_paths; p++)
+				{
+					const auto parent = node_llrs(p, rev_depth, off_l);
+					API_polar::f(parent, parent + n_elm_2 * n_lanes, l[p].data() + off_c * n_lanes, n_elm_2);
+				}
+				break;
+			case tools::RATE_0_LEFT:
+				// the llrs of the rate 0 node are only used to penalize the paths
+				for (auto p = 0; p < n_active_paths && n_active_paths > 1; p++)
+				{
+					const auto parent = node_llrs(p, rev_depth, off_l);
+					API_polar::f(parent, parent + n_elm_2 * n_lanes, l[p].data() + off_c * n_lanes, n_elm_2);
+				}
+				break;
+			default:
+				break;
+		}
+
+		recursive_decode(off_c, off_s, rev_depth -1, ++node_id); // recursive call left
+
+		// g
+		switch (node_type)
+		{
+			case tools::STANDARD:
+				for (auto p = 0; p < n_active_paths; p++)
+				{
+					const auto parent = node_llrs(p, rev_depth, off_l);
+					API_polar::g (parent, parent + n_elm_2 * n_lanes, s[p].data() + off_s * n_lanes,
+					              l[p].data() + off_c * n_lanes, n_elm_2);
+				}
+				break;
+			case tools::RATE_0_LEFT:
+				for (auto p = 0; p < n_active_paths; p++)
+				{
+					const auto parent = node_llrs(p, rev_depth, off_l);
+					API_polar::g0(parent, parent + n_elm_2 * n_lanes, l[p].data() + off_c * n_lanes, n_elm_2);
+				}
+				break;
+			case tools::REP_LEFT:
+				for (auto p = 0; p < n_active_paths; p++)
+				{
+					const auto parent = node_llrs(p, rev_depth, off_l);
+					API_polar::gr(parent, parent + n_elm_2 * n_lanes, s[p].data() + off_s * n_lanes,
+					              l[p].data() + off_c * n_lanes, n_elm_2);
+				}
+				break;
+			default:
+				break;
+		}
+
+		recursive_decode(off_c, off_s + n_elm_2, rev_depth -1, ++node_id); // recursive call right
+
+		// xor
+		switch (node_type)
+		{
+			case tools::STANDARD:
+			case tools::REP_LEFT:
+				for (auto p = 0; p < n_active_paths; p++)
+					API_polar::xo (s[p], off_s, off_s + n_elm_2, off_s, n_elm_2);
+				break;
+			case tools::RATE_0_LEFT:
+				for (auto p = 0; p < n_active_paths; p++)
+					API_polar::xo0(s[p],        off_s + n_elm_2, off_s, n_elm_2);
+				break;
+			default:
+				break;
+		}
+	}
+	else // leaf node
+	{
+		// the rate 1 leaves are information bits (size 1), they are decoded as REP nodes
+		switch (node_type)
+		{
+			case tools::RATE_0: update_paths_r0 (rev_depth, off_l, off_s, n_elmts); break;
+			case tools::RATE_1: update_paths_rep(rev_depth, off_l, off_s, n_elmts); break;
+			case tools::REP:    update_paths_rep(rev_depth, off_l, off_s, n_elmts); break;
+			default:
+				break;
+		}
+
+		for (auto f = 0; f < n_lanes; f++)
+			normalize_scl_metrics<R>(this->metrics[f], n_active_paths);
+	}
+}
+
+template <typename B, typename R, class API_polar>
+void Decoder_polar_SCL_inter_fast_sys<B,R,API_polar>
+::update_paths_r0(const int r_d, const int off_l, const int off_s, const int n_elmts)
+{
+	if (n_active_paths > 1)
+		for (auto p = 0; p < n_active_paths; p++)
+		{
+			const auto node_l = node_llrs(p, r_d, off_l);
+
+			std::fill(pen0.begin(), pen0.end(), (R)0);
+			for (auto j = 0; j < n_elmts; j++)
+				for (auto f = 0; f < n_lanes; f++)
+					pen0[f] = sat_m<R>(pen0[f] + sat_m<R>(-std::min(node_l[j * n_lanes + f], (R)0)));
+
+			for (auto f = 0; f < n_lanes; f++)
+				metrics[f][p] = sat_m<R>(metrics[f][p] + pen0[f]); // add a penalty to the current path metric
+		}
+
+	for (auto p = 0; p < n_active_paths; p++)
+		API_polar::h0(s[p], off_s, n_elmts);
+}
+
+template <typename B, typename R, class API_polar>
+void Decoder_polar_SCL_inter_fast_sys<B,R,API_polar>
+::update_paths_rep(const int r_d, const int off_l, const int off_s, const int n_elmts)
+{
+	constexpr B b = tools::bit_init<B>();
+
+	// generate the two possible candidates of each path in each frame
+	for (auto p = 0; p < n_active_paths; p++)
+	{
+		const auto node_l = node_llrs(p, r_d, off_l);
+
+		std::fill(pen0.begin(), pen0.end(), (R)0);
+		std::fill(pen1.begin(), pen1.end(), (R)0);
+		for (auto j = 0; j < n_elmts; j++)
+			for (auto f = 0; f < n_lanes; f++)
+			{
+				pen0[f] = sat_m<R>(pen0[f] + sat_m<R>(-std::min(node_l[j * n_lanes + f], (R)0)));
+				pen1[f] = sat_m<R>(pen1[f] + sat_m<R>(+std::max(node_l[j * n_lanes + f], (R)0)));
+			}
+
+		for (auto f = 0; f < n_lanes; f++)
+		{
+			metrics_vec[f][2 * p +0] = sat_m<R>(metrics[f][p] + pen0[f]);
+			metrics_vec[f][2 * p +1] = sat_m<R>(metrics[f][p] + pen1[f]);
+		}
+	}
+
+	// the llrs of the ancestors of the node are in [0, off_l[ and the partial sums of the previous nodes are in
+	// [0, off_s[, the rest of the arrays is recomputed before to be read
+	const auto n_elmts_l = off_l * n_lanes;
+	const auto n_elmts_s = off_s * n_lanes;
+
+	if (n_active_paths <= L / 2)
+	{
+		// all the candidates are kept: the same duplications in all the frames
+		for (auto p = 0; p < n_active_paths; p++)
+		{
+			const auto new_path = n_active_paths + p;
+
+			std::copy(l[p].begin(), l[p].begin() + n_elmts_l, l[new_path].begin());
+			std::copy(s[p].begin(), s[p].begin() + n_elmts_s, s[new_path].begin());
+
+			for (auto f = 0; f < n_lanes; f++)
+			{
+				dec_bits[f][       p] = 0; metrics[f][       p] = metrics_vec[f][2 * p +0];
+				dec_bits[f][new_path] = b; metrics[f][new_path] = metrics_vec[f][2 * p +1];
+			}
+		}
+		n_active_paths *= 2;
+	}
+	else // n_active_paths == L
+	{
+		// select the L best candidates in each frame, a path which keeps one candidate stays in place and its second
+		// candidate (if any) replaces a path without candidate
+		for (auto f = 0; f < n_lanes; f++)
+		{
+			sorter_paths.partial_sort(metrics_vec[f].data(), best_idx, 2 * L, L);
+
+			std::fill(dup_count.begin(), dup_count.end(), 0);
+			for (auto i = 0; i < L; i++)
+				dup_count[best_idx[i] / 2]++;
+
+			auto n_free = 0;
+			for (auto p = 0; p < L; p++)
+				if (dup_count[p] == 0)
+					free_paths[n_free++] = p;
+
+			for (auto i = 0; i < L; i++)
+			{
+				const auto path = best_idx[i] / 2;
+				const auto dup  = best_idx[i] % 2;
+
+				const auto new_path = (dup_count[path] < 0) ? free_paths[--n_free] : path;
+				dup_count[path] = -1; // the path is in place
+
+				src_path[f][new_path] = path;
+				dec_bits[f][new_path] = dup ? b : 0;
+				metrics [f][new_path] = metrics_vec[f][best_idx[i]];
+			}
+		}
+
+		// duplicate the paths lane per lane: the destinations are paths without candidate and the sources are paths in
+		// place, a source is never overwritten
+		bool lanes[mipp::N<R>()];
+		for (auto dst = 0; dst < L; dst++)
+			for (auto src = 0; src < L; src++)
+			{
+				if (src == dst)
+					continue;
+
+				auto n_lanes_cpy = 0;
+				for (auto f = 0; f < n_lanes; f++)
+				{
+					lanes[f] = src_path[f][dst] == src;
+					n_lanes_cpy += lanes[f] ? 1 : 0;
+				}
+
+				if (n_lanes_cpy)
+				{
+					copy_lanes(l[src].data(), l[dst].data(), lanes, n_elmts_l);
+					copy_lanes(s[src].data(), s[dst].data(), lanes, n_elmts_s);
+				}
+			}
+	}
+
+	// write the decided bits (one value per frame)
+	B bits[mipp::N<B>()];
+	for (auto p = 0; p < n_active_paths; p++)
+	{
+		for (auto f = 0; f < n_lanes; f++)
+			bits[f] = dec_bits[f][p];
+
+		const auto r_bits = mipp::Reg<B>(bits);
+		for (auto j = 0; j < n_elmts; j++)
+			r_bits.store(s[p].data() + (off_s + j) * n_lanes);
+	}
+}
+
+template <typename B, typename R, class API_polar>
+template <typename T>
+void Decoder_polar_SCL_inter_fast_sys<B,R,API_polar>
+::copy_lanes(const T *src, T *dst, const bool lanes[], const int n_elmts)
+{
+	const auto m_lanes = mipp::Msk<mipp::N<T>()>(lanes);
+	for (auto i = 0; i < n_elmts; i += mipp::N<T>())
+	{
+		const auto r_src = mipp::Reg<T>(src + i);
+		const auto r_dst = mipp::Reg<T>(dst + i);
+		mipp::blend(r_src, r_dst, m_lanes).store(dst + i);
+	}
+}
+
+template <typename B, typename R, class API_polar>
+void Decoder_polar_SCL_inter_fast_sys<B,R,API_polar>
+::select_best_path()
+{
+	for (auto f = 0; f < n_lanes; f++)
+	{
+		best_path[f] = 0;
+		for (auto p = 1; p < n_active_paths; p++)
+			if (metrics[f][p] < metrics[f][best_path[f]])
+				best_path[f] = p;
+	}
+}
+
+template <typename B, typename R, class API_polar>
+void Decoder_polar_SCL_inter_fast_sys<B,R,API_polar>
+::gather_best_paths()
+{
+	bool lanes[mipp::N<B>()];
+	for (auto p = 0; p < n_active_paths; p++)
+	{
+		auto n_lanes_cpy = 0;
+		for (auto f = 0; f < n_lanes; f++)
+		{
+			lanes[f] = best_path[f] == p;
+			n_lanes_cpy += lanes[f] ? 1 : 0;
+		}
+
+		if (n_lanes_cpy)
+			copy_lanes(s[p].data(), s_bis.data(), lanes, this->N * n_lanes);
+	}
+}
+
+template <typename B, typename R, class API_polar>
+void Decoder_polar_SCL_inter_fast_sys<B,R,API_polar>
+::_store(B *V_K)
+{
+	this->gather_best_paths();
+
+	tools::fb_extract<B,n_lanes>(this->polar_patterns.get_leaves_pattern_types(), s_bis.data(), U_bis.data());
+
+	std::vector<B*> frames(n_lanes);
+	for (auto f = 0; f < n_lanes; f++)
+		frames[f] = V_K + f * this->K;
+	tools::Reorderer_static<B,n_lanes>::apply_rev(U_bis.data(), frames, this->K);
+}
+
+template <typename B, typename R, class API_polar>
+void Decoder_polar_SCL_inter_fast_sys<B,R,API_polar>
+::_store_cw(B *V_N)
+{
+	this->gather_best_paths();
+
+	std::vector<B*> frames(n_lanes);
+	for (auto f = 0; f < n_lanes; f++)
+		frames[f] = V_N + f * this->N;
+	tools::Reorderer_static<B,n_lanes>::apply_rev(s_bis.data(), frames, this->N);
+}
+}
+}
@@ -105,7 +105,7 @@ void Decoder_RA<B, R>
 			Tu[i] = check_node(Fw[i - 1] + Y_N[i - 1], Bw[i] + Y_N[i]);
 
 		// Deinterleave
-		interleaver.deinterleave(Tu.data(), Wu.data(), frame_id);
+		interleaver.deinterleave(Tu.data(), Wu.data(), frame_id, 1);
 
 		// U computation
 		R tmp;
@@ -120,7 +120,7 @@ void Decoder_RA<B, R>
 		}
 
 		// Interleaving
-		interleaver.interleave(Wd.data(), Td.data(), frame_id);
+		interleaver.interleave(Wd.data(), Td.data(), frame_id, 1);
 	}
 //	auto d_decod = std::chrono::steady_clock::now() - t_decod;
 
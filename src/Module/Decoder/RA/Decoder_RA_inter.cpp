@@ -0,0 +1,232 @@
+#include <sstream>
+
+#include "Tools/Math/utils.h"
+#include "Tools/Perf/hard_decision.h"
+#include "Tools/Perf/Reorderer/Reorderer.hpp"
+#include "Tools/Exception/exception.hpp"
+
+#include "Decoder_RA_inter.hpp"
+
+using namespace aff3ct;
+using namespace aff3ct::module;
+
+// --------------------------------------------------------------------------------------------------------------------
+// --------------------------------------------------------------------------------------------------------- SIMD TOOLS
+
+//                                                                                                           saturation
+template <typename R>
+inline mipp::Reg<R> simd_sat(const mipp::Reg<R> v)
+{
+	return v;
+}
+template <>
+inline mipp::Reg<short> simd_sat(const mipp::Reg<short> v)
+{
+	return mipp::sat(v, (short)-tools::sat_val<short>(), tools::sat_val<short>());
+}
+template <>
+inline mipp::Reg<signed char> simd_sat(const mipp::Reg<signed char> v)
+{
+	return mipp::sat(v, (signed char)-tools::sat_val<signed char>(), tools::sat_val<signed char>());
+}
+
+//                                                                                                   add, sub and check
+// the operands are saturated to 'sat_val' (half of the range): their sum can't overflow before the saturation
+template <typename R>
+inline mipp::Reg<R> simd_add(const mipp::Reg<R> a, const mipp::Reg<R> b)
+{
+	return simd_sat(a + b);
+}
+template <typename R>
+inline mipp::Reg<R> simd_sub(const mipp::Reg<R> a, const mipp::Reg<R> b)
+{
+	return simd_sat(a - b);
+}
+template <typename R>
+inline mipp::Reg<R> simd_check_node(const mipp::Reg<R> a, const mipp::Reg<R> b)
+{
+	return mipp::copysign(mipp::min(mipp::abs(a), mipp::abs(b)), mipp::sign(a) ^ mipp::sign(b));
+}
+
+// --------------------------------------------------------------------------------------------------------- SIMD TOOLS
+// --------------------------------------------------------------------------------------------------------------------
+
+template <typename B, typename R>
+Decoder_RA_inter<B,R>
+::Decoder_RA_inter(const int& K, const int& N, const Interleaver<R>& interleaver, int max_iter, const int n_frames)
+: Decoder          (K, N, n_frames, mipp::nElReg<R>()),
+  Decoder_SIHO<B,R>(K, N, n_frames, mipp::nElReg<R>()),
+  rep_count(N/K),
+  max_iter(max_iter),
+  Y (N * mipp::nElReg<R>()),
+  Fw(N * mipp::nElReg<R>()),
+  Bw(N * mipp::nElReg<R>()),
+  Tu(N * mipp::nElReg<R>()),
+  Td(N * mipp::nElReg<R>()),
+  Wu(N * mipp::nElReg<R>()),
+  Wd(N * mipp::nElReg<R>()),
+  U (K * mipp::nElReg<R>()),
+  V (K * mipp::nElReg<R>()),
+  interleaver(interleaver)
+{
+	const std::string name = "Decoder_RA_inter";
+	this->set_name(name);
+
+	if (sizeof(B) != sizeof(R))
+	{
+		std::stringstream message;
+		message << "'sizeof(B)' has to be equal to 'sizeof(R)' ('sizeof(B)' = " << sizeof(B) << ", 'sizeof(R)' = "
+		        << sizeof(R) << ").";
+		throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	if (max_iter <= 0)
+	{
+		std::stringstream message;
+		message << "'max_iter' has to be greater than 0 ('max_iter' = " << max_iter << ").";
+		throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	if (N % K)
+	{
+		std::stringstream message;
+		message << "'K' has to be a multiple of 'N' ('K' = " << K << ", 'N' = " << N << ").";
+		throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	if ((int)interleaver.get_core().get_size() != N)
+	{
+		std::stringstream message;
+		message << "'interleaver.get_core().get_size()' has to be equal to 'N' ('interleaver.get_core().get_size()' = "
+		        << interleaver.get_core().get_size() << ", 'N' = " << N << ").";
+		throw tools::length_error(__FILE__, __LINE__, __func__, message.str());
+	}
+}
+
+template <typename B, typename R>
+Decoder_RA_inter<B,R>
+::~Decoder_RA_inter()
+{
+}
+
+template <typename B, typename R>
+void Decoder_RA_inter<B,R>
+::_load(const R *Y_N)
+{
+	constexpr int n_lanes = mipp::nElReg<R>();
+
+	std::vector<const R*> frames(n_lanes);
+	for (auto f = 0; f < n_lanes; f++) frames[f] = Y_N + f * this->N;
+	tools::Reorderer_static<R,n_lanes>::apply(frames, Y.data(), this->N);
+
+	for (auto i = 0; i < this->N * n_lanes; i += n_lanes)
+		simd_sat(mipp::Reg<R>(&Y[i])).store(&Y[i]);
+
+	const auto zero = mipp::Reg<R>((R)0);
+	for (auto i = 0; i < this->N * n_lanes; i += n_lanes)
+	{
+		zero.store(&Fw[i]);
+		zero.store(&Bw[i]);
+		zero.store(&Td[i]);
+	}
+}
+
+template <typename B, typename R>
+void Decoder_RA_inter<B,R>
+::_decode_siho(const R *Y_N, B *V_K, const int frame_id)
+{
+//	auto t_load = std::chrono::steady_clock::now(); // ----------------------------------------------------------- LOAD
+	this->_load(Y_N);
+//	auto d_load = std::chrono::steady_clock::now() - t_load;
+
+//	auto t_decod = std::chrono::steady_clock::now(); // -------------------------------------------------------- DECODE
+	constexpr int W = mipp::nElReg<R>();
+	const auto N = this->N;
+
+	for (auto iter = 0; iter < max_iter; iter++)
+	{
+		///////////////////
+		// SISO decoding //
+		///////////////////
+
+		// Forward
+		mipp::Reg<R>(&Td[0]).store(&Fw[0]);
+		for (auto i = 1; i < N; i++)
+		{
+			const auto r_fw = simd_add(mipp::Reg<R>(&Fw[(i -1) * W]), mipp::Reg<R>(&Y[(i -1) * W]));
+			simd_check_node(r_fw, mipp::Reg<R>(&Td[i * W])).store(&Fw[i * W]);
+		}
+
+		// Backward
+		simd_check_node(mipp::Reg<R>(&Y[(N -1) * W]), mipp::Reg<R>(&Td[(N -1) * W])).store(&Bw[(N -2) * W]);
+		for (auto i = N -3; i >= 0; i--)
+		{
+			const auto r_bw = simd_add(mipp::Reg<R>(&Bw[(i +1) * W]), mipp::Reg<R>(&Y[(i +1) * W]));
+			simd_check_node(r_bw, mipp::Reg<R>(&Td[(i +1) * W])).store(&Bw[i * W]);
+		}
+
+		// Extrinsic
+		simd_add(mipp::Reg<R>(&Bw[0]), mipp::Reg<R>(&Y[0])).store(&Tu[0]);
+		simd_check_node(mipp::Reg<R>(&Y[(N -1) * W]),
+		                simd_add(mipp::Reg<R>(&Y[(N -2) * W]), mipp::Reg<R>(&Fw[(N -2) * W]))).store(&Tu[(N -1) * W]);
+		for (auto i = 1; i < N -1; i++)
+		{
+			const auto r_fw = simd_add(mipp::Reg<R>(&Fw[(i -1) * W]), mipp::Reg<R>(&Y[(i -1) * W]));
+			const auto r_bw = simd_add(mipp::Reg<R>(&Bw[ i     * W]), mipp::Reg<R>(&Y[ i     * W]));
+			simd_check_node(r_fw, r_bw).store(&Tu[i * W]);
+		}
+
+		// Deinterleave
+		interleaver.deinterleave(Tu.data(), Wu.data(), frame_id, W, true);
+
+		// U computation
+		for (auto i = 0; i < this->K; i++)
+		{
+			const auto off = i * rep_count * W;
+
+			auto r_sum = mipp::Reg<R>((R)0);
+			for (auto j = 0; j < rep_count; j++)
+				r_sum = simd_add(r_sum, mipp::Reg<R>(&Wu[off + j * W]));
+			for (auto j = 0; j < rep_count; j++)
+				simd_sub(r_sum, mipp::Reg<R>(&Wu[off + j * W])).store(&Wd[off + j * W]);
+			r_sum.store(&U[i * W]);
+		}
+
+		// Interleaving
+		interleaver.interleave(Wd.data(), Td.data(), frame_id, W, true);
+	}
+//	auto d_decod = std::chrono::steady_clock::now() - t_decod;
+
+//	auto t_store = std::chrono::steady_clock::now(); // --------------------------------------------------------- STORE
+	this->_store(V_K);
+//	auto d_store = std::chrono::steady_clock::now() - t_store;
+
+//	(*this)[dec::tsk::decode_siho].update_timer(dec::tm::decode_siho::load,   d_load);
+//	(*this)[dec::tsk::decode_siho].update_timer(dec::tm::decode_siho::decode, d_decod);
+//	(*this)[dec::tsk::decode_siho].update_timer(dec::tm::decode_siho::store,  d_store);
+}
+
+template <typename B, typename R>
+void Decoder_RA_inter<B,R>
+::_store(B *V_K)
+{
+	constexpr int n_lanes = mipp::nElReg<R>();
+
+	tools::hard_decide(U.data(), V.data(), this->K * n_lanes);
+
+	std::vector<B*> frames(n_lanes);
+	for (auto f = 0; f < n_lanes; f++) frames[f] = V_K + f * this->K;
+	tools::Reorderer_static<B,n_lanes>::apply_rev(V.data(), frames, this->K);
+}
+
+// ==================================================================================== explicit template instantiation
+#include "Tools/types.h"
+#ifdef MULTI_PREC
+template class aff3ct::module::Decoder_RA_inter<B_8,Q_8>;
+template class aff3ct::module::Decoder_RA_inter<B_16,Q_16>;
+template class aff3ct::module::Decoder_RA_inter<B_32,Q_32>;
+template class aff3ct::module::Decoder_RA_inter<B_64,Q_64>;
+#else
+template class aff3ct::module::Decoder_RA_inter<B,Q>;
+#endif
+// ==================================================================================== explicit template instantiation
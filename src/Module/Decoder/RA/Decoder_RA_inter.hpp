@@ -0,0 +1,52 @@
+#ifndef DECODER_RA_INTER
+#define DECODER_RA_INTER
+
+#include <vector>
+#include <mipp.h>
+
+#include "../Decoder_SIHO.hpp"
+#include "../../Interleaver/Interleaver.hpp"
+
+namespace aff3ct
+{
+namespace module
+{
+/*!
+ * \class Decoder_RA_inter
+ *
+ * \brief Repeat-Accumulate decoder of 'mipp::nElReg<R>()' frames at once (inter-frame SIMD).
+ *
+ * Same message passing as the Decoder_RA (forward/backward min-sum on the accumulator and repetition combining) but
+ * the frames are interleaved: the element 'i' of the frame 'f' is stored at 'i * mipp::nElReg<R>() + f' and each step
+ * processes all the frames in one register. The interleaver is applied with its LUT on the interleaved frames (frame
+ * reordering). In fixed-point the messages are saturated to 'tools::sat_val<R>()'.
+ */
+template <typename B = int, typename R = float>
+class Decoder_RA_inter : public Decoder_SIHO<B,R>
+{
+protected:
+	const int rep_count; // number of repetitions
+	int max_iter;        // max number of iterations
+
+	mipp::vector<R> Y;              // channel LLRs (interleaved frames)
+	mipp::vector<R> Fw, Bw;         // forward and backward metrics of the accumulator
+	mipp::vector<R> Tu, Td, Wu, Wd; // messages between the accumulator and the repetition nodes
+	mipp::vector<R> U;              // a posteriori LLRs of the information bits
+	mipp::vector<B> V;              // hard decisions (interleaved frames)
+
+	const Interleaver<R>& interleaver;
+
+public:
+	Decoder_RA_inter(const int& K, const int& N, const Interleaver<R>& interleaver, int max_iter,
+	                 const int n_frames = 1);
+	virtual ~Decoder_RA_inter();
+
+protected:
+	void _load       (const R *Y_N                            );
+	void _decode_siho(const R *Y_N, B *V_K, const int frame_id);
+	void _store      (              B *V_K                    );
+};
+}
+}
+
+#endif /* DECODER_RA_INTER */
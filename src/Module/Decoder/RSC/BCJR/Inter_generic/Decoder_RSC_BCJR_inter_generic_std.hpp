@@ -0,0 +1,45 @@
+#ifndef DECODER_RSC_BCJR_INTER_GENERIC_STD_HPP_
+#define DECODER_RSC_BCJR_INTER_GENERIC_STD_HPP_
+
+#include <vector>
+#include <mipp.h>
+
+#include "Tools/Math/max.h"
+
+#include "../Decoder_RSC_BCJR.hpp"
+
+namespace aff3ct
+{
+namespace module
+{
+// inter-frame SIMD BCJR for any trellis (the number of states has to be a power of 2): each SIMD register contains
+// the same metric of 'mipp::nElReg<R>()' different frames
+template <typename B = int, typename R = float, tools::proto_max_i<R> MAX = tools::max_i>
+class Decoder_RSC_BCJR_inter_generic_std : public Decoder_RSC_BCJR<B,R>
+{
+protected:
+	mipp::vector<R> alpha;     // node metrics (left to right), the 'n_states' registers of a step are contiguous
+	mipp::vector<R> gamma;     // edge metrics, the 2 registers of a step are contiguous
+	mipp::vector<R> beta_prev; // node metrics (right to left) of the next step
+	mipp::vector<R> beta_cur;  // node metrics (right to left) of the current step
+
+public:
+	Decoder_RSC_BCJR_inter_generic_std(const int &K,
+	                                   const std::vector<std::vector<int>> &trellis,
+	                                   const bool buffered_encoding = true,
+	                                   const int n_frames = 1);
+	virtual ~Decoder_RSC_BCJR_inter_generic_std();
+
+protected:
+	void _decode_siso(const R *sys, const R *par, R *ext, const int frame_id);
+
+	void compute_gamma   (const R *sys, const R *par);
+	void compute_alpha   (                          );
+	void compute_beta_ext(const R *sys,       R *ext);
+};
+}
+}
+
+#include "Decoder_RSC_BCJR_inter_generic_std.hxx"
+
+#endif /* DECODER_RSC_BCJR_INTER_GENERIC_STD_HPP_ */
@@ -0,0 +1,255 @@
+#include <limits>
+#include <utility>
+#include <algorithm>
+#include <mipp.h>
+
+#include "Tools/Exception/exception.hpp"
+
+#include "../Inter/Decoder_RSC_BCJR_inter.hpp"
+
+#include "Decoder_RSC_BCJR_inter_generic_std.hpp"
+
+namespace aff3ct
+{
+namespace module
+{
+template <typename R>
+struct RSC_BCJR_inter_generic_init
+{
+	static R value()
+	{
+		return -std::numeric_limits<R>::max();
+	}
+};
+
+template <>
+struct RSC_BCJR_inter_generic_init <short>
+{
+	static short value()
+	{
+		return -(1 << (sizeof(short) * 8 -2));
+	}
+};
+
+template <>
+struct RSC_BCJR_inter_generic_init <signed char>
+{
+	static signed char value()
+	{
+		return -127;
+	}
+};
+
+template <typename B, typename R, tools::proto_max_i<R> MAX>
+Decoder_RSC_BCJR_inter_generic_std<B,R,MAX>
+::Decoder_RSC_BCJR_inter_generic_std(const int &K,
+                                     const std::vector<std::vector<int>> &trellis,
+                                     const bool buffered_encoding,
+                                     const int n_frames)
+: Decoder(K, 2*(K + (int)std::log2(trellis[0].size())), n_frames, mipp::N<R>()),
+  Decoder_RSC_BCJR<B,R>(K, trellis, buffered_encoding, n_frames, mipp::N<R>()),
+  alpha    ((K + (int)std::log2(trellis[0].size())) * trellis[0].size() * mipp::N<R>()),
+  gamma    ((K + (int)std::log2(trellis[0].size())) * 2                 * mipp::N<R>()),
+  beta_prev(                                          trellis[0].size() * mipp::N<R>()),
+  beta_cur (                                          trellis[0].size() * mipp::N<R>())
+{
+	const std::string name = "Decoder_RSC_BCJR_inter_generic_std";
+	this->set_name(name);
+
+	// init alpha values (the metrics of the last step of the trellis are the same for beta)
+	std::fill(alpha.begin(), alpha.begin() + this->n_states * mipp::N<R>(), RSC_BCJR_inter_generic_init<R>::value());
+	std::fill(alpha.begin(), alpha.begin() +                  mipp::N<R>(), (R)0);
+}
+
+template <typename B, typename R, tools::proto_max_i<R> MAX>
+Decoder_RSC_BCJR_inter_generic_std<B,R,MAX>
+::~Decoder_RSC_BCJR_inter_generic_std()
+{
+}
+
+// ====================================================================================================== normalization
+template <typename R>
+struct RSC_BCJR_inter_generic_normalize
+{
+	static void apply(R *metrics, const int &n_states, const int &i)
+	{
+		// no need to do something
+	}
+};
+
+template <>
+struct RSC_BCJR_inter_generic_normalize <short>
+{
+	static void apply(short *metrics, const int &n_states, const int &i)
+	{
+		constexpr auto stride = mipp::nElmtsPerRegister<short>();
+
+		// normalization
+		if (i % 8 == 0)
+		{
+			const auto r_norm_val = mipp::Reg<short>(&metrics[0]);
+			for (auto j = 0; j < n_states; j++)
+			{
+				auto r_m = mipp::Reg<short>(&metrics[j * stride]);
+				r_m -= r_norm_val;
+				r_m.store(&metrics[j * stride]);
+			}
+		}
+	}
+};
+
+template <>
+struct RSC_BCJR_inter_generic_normalize <signed char>
+{
+	static void apply(signed char *metrics, const int &n_states, const int &i)
+	{
+		constexpr auto stride = mipp::nElmtsPerRegister<signed char>();
+
+		// normalization
+		const auto r_norm_val = mipp::Reg<signed char>(&metrics[0]);
+		for (auto j = 0; j < n_states; j++)
+		{
+			auto r_m = mipp::Reg<signed char>(&metrics[j * stride]);
+			r_m -= r_norm_val;
+			r_m.store(&metrics[j * stride]);
+		}
+	}
+};
+
+template <typename B, typename R, tools::proto_max_i<R> MAX>
+void Decoder_RSC_BCJR_inter_generic_std<B,R,MAX>
+::compute_gamma(const R *sys, const R *par)
+{
+	constexpr auto stride = mipp::nElmtsPerRegister<R>();
+
+	for (auto i = 0; i < this->K + this->n_ff; i++)
+	{
+		const auto r_sys = mipp::Reg<R>(&sys[i * stride]);
+		const auto r_par = mipp::Reg<R>(&par[i * stride]);
+
+		// there is a big loss of precision here in fixed point
+		const auto r_g0 = RSC_BCJR_inter_div_or_not<R>::apply(r_sys + r_par);
+		const auto r_g1 = RSC_BCJR_inter_div_or_not<R>::apply(r_sys - r_par);
+
+		r_g0.store(&this->gamma[(2*i +0) * stride]);
+		r_g1.store(&this->gamma[(2*i +1) * stride]);
+	}
+}
+
+template <typename B, typename R, tools::proto_max_i<R> MAX>
+void Decoder_RSC_BCJR_inter_generic_std<B,R,MAX>
+::compute_alpha()
+{
+	constexpr auto stride = mipp::nElmtsPerRegister<R>();
+	const auto n_states = this->n_states;
+
+	const auto &prev0 = this->trellis[0], &sign0 = this->trellis[1], &gidx0 = this->trellis[2];
+	const auto &prev1 = this->trellis[3], &sign1 = this->trellis[4], &gidx1 = this->trellis[5];
+
+	// compute alpha values [trellis forward traversal ->]
+	for (auto i = 1; i < this->K + this->n_ff; i++)
+	{
+		const auto a_prev = this->alpha.data() + (i -1) * n_states * stride;
+		const auto a_cur  = this->alpha.data() + (i -0) * n_states * stride;
+
+		const mipp::Reg<R> r_g[2] = {mipp::Reg<R>(&this->gamma[(2*(i -1) +0) * stride]),
+		                             mipp::Reg<R>(&this->gamma[(2*(i -1) +1) * stride])};
+
+		for (auto j = 0; j < n_states; j++)
+		{
+			const auto r_a0 = mipp::Reg<R>(&a_prev[prev0[j] * stride]);
+			const auto r_a1 = mipp::Reg<R>(&a_prev[prev1[j] * stride]);
+
+			const auto r_m0 = (sign0[j] > 0) ? r_a0 + r_g[gidx0[j]] : r_a0 - r_g[gidx0[j]];
+			const auto r_m1 = (sign1[j] > 0) ? r_a1 + r_g[gidx1[j]] : r_a1 - r_g[gidx1[j]];
+
+			MAX(r_m0, r_m1).store(&a_cur[j * stride]);
+		}
+
+		RSC_BCJR_inter_generic_normalize<R>::apply(a_cur, n_states, i);
+	}
+}
+
+template <typename B, typename R, tools::proto_max_i<R> MAX>
+void Decoder_RSC_BCJR_inter_generic_std<B,R,MAX>
+::compute_beta_ext(const R *sys, R *ext)
+{
+	constexpr auto stride = mipp::nElmtsPerRegister<R>();
+	const auto n_states = this->n_states;
+
+	const auto &next0 = this->trellis[6], &gidx0 = this->trellis[7];
+	const auto &next1 = this->trellis[8], &gidx1 = this->trellis[9];
+
+	// compute the first beta values [trellis backward traversal <-]
+	std::copy(this->alpha.begin(), this->alpha.begin() + n_states * stride, beta_prev.begin());
+	for (auto i = this->K + this->n_ff -1; i >= this->K; i--)
+	{
+		const mipp::Reg<R> r_g[2] = {mipp::Reg<R>(&this->gamma[(2*i +0) * stride]),
+		                             mipp::Reg<R>(&this->gamma[(2*i +1) * stride])};
+
+		for (auto j = 0; j < n_states; j++)
+		{
+			const auto r_b0 = mipp::Reg<R>(&beta_prev[next0[j] * stride]) + r_g[gidx0[j]];
+			const auto r_b1 = mipp::Reg<R>(&beta_prev[next1[j] * stride]) - r_g[gidx1[j]];
+
+			MAX(r_b0, r_b1).store(&beta_cur[j * stride]);
+		}
+
+		RSC_BCJR_inter_generic_normalize<R>::apply(beta_cur.data(), n_states, i);
+		std::swap(beta_prev, beta_cur);
+	}
+
+	// compute the beta values [trellis backward traversal <-] + compute extrinsic values, the sums of the beta and
+	// gamma values are shared by the two computations
+	for (auto i = this->K -1; i >= 0; i--)
+	{
+		const auto a_cur = this->alpha.data() + i * n_states * stride;
+
+		const mipp::Reg<R> r_g[2] = {mipp::Reg<R>(&this->gamma[(2*i +0) * stride]),
+		                             mipp::Reg<R>(&this->gamma[(2*i +1) * stride])};
+
+		auto r_b0   = mipp::Reg<R>(&beta_prev[next0[0] * stride]) + r_g[gidx0[0]];
+		auto r_b1   = mipp::Reg<R>(&beta_prev[next1[0] * stride]) - r_g[gidx1[0]];
+		auto r_a    = mipp::Reg<R>(&a_cur[0]);
+		auto r_max0 = r_a + r_b0;
+		auto r_max1 = r_a + r_b1;
+		MAX(r_b0, r_b1).store(&beta_cur[0]);
+
+		for (auto j = 1; j < n_states; j++)
+		{
+			r_b0   = mipp::Reg<R>(&beta_prev[next0[j] * stride]) + r_g[gidx0[j]];
+			r_b1   = mipp::Reg<R>(&beta_prev[next1[j] * stride]) - r_g[gidx1[j]];
+			r_a    = mipp::Reg<R>(&a_cur[j * stride]);
+			r_max0 = MAX(r_max0, r_a + r_b0);
+			r_max1 = MAX(r_max1, r_a + r_b1);
+			MAX(r_b0, r_b1).store(&beta_cur[j * stride]);
+		}
+
+		const auto r_post = RSC_BCJR_inter_post<R>::compute(r_max0 - r_max1);
+		const auto r_ext  = r_post - &sys[i * stride];
+		r_ext.store(&ext[i * stride]);
+
+		RSC_BCJR_inter_generic_normalize<R>::apply(beta_cur.data(), n_states, i);
+		std::swap(beta_prev, beta_cur);
+	}
+}
+
+template <typename B, typename R, tools::proto_max_i<R> MAX>
+void Decoder_RSC_BCJR_inter_generic_std<B,R,MAX>
+::_decode_siso(const R *sys, const R *par, R *ext, const int frame_id)
+{
+	if (!mipp::isAligned(sys))
+		throw tools::runtime_error(__FILE__, __LINE__, __func__, "'sys' is misaligned memory.");
+
+	if (!mipp::isAligned(par))
+		throw tools::runtime_error(__FILE__, __LINE__, __func__, "'par' is misaligned memory.");
+
+	if (!mipp::isAligned(ext))
+		throw tools::runtime_error(__FILE__, __LINE__, __func__, "'ext' is misaligned memory.");
+
+	this->compute_gamma   (sys, par);
+	this->compute_alpha   (        );
+	this->compute_beta_ext(sys, ext);
+}
+}
+}
@@ -0,0 +1,62 @@
+#ifndef DECODER_RSC_BCJR_INTRA_GENERIC_STD_HPP_
+#define DECODER_RSC_BCJR_INTRA_GENERIC_STD_HPP_
+
+#include <vector>
+#include <mipp.h>
+
+#include "Tools/Math/max.h"
+
+#include "../Decoder_RSC_BCJR.hpp"
+
+namespace aff3ct
+{
+namespace module
+{
+// intra-frame SIMD BCJR for any trellis: the metrics of 'mipp::nElReg<R>()' consecutive states are computed in one SIMD
+// register (the number of states has to be a multiple of 'mipp::nElReg<R>()')
+template <typename B = int, typename R = float, tools::proto_max_i<R> MAX = tools::max_i>
+class Decoder_RSC_BCJR_intra_generic_std : public Decoder_RSC_BCJR<B,R>
+{
+protected:
+	const int n_chunks; // number of SIMD registers to store the metrics of one step
+
+	mipp::vector<R> alpha;     // node metrics (left to right), the 'n_states' metrics of a step are contiguous
+	mipp::vector<R> gamma;     // edge metrics, the 2 metrics of a step are contiguous
+	mipp::vector<R> beta_prev; // node metrics (right to left) of the next step
+	mipp::vector<R> beta_cur;  // node metrics (right to left) of the current step
+	mipp::vector<R> post;      // a posteriori LLRs
+
+	// the transitions of the trellis are built at the construction from the shuffles of the chunks of states: 4 types of
+	// transitions (first/second previous state for alpha, first/second next state for beta)
+	std::vector<int>                      trans_off;   // first shuffle of each (type, chunk), 4*n_chunks +1
+	std::vector<int>                      trans_src;   // chunk of states to shuffle
+	mipp::vector<mipp::Reg<R>>            trans_cmask; // permutation of the states in the chunk
+	mipp::vector<mipp::Msk<mipp::N<R>()>> trans_msk;   // states of the output chunk given by the shuffle
+	mipp::vector<mipp::Msk<mipp::N<R>()>> gamma_msk;   // states of the output chunk using 'gamma[1]'
+	mipp::vector<mipp::Reg<R>>            gamma_sign;  // sign of the edge metrics (+1 or -1)
+
+public:
+	Decoder_RSC_BCJR_intra_generic_std(const int &K,
+	                                   const std::vector<std::vector<int>> &trellis,
+	                                   const bool buffered_encoding = true,
+	                                   const int n_frames = 1);
+	virtual ~Decoder_RSC_BCJR_intra_generic_std();
+
+protected:
+	void _decode_siso(const R *sys, const R *par, R *ext, const int frame_id);
+
+	void compute_gamma   (const R *sys, const R *par);
+	void compute_alpha   (                          );
+	void compute_beta_ext(const R *sys,       R *ext);
+
+private:
+	inline mipp::Reg<R> gather_states(const R *metrics, const int type, const int c) const;
+	inline mipp::Reg<R> edge_metrics (const mipp::Reg<R> &r_g0, const mipp::Reg<R> &r_g1, const int type,
+	                                  const int c) const;
+};
+}
+}
+
+#include "Decoder_RSC_BCJR_intra_generic_std.hxx"
+
+#endif /* DECODER_RSC_BCJR_INTRA_GENERIC_STD_HPP_ */
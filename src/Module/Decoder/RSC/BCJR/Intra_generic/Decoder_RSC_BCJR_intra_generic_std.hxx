@@ -0,0 +1,336 @@
+#include <limits>
+#include <sstream>
+#include <utility>
+#include <algorithm>
+#include <mipp.h>
+
+#include "Tools/Exception/exception.hpp"
+
+#include "../Intra/Decoder_RSC_BCJR_intra.hpp"
+
+#include "Decoder_RSC_BCJR_intra_generic_std.hpp"
+
+namespace aff3ct
+{
+namespace module
+{
+template <typename R>
+struct RSC_BCJR_intra_generic_init
+{
+	static R value()
+	{
+		return -std::numeric_limits<R>::max();
+	}
+};
+
+template <>
+struct RSC_BCJR_intra_generic_init <short>
+{
+	static short value()
+	{
+		return -(1 << (sizeof(short) * 8 -2));
+	}
+};
+
+template <>
+struct RSC_BCJR_intra_generic_init <signed char>
+{
+	static signed char value()
+	{
+		return -63;
+	}
+};
+
+template <typename B, typename R, tools::proto_max_i<R> MAX>
+Decoder_RSC_BCJR_intra_generic_std<B,R,MAX>
+::Decoder_RSC_BCJR_intra_generic_std(const int &K,
+                                     const std::vector<std::vector<int>> &trellis,
+                                     const bool buffered_encoding,
+                                     const int n_frames)
+: Decoder(K, 2*(K + (int)std::log2(trellis[0].size())), n_frames, 1),
+  Decoder_RSC_BCJR<B,R>(K, trellis, buffered_encoding, n_frames, 1),
+  n_chunks ((int)trellis[0].size() / mipp::N<R>()),
+  alpha    ((K + (int)std::log2(trellis[0].size())) * trellis[0].size()),
+  gamma    ((K + (int)std::log2(trellis[0].size()) + mipp::N<R>()) * 2),
+  beta_prev(trellis[0].size()),
+  beta_cur (trellis[0].size()),
+  post     (K + mipp::N<R>())
+{
+	const std::string name = "Decoder_RSC_BCJR_intra_generic_std";
+	this->set_name(name);
+
+	constexpr int n_lanes = mipp::N<R>();
+
+	if (this->n_states < n_lanes || this->n_states % n_lanes)
+	{
+		std::stringstream message;
+		message << "'n_states' has to be a multiple of 'mipp::nElReg<R>()' ('n_states' = " << this->n_states
+		        << ", 'mipp::nElReg<R>()' = " << n_lanes << ").";
+		throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	// (states, gamma index, sign) of the 4 types of transitions
+	const std::vector<int> sign_p(this->n_states, +1), sign_m(this->n_states, -1);
+	const std::vector<int>* transitions[4][3] = {{&trellis[0], &trellis[2], &trellis[1]},
+	                                             {&trellis[3], &trellis[5], &trellis[4]},
+	                                             {&trellis[6], &trellis[7], &sign_p    },
+	                                             {&trellis[8], &trellis[9], &sign_m    }};
+
+	const auto r_one = mipp::Reg<R>((R)1);
+	std::vector<uint32_t> cmask(n_lanes);
+	mipp::vector<R> lanes(n_lanes), g_lanes(n_lanes), s_lanes(n_lanes);
+	for (auto t = 0; t < 4; t++)
+	{
+		const auto &states = *transitions[t][0];
+		const auto &g_idx  = *transitions[t][1];
+		const auto &signs  = *transitions[t][2];
+
+		for (auto c = 0; c < n_chunks; c++)
+		{
+			trans_off.push_back((int)trans_src.size());
+
+			// one shuffle per chunk of states which contains at least one of the required states
+			std::vector<int> srcs;
+			for (auto l = 0; l < n_lanes; l++)
+				if (std::find(srcs.begin(), srcs.end(), states[c * n_lanes +l] / n_lanes) == srcs.end())
+					srcs.push_back(states[c * n_lanes +l] / n_lanes);
+
+			for (auto src : srcs)
+			{
+				for (auto l = 0; l < n_lanes; l++)
+				{
+					const auto s = states[c * n_lanes +l];
+					cmask[l] = (s / n_lanes == src) ? (uint32_t)(s % n_lanes) : 0;
+					lanes[l] = (s / n_lanes == src) ? (R)1                    : (R)0;
+				}
+
+				trans_src  .push_back(src);
+				trans_cmask.push_back(mipp::Reg<R>::cmask(cmask.data()));
+				trans_msk  .push_back(mipp::Reg<R>(lanes.data()) == r_one);
+			}
+
+			for (auto l = 0; l < n_lanes; l++)
+			{
+				g_lanes[l] = (R)g_idx[c * n_lanes +l];
+				s_lanes[l] = (R)signs[c * n_lanes +l];
+			}
+
+			gamma_msk .push_back(mipp::Reg<R>(g_lanes.data()) == r_one);
+			gamma_sign.push_back(mipp::Reg<R>(s_lanes.data()));
+		}
+	}
+	trans_off.push_back((int)trans_src.size());
+
+	// init alpha values (the metrics of the last step of the trellis are the same for beta)
+	std::fill(alpha.begin(), alpha.begin() + this->n_states, RSC_BCJR_intra_generic_init<R>::value());
+	alpha[0] = (R)0;
+}
+
+template <typename B, typename R, tools::proto_max_i<R> MAX>
+Decoder_RSC_BCJR_intra_generic_std<B,R,MAX>
+::~Decoder_RSC_BCJR_intra_generic_std()
+{
+}
+
+// ====================================================================================================== normalization
+template <typename R>
+struct RSC_BCJR_intra_generic_normalize
+{
+	static void apply(R *metrics, const int &n_chunks, const int &i)
+	{
+		// no need to do something
+	}
+};
+
+template <>
+struct RSC_BCJR_intra_generic_normalize <short>
+{
+	static void apply(short *metrics, const int &n_chunks, const int &i)
+	{
+		constexpr auto n_lanes = mipp::nElmtsPerRegister<short>();
+
+		// normalization
+		if (i % 8 == 0)
+		{
+			const auto r_norm_val = mipp::Reg<short>(metrics[0]);
+			for (auto c = 0; c < n_chunks; c++)
+			{
+				auto r_m = mipp::Reg<short>(&metrics[c * n_lanes]);
+				r_m -= r_norm_val;
+				r_m.store(&metrics[c * n_lanes]);
+			}
+		}
+	}
+};
+
+template <>
+struct RSC_BCJR_intra_generic_normalize <signed char>
+{
+	static void apply(signed char *metrics, const int &n_chunks, const int &i)
+	{
+		constexpr auto n_lanes = mipp::nElmtsPerRegister<signed char>();
+
+		// normalization & saturation
+		const auto r_norm_val = mipp::Reg<signed char>(metrics[0]);
+		for (auto c = 0; c < n_chunks; c++)
+		{
+			auto r_m = mipp::Reg<signed char>(&metrics[c * n_lanes]);
+			r_m = (r_m - r_norm_val).sat(-63, 63);
+			r_m.store(&metrics[c * n_lanes]);
+		}
+	}
+};
+
+template <typename B, typename R, tools::proto_max_i<R> MAX>
+mipp::Reg<R> Decoder_RSC_BCJR_intra_generic_std<B,R,MAX>
+::gather_states(const R *metrics, const int type, const int c) const
+{
+	constexpr int n_lanes = mipp::N<R>();
+
+	auto s     = trans_off[type * n_chunks + c   ];
+	auto s_end = trans_off[type * n_chunks + c +1];
+
+	auto r_m = mipp::Reg<R>(&metrics[trans_src[s] * n_lanes]).shuff(trans_cmask[s]);
+	for (s++; s < s_end; s++)
+	{
+		const auto r_src = mipp::Reg<R>(&metrics[trans_src[s] * n_lanes]).shuff(trans_cmask[s]);
+		r_m = mipp::blend(r_src, r_m, trans_msk[s]);
+	}
+
+	return r_m;
+}
+
+template <typename B, typename R, tools::proto_max_i<R> MAX>
+mipp::Reg<R> Decoder_RSC_BCJR_intra_generic_std<B,R,MAX>
+::edge_metrics(const mipp::Reg<R> &r_g0, const mipp::Reg<R> &r_g1, const int type, const int c) const
+{
+	const auto idx = type * n_chunks + c;
+	return mipp::neg(mipp::blend(r_g1, r_g0, gamma_msk[idx]), gamma_sign[idx]);
+}
+
+template <typename B, typename R, tools::proto_max_i<R> MAX>
+void Decoder_RSC_BCJR_intra_generic_std<B,R,MAX>
+::compute_gamma(const R *sys, const R *par)
+{
+	constexpr int n_lanes = mipp::N<R>();
+
+	// compute gamma values
+	for (auto i = 0; i < this->K + this->n_ff; i += n_lanes)
+	{
+		const auto r_sys = mipp::Reg<R>(&sys[i]);
+		const auto r_par = mipp::Reg<R>(&par[i]);
+
+		// there is a big loss of precision here in fixed point
+		const auto r_g0 = RSC_BCJR_intra_div_or_not<R>::apply(r_sys + r_par);
+		const auto r_g1 = RSC_BCJR_intra_div_or_not<R>::apply(r_sys - r_par);
+
+		const auto r_g0g1 = mipp::interleave(r_g0, r_g1);
+
+		r_g0g1.val[0].store(&this->gamma[i*2 + 0*n_lanes]);
+		r_g0g1.val[1].store(&this->gamma[i*2 + 1*n_lanes]);
+	}
+}
+
+template <typename B, typename R, tools::proto_max_i<R> MAX>
+void Decoder_RSC_BCJR_intra_generic_std<B,R,MAX>
+::compute_alpha()
+{
+	constexpr int n_lanes = mipp::N<R>();
+	const auto n_states = this->n_states;
+
+	// compute alpha values [trellis forward traversal ->]
+	for (auto i = 1; i < this->K + this->n_ff; i++)
+	{
+		const auto a_prev = this->alpha.data() + (i -1) * n_states;
+		const auto a_cur  = this->alpha.data() + (i -0) * n_states;
+
+		const auto r_g0 = mipp::Reg<R>(this->gamma[(i -1)*2 +0]);
+		const auto r_g1 = mipp::Reg<R>(this->gamma[(i -1)*2 +1]);
+
+		for (auto c = 0; c < n_chunks; c++)
+		{
+			const auto r_m0 = this->gather_states(a_prev, 0, c) + this->edge_metrics(r_g0, r_g1, 0, c);
+			const auto r_m1 = this->gather_states(a_prev, 1, c) + this->edge_metrics(r_g0, r_g1, 1, c);
+
+			MAX(r_m0, r_m1).store(&a_cur[c * n_lanes]);
+		}
+
+		RSC_BCJR_intra_generic_normalize<R>::apply(a_cur, n_chunks, i);
+	}
+}
+
+template <typename B, typename R, tools::proto_max_i<R> MAX>
+void Decoder_RSC_BCJR_intra_generic_std<B,R,MAX>
+::compute_beta_ext(const R *sys, R *ext)
+{
+	constexpr int n_lanes = mipp::N<R>();
+	const auto n_states = this->n_states;
+
+	// compute the first beta values [trellis backward traversal <-]
+	std::copy(this->alpha.begin(), this->alpha.begin() + n_states, beta_prev.begin());
+	for (auto i = this->K + this->n_ff -1; i >= this->K; i--)
+	{
+		const auto r_g0 = mipp::Reg<R>(this->gamma[i*2 +0]);
+		const auto r_g1 = mipp::Reg<R>(this->gamma[i*2 +1]);
+
+		for (auto c = 0; c < n_chunks; c++)
+		{
+			const auto r_b0 = this->gather_states(beta_prev.data(), 2, c) + this->edge_metrics(r_g0, r_g1, 2, c);
+			const auto r_b1 = this->gather_states(beta_prev.data(), 3, c) + this->edge_metrics(r_g0, r_g1, 3, c);
+
+			MAX(r_b0, r_b1).store(&beta_cur[c * n_lanes]);
+		}
+
+		RSC_BCJR_intra_generic_normalize<R>::apply(beta_cur.data(), n_chunks, i);
+		std::swap(beta_prev, beta_cur);
+	}
+
+	// compute the beta values [trellis backward traversal <-] + compute the a posteriori values
+	for (auto i = this->K -1; i >= 0; i--)
+	{
+		const auto a_cur = this->alpha.data() + i * n_states;
+
+		const auto r_g0 = mipp::Reg<R>(this->gamma[i*2 +0]);
+		const auto r_g1 = mipp::Reg<R>(this->gamma[i*2 +1]);
+
+		auto r_b0   = this->gather_states(beta_prev.data(), 2, 0) + this->edge_metrics(r_g0, r_g1, 2, 0);
+		auto r_b1   = this->gather_states(beta_prev.data(), 3, 0) + this->edge_metrics(r_g0, r_g1, 3, 0);
+		auto r_a    = mipp::Reg<R>(&a_cur[0]);
+		auto r_max0 = r_a + r_b0;
+		auto r_max1 = r_a + r_b1;
+		MAX(r_b0, r_b1).store(&beta_cur[0]);
+
+		for (auto c = 1; c < n_chunks; c++)
+		{
+			r_b0   = this->gather_states(beta_prev.data(), 2, c) + this->edge_metrics(r_g0, r_g1, 2, c);
+			r_b1   = this->gather_states(beta_prev.data(), 3, c) + this->edge_metrics(r_g0, r_g1, 3, c);
+			r_a    = mipp::Reg<R>(&a_cur[c * n_lanes]);
+			r_max0 = MAX(r_max0, r_a + r_b0);
+			r_max1 = MAX(r_max1, r_a + r_b1);
+			MAX(r_b0, r_b1).store(&beta_cur[c * n_lanes]);
+		}
+
+		const auto r_post = mipp::Reduction<R,MAX>::apply(r_max0) - mipp::Reduction<R,MAX>::apply(r_max1);
+		post[i] = r_post[0];
+
+		RSC_BCJR_intra_generic_normalize<R>::apply(beta_cur.data(), n_chunks, i);
+		std::swap(beta_prev, beta_cur);
+	}
+
+	// compute extrinsic values
+	for (auto i = 0; i < this->K; i += n_lanes)
+		RSC_BCJR_intra_post<R>::compute(mipp::Reg<R>(&post[i])).store(&post[i]);
+	for (auto i = 0; i < this->K; i++)
+		ext[i] = post[i] - sys[i];
+}
+
+template <typename B, typename R, tools::proto_max_i<R> MAX>
+void Decoder_RSC_BCJR_intra_generic_std<B,R,MAX>
+::_decode_siso(const R *sys, const R *par, R *ext, const int frame_id)
+{
+	this->compute_gamma   (sys, par);
+	this->compute_alpha   (        );
+	this->compute_beta_ext(sys, ext);
+}
+}
+}
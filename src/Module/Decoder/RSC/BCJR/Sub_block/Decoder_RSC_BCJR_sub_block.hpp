@@ -0,0 +1,82 @@
+#ifndef DECODER_RSC_BCJR_SUB_BLOCK_HPP_
+#define DECODER_RSC_BCJR_SUB_BLOCK_HPP_
+
+#include <vector>
+#include <mipp.h>
+
+#include "Tools/Math/max.h"
+
+#include "../Decoder_RSC_BCJR.hpp"
+
+namespace aff3ct
+{
+namespace module
+{
+// sub-block parallel BCJR for any trellis: one frame is split in 'mipp::nElReg<R>()' sub-blocks which are decoded in
+// the SIMD lanes. The metrics at the borders of the sub-blocks are initialized with the metrics computed by the
+// neighbor sub-blocks during the previous call on the same frame (next iteration initialization), they are stored per
+// frame and the 'reset' method has to be called before decoding new frames (the turbo decoders call it for each frame
+// and the BFERI simulation after each check of the monitor). The forward recursion uses a radix-4 trellis (2 steps at
+// once) and only stores the alpha values of the even steps.
+template <typename B = int, typename R = float, tools::proto_max_i<R> MAX = tools::max_i>
+class Decoder_RSC_BCJR_sub_block : public Decoder_RSC_BCJR<B,R>
+{
+protected:
+	const int n_steps;    // number of steps in the trellis (K + n_ff)
+	const int sb_len;     // number of steps in a sub-block (even)
+	const int term_lane;  // sub-block containing the last node of the trellis
+	const int term_node;  // position of the last node of the trellis in its sub-block
+
+	mipp::vector<R> sys_pad, par_pad, ext_pad; // frame padded to 'nElReg * sb_len'
+	mipp::vector<R> sys_sb,  par_sb,  ext_sb;  // sub-blocks interleaved in the SIMD lanes
+
+	mipp::vector<R> alpha;      // node metrics (left to right) of the even nodes
+	mipp::vector<R> alpha_odd;  // node metrics (left to right) of the current odd node
+	mipp::vector<R> gamma;      // edge metrics, the 2 registers of a step are contiguous
+	mipp::vector<R> beta_prev;  // node metrics (right to left) of the next node
+	mipp::vector<R> beta_cur;   // node metrics (right to left) of the current node
+	mipp::vector<R> alpha_init; // node metrics at the first node of each sub-block (for each frame)
+	mipp::vector<R> beta_init;  // node metrics at the last  node of each sub-block (for each frame)
+
+	// radix-4 trellis: the 4 paths of 2 steps ending in each state (state at the beginning of the path, combination
+	// of the edge metrics)
+	std::vector<int> r4_state;
+	std::vector<int> r4_combo;
+	std::vector<int> r4_used_combos;
+
+	mipp::Msk<mipp::N<R>()>    term_msk;     // lane of the last node of the trellis
+	mipp::vector<mipp::Reg<R>> term_metrics; // metrics of the last node of the trellis (state 0)
+
+	std::vector<bool> is_init; // true when the borders of a frame can be initialized by the previous call
+
+public:
+	Decoder_RSC_BCJR_sub_block(const int &K,
+	                           const std::vector<std::vector<int>> &trellis,
+	                           const bool buffered_encoding = true,
+	                           const int n_frames = 1);
+	virtual ~Decoder_RSC_BCJR_sub_block();
+
+	void reset();
+
+protected:
+	void _decode_siho(const R *Y_N, B *V_K, const int frame_id);
+	void _decode_siso(const R *sys, const R *par, R *ext, const int frame_id);
+
+	void load_sub_blocks (const R *sys, const R *par);
+	void init_borders    (const int f               );
+	void compute_gamma   (                          );
+	void compute_alpha   (const int f               );
+	void compute_beta_ext(const int f               );
+	void store_sub_blocks(R *ext                    );
+
+private:
+	inline void step_alpha   (const R *a_prev, R *a_cur, const int i);
+	inline void step_beta_ext(const R *alpha, R *ext, const int i);
+	inline void terminate    (R *metrics, const int node);
+};
+}
+}
+
+#include "Decoder_RSC_BCJR_sub_block.hxx"
+
+#endif /* DECODER_RSC_BCJR_SUB_BLOCK_HPP_ */
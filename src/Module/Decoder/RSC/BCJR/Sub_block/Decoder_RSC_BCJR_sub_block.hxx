@@ -0,0 +1,351 @@
+#include <utility>
+#include <algorithm>
+#include <mipp.h>
+
+#include "Tools/Exception/exception.hpp"
+#include "Tools/Perf/Reorderer/Reorderer.hpp"
+
+#include "../Inter/Decoder_RSC_BCJR_inter.hpp"
+#include "../Inter_generic/Decoder_RSC_BCJR_inter_generic_std.hpp"
+
+#include "Decoder_RSC_BCJR_sub_block.hpp"
+
+namespace aff3ct
+{
+namespace module
+{
+template <typename B, typename R, tools::proto_max_i<R> MAX>
+Decoder_RSC_BCJR_sub_block<B,R,MAX>
+::Decoder_RSC_BCJR_sub_block(const int &K,
+                             const std::vector<std::vector<int>> &trellis,
+                             const bool buffered_encoding,
+                             const int n_frames)
+: Decoder(K, 2*(K + (int)std::log2(trellis[0].size())), n_frames, 1),
+  Decoder_RSC_BCJR<B,R>(K, trellis, buffered_encoding, n_frames, 1),
+  n_steps   (K + this->n_ff),
+  sb_len    ((((n_steps + mipp::N<R>() -1) / mipp::N<R>()) +1) / 2 * 2),
+  term_lane ((n_steps -1) / sb_len),
+  term_node (n_steps - term_lane * sb_len),
+  sys_pad   (sb_len * mipp::N<R>(), (R)0),
+  par_pad   (sb_len * mipp::N<R>(), (R)0),
+  ext_pad   (sb_len * mipp::N<R>(), (R)0),
+  sys_sb    (sb_len * mipp::N<R>()),
+  par_sb    (sb_len * mipp::N<R>()),
+  ext_sb    (sb_len * mipp::N<R>()),
+  alpha     ((sb_len / 2) * this->n_states * mipp::N<R>()),
+  alpha_odd (               this->n_states * mipp::N<R>()),
+  gamma     ( sb_len * 2                   * mipp::N<R>()),
+  beta_prev (               this->n_states * mipp::N<R>()),
+  beta_cur  (               this->n_states * mipp::N<R>()),
+  alpha_init(n_frames *     this->n_states * mipp::N<R>()),
+  beta_init (n_frames *     this->n_states * mipp::N<R>()),
+  r4_state  (4 * this->n_states),
+  r4_combo  (4 * this->n_states),
+  term_metrics(this->n_states),
+  is_init   (n_frames, false)
+{
+	const std::string name = "Decoder_RSC_BCJR_sub_block";
+	this->set_name(name);
+
+	// the edge metric of a transition is coded on 2 bits: (gamma index, negative sign), the edge metrics of a path of 2
+	// steps are coded on 4 bits
+	auto edge_code = [&](const int state, const int k) -> int
+	{
+		const auto sign = trellis[k == 0 ? 1 : 4][state];
+		const auto gidx = trellis[k == 0 ? 2 : 5][state];
+		return gidx * 2 + (sign < 0 ? 1 : 0);
+	};
+
+	std::vector<bool> used(16, false);
+	for (auto s = 0; s < this->n_states; s++)
+		for (auto k2 = 0; k2 < 2; k2++)
+		{
+			const auto mid = trellis[k2 == 0 ? 0 : 3][s];
+			for (auto k1 = 0; k1 < 2; k1++)
+			{
+				const auto combo = edge_code(mid, k1) * 4 + edge_code(s, k2);
+				r4_state[s * 4 + k2 * 2 + k1] = trellis[k1 == 0 ? 0 : 3][mid];
+				r4_combo[s * 4 + k2 * 2 + k1] = combo;
+				used[combo] = true;
+			}
+		}
+	for (auto c = 0; c < 16; c++)
+		if (used[c])
+			r4_used_combos.push_back(c);
+
+	mipp::vector<R> lanes(mipp::N<R>(), (R)0);
+	lanes[term_lane] = (R)1;
+	term_msk = mipp::Reg<R>(lanes.data()) == mipp::Reg<R>((R)1);
+
+	term_metrics[0] = mipp::Reg<R>((R)0);
+	for (auto s = 1; s < this->n_states; s++)
+		term_metrics[s] = mipp::Reg<R>(RSC_BCJR_inter_generic_init<R>::value());
+}
+
+template <typename B, typename R, tools::proto_max_i<R> MAX>
+Decoder_RSC_BCJR_sub_block<B,R,MAX>
+::~Decoder_RSC_BCJR_sub_block()
+{
+}
+
+template <typename B, typename R, tools::proto_max_i<R> MAX>
+void Decoder_RSC_BCJR_sub_block<B,R,MAX>
+::reset()
+{
+	std::fill(this->is_init.begin(), this->is_init.end(), false);
+}
+
+template <typename B, typename R, tools::proto_max_i<R> MAX>
+void Decoder_RSC_BCJR_sub_block<B,R,MAX>
+::load_sub_blocks(const R *sys, const R *par)
+{
+	constexpr auto n_lanes = mipp::nElmtsPerRegister<R>();
+
+	std::copy(sys, sys + n_steps, sys_pad.begin());
+	std::copy(par, par + n_steps, par_pad.begin());
+
+	std::vector<const R*> blocks(n_lanes);
+	for (auto p = 0; p < n_lanes; p++)
+		blocks[p] = sys_pad.data() + p * sb_len;
+	tools::Reorderer_static<R,n_lanes>::apply(blocks, sys_sb.data(), sb_len);
+
+	for (auto p = 0; p < n_lanes; p++)
+		blocks[p] = par_pad.data() + p * sb_len;
+	tools::Reorderer_static<R,n_lanes>::apply(blocks, par_sb.data(), sb_len);
+}
+
+template <typename B, typename R, tools::proto_max_i<R> MAX>
+void Decoder_RSC_BCJR_sub_block<B,R,MAX>
+::store_sub_blocks(R *ext)
+{
+	constexpr auto n_lanes = mipp::nElmtsPerRegister<R>();
+
+	std::vector<R*> blocks(n_lanes);
+	for (auto p = 0; p < n_lanes; p++)
+		blocks[p] = ext_pad.data() + p * sb_len;
+	tools::Reorderer_static<R,n_lanes>::apply_rev(ext_sb.data(), blocks, sb_len);
+
+	std::copy(ext_pad.begin(), ext_pad.begin() + this->K, ext);
+}
+
+template <typename B, typename R, tools::proto_max_i<R> MAX>
+void Decoder_RSC_BCJR_sub_block<B,R,MAX>
+::init_borders(const int f)
+{
+	constexpr auto n_lanes = mipp::nElmtsPerRegister<R>();
+	const auto a_init = this->alpha_init.data() + f * this->n_states * n_lanes;
+	const auto b_init = this->beta_init .data() + f * this->n_states * n_lanes;
+
+	// without the metrics of a previous call on this frame all the states are equiprobable at the borders
+	if (!this->is_init[f])
+	{
+		std::fill(a_init, a_init + this->n_states * n_lanes, (R)0);
+		std::fill(b_init, b_init + this->n_states * n_lanes, (R)0);
+	}
+
+	// the first sub-block starts in the state 0
+	a_init[0] = (R)0;
+	for (auto s = 1; s < this->n_states; s++)
+		a_init[s * n_lanes] = RSC_BCJR_inter_generic_init<R>::value();
+}
+
+template <typename B, typename R, tools::proto_max_i<R> MAX>
+void Decoder_RSC_BCJR_sub_block<B,R,MAX>
+::terminate(R *metrics, const int node)
+{
+	constexpr auto n_lanes = mipp::nElmtsPerRegister<R>();
+
+	// the last sub-block ends in the state 0
+	if (node == term_node)
+		for (auto s = 0; s < this->n_states; s++)
+		{
+			const auto r_m = mipp::blend(term_metrics[s], mipp::Reg<R>(&metrics[s * n_lanes]), term_msk);
+			r_m.store(&metrics[s * n_lanes]);
+		}
+}
+
+template <typename B, typename R, tools::proto_max_i<R> MAX>
+void Decoder_RSC_BCJR_sub_block<B,R,MAX>
+::compute_gamma()
+{
+	constexpr auto n_lanes = mipp::nElmtsPerRegister<R>();
+
+	for (auto i = 0; i < sb_len; i++)
+	{
+		const auto r_sys = mipp::Reg<R>(&sys_sb[i * n_lanes]);
+		const auto r_par = mipp::Reg<R>(&par_sb[i * n_lanes]);
+
+		// there is a big loss of precision here in fixed point
+		const auto r_g0 = RSC_BCJR_inter_div_or_not<R>::apply(r_sys + r_par);
+		const auto r_g1 = RSC_BCJR_inter_div_or_not<R>::apply(r_sys - r_par);
+
+		r_g0.store(&this->gamma[(2*i +0) * n_lanes]);
+		r_g1.store(&this->gamma[(2*i +1) * n_lanes]);
+	}
+}
+
+template <typename B, typename R, tools::proto_max_i<R> MAX>
+void Decoder_RSC_BCJR_sub_block<B,R,MAX>
+::compute_alpha(const int f)
+{
+	constexpr auto n_lanes = mipp::nElmtsPerRegister<R>();
+	const auto n_states = this->n_states;
+	const auto r_zero   = mipp::Reg<R>((R)0);
+	const auto a_init   = this->alpha_init.data() + f * n_states * n_lanes;
+
+	std::copy(a_init, a_init + n_states * n_lanes, this->alpha.begin());
+
+	// compute alpha values on the radix-4 trellis [trellis forward traversal ->]
+	mipp::Reg<R> r_e1[4], r_e2[4], r_c[16];
+	for (auto q = 0; q < sb_len / 2; q++)
+	{
+		const auto a_prev = this->alpha.data() + q * n_states * n_lanes;
+		const auto a_cur  = (q < sb_len / 2 -1) ? a_prev + n_states * n_lanes : alpha_odd.data();
+
+		for (auto g = 0; g < 2; g++)
+		{
+			r_e1[2*g +0] = mipp::Reg<R>(&this->gamma[(2*(2*q +0) +g) * n_lanes]);
+			r_e2[2*g +0] = mipp::Reg<R>(&this->gamma[(2*(2*q +1) +g) * n_lanes]);
+			r_e1[2*g +1] = r_zero - r_e1[2*g +0];
+			r_e2[2*g +1] = r_zero - r_e2[2*g +0];
+		}
+		for (auto c : r4_used_combos)
+			r_c[c] = r_e1[c / 4] + r_e2[c % 4];
+
+		for (auto s = 0; s < n_states; s++)
+		{
+			auto r_a = mipp::Reg<R>(&a_prev[r4_state[s * 4] * n_lanes]) + r_c[r4_combo[s * 4]];
+			for (auto k = 1; k < 4; k++)
+				r_a = MAX(r_a, mipp::Reg<R>(&a_prev[r4_state[s * 4 +k] * n_lanes]) + r_c[r4_combo[s * 4 +k]]);
+			r_a.store(&a_cur[s * n_lanes]);
+		}
+
+		RSC_BCJR_inter_generic_normalize<R>::apply(a_cur, n_states, 2*q +2);
+	}
+
+	// the last alpha values of a sub-block initialize the next sub-block in the next call
+	for (auto s = 0; s < n_states; s++)
+		for (auto p = n_lanes -1; p > 0; p--)
+			a_init[s * n_lanes + p] = alpha_odd[s * n_lanes + p -1];
+}
+
+template <typename B, typename R, tools::proto_max_i<R> MAX>
+void Decoder_RSC_BCJR_sub_block<B,R,MAX>
+::step_alpha(const R *a_prev, R *a_cur, const int i)
+{
+	constexpr auto n_lanes = mipp::nElmtsPerRegister<R>();
+
+	const auto &prev0 = this->trellis[0], &sign0 = this->trellis[1], &gidx0 = this->trellis[2];
+	const auto &prev1 = this->trellis[3], &sign1 = this->trellis[4], &gidx1 = this->trellis[5];
+
+	const mipp::Reg<R> r_g[2] = {mipp::Reg<R>(&this->gamma[(2*i +0) * n_lanes]),
+	                             mipp::Reg<R>(&this->gamma[(2*i +1) * n_lanes])};
+
+	for (auto j = 0; j < this->n_states; j++)
+	{
+		const auto r_a0 = mipp::Reg<R>(&a_prev[prev0[j] * n_lanes]);
+		const auto r_a1 = mipp::Reg<R>(&a_prev[prev1[j] * n_lanes]);
+
+		const auto r_m0 = (sign0[j] > 0) ? r_a0 + r_g[gidx0[j]] : r_a0 - r_g[gidx0[j]];
+		const auto r_m1 = (sign1[j] > 0) ? r_a1 + r_g[gidx1[j]] : r_a1 - r_g[gidx1[j]];
+
+		MAX(r_m0, r_m1).store(&a_cur[j * n_lanes]);
+	}
+}
+
+template <typename B, typename R, tools::proto_max_i<R> MAX>
+void Decoder_RSC_BCJR_sub_block<B,R,MAX>
+::step_beta_ext(const R *a_cur, R *ext, const int i)
+{
+	constexpr auto n_lanes = mipp::nElmtsPerRegister<R>();
+
+	const auto &next0 = this->trellis[6], &gidx0 = this->trellis[7];
+	const auto &next1 = this->trellis[8], &gidx1 = this->trellis[9];
+
+	const mipp::Reg<R> r_g[2] = {mipp::Reg<R>(&this->gamma[(2*i +0) * n_lanes]),
+	                             mipp::Reg<R>(&this->gamma[(2*i +1) * n_lanes])};
+
+	auto r_b0   = mipp::Reg<R>(&beta_prev[next0[0] * n_lanes]) + r_g[gidx0[0]];
+	auto r_b1   = mipp::Reg<R>(&beta_prev[next1[0] * n_lanes]) - r_g[gidx1[0]];
+	auto r_a    = mipp::Reg<R>(&a_cur[0]);
+	auto r_max0 = r_a + r_b0;
+	auto r_max1 = r_a + r_b1;
+	MAX(r_b0, r_b1).store(&beta_cur[0]);
+
+	for (auto j = 1; j < this->n_states; j++)
+	{
+		r_b0   = mipp::Reg<R>(&beta_prev[next0[j] * n_lanes]) + r_g[gidx0[j]];
+		r_b1   = mipp::Reg<R>(&beta_prev[next1[j] * n_lanes]) - r_g[gidx1[j]];
+		r_a    = mipp::Reg<R>(&a_cur[j * n_lanes]);
+		r_max0 = MAX(r_max0, r_a + r_b0);
+		r_max1 = MAX(r_max1, r_a + r_b1);
+		MAX(r_b0, r_b1).store(&beta_cur[j * n_lanes]);
+	}
+
+	const auto r_post = RSC_BCJR_inter_post<R>::compute(r_max0 - r_max1);
+	const auto r_ext  = r_post - &sys_sb[i * n_lanes];
+	r_ext.store(&ext[i * n_lanes]);
+
+	RSC_BCJR_inter_generic_normalize<R>::apply(beta_cur.data(), this->n_states, i);
+	this->terminate(beta_cur.data(), i);
+	std::swap(beta_prev, beta_cur);
+}
+
+template <typename B, typename R, tools::proto_max_i<R> MAX>
+void Decoder_RSC_BCJR_sub_block<B,R,MAX>
+::compute_beta_ext(const int f)
+{
+	constexpr auto n_lanes = mipp::nElmtsPerRegister<R>();
+	const auto n_states = this->n_states;
+	const auto b_init   = this->beta_init.data() + f * n_states * n_lanes;
+
+	std::copy(b_init, b_init + n_states * n_lanes, beta_prev.begin());
+	this->terminate(beta_prev.data(), sb_len);
+
+	// compute the beta values [trellis backward traversal <-] + compute extrinsic values, the alpha values of the odd
+	// nodes are recomputed from the even nodes
+	for (auto q = sb_len / 2 -1; q >= 0; q--)
+	{
+		const auto a_even = this->alpha.data() + q * n_states * n_lanes;
+
+		this->step_alpha   (a_even, alpha_odd.data(), 2*q   );
+		this->step_beta_ext(alpha_odd.data(), ext_sb.data(), 2*q +1);
+		this->step_beta_ext(a_even,           ext_sb.data(), 2*q   );
+	}
+
+	// the first beta values of a sub-block initialize the previous sub-block in the next call
+	for (auto s = 0; s < n_states; s++)
+	{
+		for (auto p = 0; p < n_lanes -1; p++)
+			b_init[s * n_lanes + p] = beta_prev[s * n_lanes + p +1];
+		b_init[s * n_lanes + n_lanes -1] = (R)0;
+	}
+}
+
+template <typename B, typename R, tools::proto_max_i<R> MAX>
+void Decoder_RSC_BCJR_sub_block<B,R,MAX>
+::_decode_siso(const R *sys, const R *par, R *ext, const int frame_id)
+{
+	// the borders are stored per frame: the metrics of a frame never initialize the borders of another frame
+	const auto f = (frame_id < 0 ? 0 : frame_id) % this->n_frames;
+
+	this->load_sub_blocks (sys, par);
+	this->init_borders    (f       );
+	this->compute_gamma   (        );
+	this->compute_alpha   (f       );
+	this->compute_beta_ext(f       );
+	this->store_sub_blocks(ext     );
+
+	this->is_init[f] = true;
+}
+
+template <typename B, typename R, tools::proto_max_i<R> MAX>
+void Decoder_RSC_BCJR_sub_block<B,R,MAX>
+::_decode_siho(const R *Y_N, B *V_K, const int frame_id)
+{
+	// a new frame: the metrics of the previous call on this frame can not be used
+	this->is_init[(frame_id < 0 ? 0 : frame_id) % this->n_frames] = false;
+	Decoder_RSC_BCJR<B,R>::_decode_siho(Y_N, V_K, frame_id);
+}
+}
+}
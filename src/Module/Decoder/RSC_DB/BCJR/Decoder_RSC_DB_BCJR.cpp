@@ -16,22 +16,23 @@ Decoder_RSC_DB_BCJR<B,R>
 ::Decoder_RSC_DB_BCJR(const int K,
                       const std::vector<std::vector<int>> &trellis,
                       const bool buffered_encoding,
-                      const int n_frames)
-: Decoder               (K, 2 * K, n_frames, 1                   ),
-  Decoder_SISO_SIHO<B,R>(K, 2 * K, n_frames, 1                   ),
-  n_states              ((int)trellis[0].size()/4                ),
-  n_ff                  ((int)std::log2(n_states)                ),
-  buffered_encoding     (buffered_encoding                       ),
-  trellis               (trellis                                 ),
-  sys                   (2*K                                     ),
-  par                   (  K                                     ),
-  ext                   (2*K                                     ),
-  s                     (  K                                     ),
-  alpha_mp              (n_states                                ),
-  beta_mp               (n_states                                ),
-  alpha                 (K/2 + 1, std::vector<R>(n_states    , 0)),
-  beta                  (K/2 + 1, std::vector<R>(n_states    , 0)),
-  gamma                 (K/2    , std::vector<R>(n_states * 4, 0))
+                      const int n_frames,
+                      const int simd_inter_frame_level)
+: Decoder               (K, 2 * K, n_frames, simd_inter_frame_level),
+  Decoder_SISO_SIHO<B,R>(K, 2 * K, n_frames, simd_inter_frame_level),
+  n_states              ((int)trellis[0].size()/4                  ),
+  n_ff                  ((int)std::log2(n_states)                  ),
+  buffered_encoding     (buffered_encoding                         ),
+  trellis               (trellis                                   ),
+  sys                   (2*K      * simd_inter_frame_level         ),
+  par                   (  K      * simd_inter_frame_level         ),
+  ext                   (2*K      * simd_inter_frame_level         ),
+  s                     (  K      * simd_inter_frame_level         ),
+  alpha_mp              (n_states * simd_inter_frame_level         ),
+  beta_mp               (n_states * simd_inter_frame_level         ),
+  alpha                 (K/2 + 1,   std::vector<R>(n_states    , 0)),
+  beta                  (K/2 + 1,   std::vector<R>(n_states    , 0)),
+  gamma                 (K/2    ,   std::vector<R>(n_states * 4, 0))
 {
 	const std::string name = "Decoder_RSC_DB_BCJR";
 	this->set_name(name);
@@ -56,33 +57,42 @@ void Decoder_RSC_DB_BCJR<B,R>
 {
 	notify_new_frame();
 
-	if (buffered_encoding)
+	// with the inter-frame SIMD the LLRs of the frames are interleaved: the LLR 'i' of the frame 'f' is at the
+	// position 'i * n_frames + f'
+	const auto n_frames = this->get_simd_inter_frame_level();
+
+	for (auto f = 0; f < n_frames; f++)
 	{
-		for (auto i = 0; i < this->K / 2; i++)
+		const auto Y_N_f = Y_N + f * this->N;
+
+		if (buffered_encoding)
 		{
-			R a = tools::div2(Y_N[2*i  ]);
-			R b = tools::div2(Y_N[2*i+1]);
-			sys[4*i + 0] =  a + b;
-			sys[4*i + 1] =  a - b;
-			sys[4*i + 2] = -a + b;
-			sys[4*i + 3] = -a - b;
+			for (auto i = 0; i < this->K / 2; i++)
+			{
+				R a = tools::div2(Y_N_f[2*i  ]);
+				R b = tools::div2(Y_N_f[2*i+1]);
+				sys[(4*i + 0) * n_frames + f] =  a + b;
+				sys[(4*i + 1) * n_frames + f] =  a - b;
+				sys[(4*i + 2) * n_frames + f] = -a + b;
+				sys[(4*i + 3) * n_frames + f] = -a - b;
+			}
+			for (auto i = 0; i < this->K; i++)
+				par[i * n_frames + f] = tools::div2(Y_N_f[this->K + i]);
 		}
-		for (auto i = 0; i < this->K; i++)
-			par[i] = tools::div2(Y_N[this->K + i]);
-	}
-	else
-	{
-		for (auto i = 0; i < this->K / 2; i++)
+		else
 		{
-			R a = tools::div2(Y_N[4*i  ]);
-			R b = tools::div2(Y_N[4*i+1]);
-			sys[4*i + 0] =  a + b;
-			sys[4*i + 1] =  a - b;
-			sys[4*i + 2] = -a + b;
-			sys[4*i + 3] = -a - b;
-
-			par[2*i  ] = Y_N[4*i + 2];
-			par[2*i+2] = Y_N[4*i + 3];
+			for (auto i = 0; i < this->K / 2; i++)
+			{
+				R a = tools::div2(Y_N_f[4*i  ]);
+				R b = tools::div2(Y_N_f[4*i+1]);
+				sys[(4*i + 0) * n_frames + f] =  a + b;
+				sys[(4*i + 1) * n_frames + f] =  a - b;
+				sys[(4*i + 2) * n_frames + f] = -a + b;
+				sys[(4*i + 3) * n_frames + f] = -a - b;
+
+				par[(2*i  ) * n_frames + f] = Y_N_f[4*i + 2];
+				par[(2*i+2) * n_frames + f] = Y_N_f[4*i + 3];
+			}
 		}
 	}
 }
@@ -101,13 +111,14 @@ void Decoder_RSC_DB_BCJR<B,R>
 //	auto d_decod = std::chrono::steady_clock::now() - t_decod;
 
 //	auto t_store = std::chrono::steady_clock::now(); // --------------------------------------------------------- STORE
+	const auto n = this->get_simd_inter_frame_level();
 	for (auto i = 0; i < this->K; i+=2)
-	{
-		s[i  ] = (  std::max(ext[2*i+2] + sys[2*i+2], ext[2*i+3] + sys[2*i+3])
-		          - std::max(ext[2*i+0] + sys[2*i+0], ext[2*i+1] + sys[2*i+1])  ) > 0;
-		s[i+1] = (  std::max(ext[2*i+1] + sys[2*i+1], ext[2*i+3] + sys[2*i+3])
-		          - std::max(ext[2*i+0] + sys[2*i+0], ext[2*i+2] + sys[2*i+2])  ) > 0;
-	}
+		for (auto f = 0; f < n; f++)
+		{
+			const auto post = [&](const int l) { return ext[(2*i+l)*n +f] + sys[(2*i+l)*n +f]; };
+			s[(i  )*n +f] = (std::max(post(2), post(3)) - std::max(post(0), post(1))) > 0;
+			s[(i+1)*n +f] = (std::max(post(1), post(3)) - std::max(post(0), post(2))) > 0;
+		}
 	_store(V_K);
 //	auto d_store = std::chrono::steady_clock::now() - t_store;
 
@@ -120,7 +131,19 @@ template <typename B, typename R>
 void Decoder_RSC_DB_BCJR<B,R>
 ::_store(B *V_K) const
 {
-	std::copy(s.begin(), s.begin() + this->K, V_K);
+	if (this->get_simd_inter_frame_level() == 1)
+	{
+		std::copy(s.begin(), s.begin() + this->K, V_K);
+	}
+	else // inter frame => output reordering
+	{
+		const auto n_frames = this->get_simd_inter_frame_level();
+
+		std::vector<B*> frames(n_frames);
+		for (auto f = 0; f < n_frames; f++)
+			frames[f] = V_K + f*this->K;
+		tools::Reorderer<B>::apply_rev(s.data(), frames, this->K);
+	}
 }
 
 
@@ -160,11 +183,8 @@ template <typename B, typename R>
 void Decoder_RSC_DB_BCJR<B,R>
 ::notify_new_frame()
 {
-	for (auto s = 0; s < n_states; s++)
-	{
-		alpha_mp[s] = (R)0;
-		beta_mp [s] = (R)0;
-	}
+	std::fill(alpha_mp.begin(), alpha_mp.end(), (R)0);
+	std::fill(beta_mp .begin(), beta_mp .end(), (R)0);
 }
 
 // ==================================================================================== explicit template instantiation
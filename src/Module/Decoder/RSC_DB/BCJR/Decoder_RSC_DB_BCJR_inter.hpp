@@ -0,0 +1,50 @@
+#ifndef DECODER_RSC_DB_BCJR_INTER_HPP_
+#define DECODER_RSC_DB_BCJR_INTER_HPP_
+
+#include <vector>
+#include <mipp.h>
+
+#include "Tools/Math/max.h"
+
+#include "Decoder_RSC_DB_BCJR.hpp"
+
+namespace aff3ct
+{
+namespace module
+{
+// inter-frame SIMD double-binary BCJR for any trellis: 'mipp::nElReg<R>()' frames are decoded at once, one frame per
+// SIMD lane (the LLRs are interleaved frame by frame)
+template <typename B = int, typename R = float, tools::proto_max_i<R> MAX = tools::max_i>
+class Decoder_RSC_DB_BCJR_inter : public Decoder_RSC_DB_BCJR<B,R>
+{
+protected:
+	mipp::vector<R> alpha_inter; // node metrics (left to right), [couple][state][frame]
+	mipp::vector<R> beta_prev;   // node metrics (right to left) of the next couple
+	mipp::vector<R> beta_cur;    // node metrics (right to left) of the current couple
+
+	// the 16 edge metrics of a couple are the combinations of the 4 symbols and of the signs of the 2 parity bits, the
+	// edge code of a transition is: symbol * 4 + (negative 'y') * 2 + (negative 'w')
+	std::vector<int> edge_code;
+
+public:
+	Decoder_RSC_DB_BCJR_inter(const int K,
+	                          const std::vector<std::vector<int>> &trellis,
+	                          const bool buffered_encoding = true,
+	                          const int n_frames = 1);
+	virtual ~Decoder_RSC_DB_BCJR_inter();
+
+protected:
+	void _decode_siso   (const R *sys, const R *par, R *ext, const int frame_id);
+	void __fwd_recursion(const R *sys, const R *par                            );
+	void __bwd_recursion(const R *sys, const R *par, R* ext                    );
+
+private:
+	inline void compute_gamma(const R *sys, const R *par, const int k, mipp::Reg<R> r_g[16]) const;
+	inline void normalize    (R *metrics                                                    ) const;
+};
+}
+}
+
+#include "Decoder_RSC_DB_BCJR_inter.hxx"
+
+#endif /* DECODER_RSC_DB_BCJR_INTER_HPP_ */
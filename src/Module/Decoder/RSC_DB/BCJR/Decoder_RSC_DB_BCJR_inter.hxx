@@ -0,0 +1,162 @@
+#include <algorithm>
+#include <mipp.h>
+
+#include "Decoder_RSC_DB_BCJR_inter.hpp"
+
+namespace aff3ct
+{
+namespace module
+{
+template <typename B, typename R, tools::proto_max_i<R> MAX>
+Decoder_RSC_DB_BCJR_inter<B,R,MAX>
+::Decoder_RSC_DB_BCJR_inter(const int K,
+                            const std::vector<std::vector<int>> &trellis,
+                            const bool buffered_encoding,
+                            const int n_frames)
+: Decoder(K, 2 * K, n_frames, mipp::N<R>()),
+  Decoder_RSC_DB_BCJR<B,R>(K, trellis, buffered_encoding, n_frames, mipp::N<R>()),
+  alpha_inter((K/2 + 1) * trellis[0].size() / 4 * mipp::N<R>()),
+  beta_prev  (            trellis[0].size() / 4 * mipp::N<R>()),
+  beta_cur   (            trellis[0].size() / 4 * mipp::N<R>()),
+  edge_code  (            trellis[0].size()                   )
+{
+	const std::string name = "Decoder_RSC_DB_BCJR_inter";
+	this->set_name(name);
+
+	for (auto s = 0; s < this->n_states; s++)
+		for (auto u = 0; u < 4; u++)
+			edge_code[s*4 + u] = u * 4 + (trellis[2][s*4 + u] < 0 ? 2 : 0) + (trellis[3][s*4 + u] < 0 ? 1 : 0);
+}
+
+template <typename B, typename R, tools::proto_max_i<R> MAX>
+Decoder_RSC_DB_BCJR_inter<B,R,MAX>
+::~Decoder_RSC_DB_BCJR_inter()
+{
+}
+
+template <typename B, typename R, tools::proto_max_i<R> MAX>
+void Decoder_RSC_DB_BCJR_inter<B,R,MAX>
+::compute_gamma(const R *sys, const R *par, const int k, mipp::Reg<R> r_g[16]) const
+{
+	constexpr int n_lanes = mipp::N<R>();
+
+	const auto r_y = mipp::Reg<R>(&par[(2*k +0) * n_lanes]);
+	const auto r_w = mipp::Reg<R>(&par[(2*k +1) * n_lanes]);
+
+	for (auto u = 0; u < 4; u++)
+	{
+		const auto r_sys = mipp::Reg<R>(&sys[(4*k + u) * n_lanes]);
+		r_g[u*4 +0] = r_sys + r_y + r_w;
+		r_g[u*4 +1] = r_sys + r_y - r_w;
+		r_g[u*4 +2] = r_sys - r_y + r_w;
+		r_g[u*4 +3] = r_sys - r_y - r_w;
+	}
+}
+
+template <typename B, typename R, tools::proto_max_i<R> MAX>
+void Decoder_RSC_DB_BCJR_inter<B,R,MAX>
+::normalize(R *metrics) const
+{
+	constexpr int n_lanes = mipp::N<R>();
+
+	const auto r_norm_val = mipp::Reg<R>(&metrics[0]);
+	for (auto s = 0; s < this->n_states; s++)
+	{
+		auto r_m = mipp::Reg<R>(&metrics[s * n_lanes]);
+		r_m -= r_norm_val;
+		r_m.store(&metrics[s * n_lanes]);
+	}
+}
+
+template <typename B, typename R, tools::proto_max_i<R> MAX>
+void Decoder_RSC_DB_BCJR_inter<B,R,MAX>
+::__fwd_recursion(const R *sys, const R *par)
+{
+	constexpr int n_lanes = mipp::N<R>();
+	const auto n_states = this->n_states;
+	const auto &prev    = this->trellis[1];
+
+	mipp::Reg<R> r_g[16];
+	for (auto k = 0; k < this->K/2; k++)
+	{
+		const auto a_prev = this->alpha_inter.data() + (k +0) * n_states * n_lanes;
+		const auto a_cur  = this->alpha_inter.data() + (k +1) * n_states * n_lanes;
+
+		this->compute_gamma(sys, par, k, r_g);
+
+		// compute the alpha values [trellis forward traversal ->]
+		for (auto s = 0; s < n_states; s++)
+		{
+			mipp::Reg<R> r_a[4];
+			for (auto u = 0; u < 4; u++)
+			{
+				const auto s_prev = prev[s*4 + u];
+				r_a[u] = mipp::Reg<R>(&a_prev[s_prev * n_lanes]) + r_g[edge_code[s_prev*4 + u]];
+			}
+
+			MAX(MAX(r_a[0], r_a[1]), MAX(r_a[2], r_a[3])).store(&a_cur[s * n_lanes]);
+		}
+
+		this->normalize(a_cur);
+	}
+}
+
+template <typename B, typename R, tools::proto_max_i<R> MAX>
+void Decoder_RSC_DB_BCJR_inter<B,R,MAX>
+::__bwd_recursion(const R *sys, const R *par, R* ext)
+{
+	constexpr int n_lanes = mipp::N<R>();
+	const auto n_states = this->n_states;
+	const auto &next    = this->trellis[0];
+
+	// compute the beta values [trellis backward traversal <-] + compute the extrinsic values, the sums of the beta and
+	// gamma values are shared by the two computations
+	mipp::Reg<R> r_g[16];
+	for (auto k = this->K/2 -1; k >= 0; k--)
+	{
+		const auto a_cur = this->alpha_inter.data() + k * n_states * n_lanes;
+
+		this->compute_gamma(sys, par, k, r_g);
+
+		mipp::Reg<R> r_post[4];
+		for (auto s = 0; s < n_states; s++)
+		{
+			const auto r_a = mipp::Reg<R>(&a_cur[s * n_lanes]);
+
+			mipp::Reg<R> r_b[4];
+			for (auto u = 0; u < 4; u++)
+			{
+				r_b[u] = mipp::Reg<R>(&beta_prev[next[s*4 + u] * n_lanes]) + r_g[edge_code[s*4 + u]];
+				r_post[u] = (s == 0) ? r_a + r_b[u] : MAX(r_post[u], r_a + r_b[u]);
+			}
+
+			MAX(MAX(r_b[0], r_b[1]), MAX(r_b[2], r_b[3])).store(&beta_cur[s * n_lanes]);
+		}
+
+		for (auto u = 0; u < 4; u++)
+			(r_post[u] - mipp::Reg<R>(&sys[(4*k + u) * n_lanes])).store(&ext[(4*k + u) * n_lanes]);
+
+		this->normalize(beta_cur.data());
+		std::swap(beta_prev, beta_cur);
+	}
+}
+
+template <typename B, typename R, tools::proto_max_i<R> MAX>
+void Decoder_RSC_DB_BCJR_inter<B,R,MAX>
+::_decode_siso(const R *sys, const R *par, R *ext, const int frame_id)
+{
+	const auto n_metrics = this->n_states * mipp::N<R>();
+
+	// init the metrics at the borders with the values of the previous call (circular trellis)
+	std::copy(this->alpha_mp.begin(), this->alpha_mp.end(), alpha_inter.begin());
+	std::copy(this->beta_mp .begin(), this->beta_mp .end(), beta_prev  .begin());
+
+	this->__fwd_recursion(sys, par     );
+	this->__bwd_recursion(sys, par, ext);
+
+	// save the metrics at the borders for the next call
+	std::copy(alpha_inter.end() - n_metrics, alpha_inter.end(), this->alpha_mp.begin());
+	std::copy(beta_prev  .begin(), beta_prev.end(), this->beta_mp.begin());
+}
+}
+}
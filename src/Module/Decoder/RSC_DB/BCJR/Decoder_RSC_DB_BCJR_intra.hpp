@@ -0,0 +1,59 @@
+#ifndef DECODER_RSC_DB_BCJR_INTRA_HPP_
+#define DECODER_RSC_DB_BCJR_INTRA_HPP_
+
+#include <vector>
+#include <mipp.h>
+
+#include "Tools/Math/max.h"
+
+#include "Decoder_RSC_DB_BCJR.hpp"
+
+namespace aff3ct
+{
+namespace module
+{
+// intra-frame SIMD double-binary BCJR for any trellis: the metrics of 'mipp::nElReg<R>()' consecutive states are
+// computed in one SIMD register (the number of states has to be a multiple of 'mipp::nElReg<R>()', the 8 states of the
+// DVB-RCS trellis fit in one AVX register)
+template <typename B = int, typename R = float, tools::proto_max_i<R> MAX = tools::max_i>
+class Decoder_RSC_DB_BCJR_intra : public Decoder_RSC_DB_BCJR<B,R>
+{
+protected:
+	const int n_chunks; // number of SIMD registers to store the metrics of one couple
+
+	mipp::vector<R> alpha_intra; // node metrics (left to right), the 'n_states' metrics of a couple are contiguous
+	mipp::vector<R> gamma_intra; // edge metrics in the order of the starting states, [couple][symbol][state]
+	mipp::vector<R> beta_prev;   // node metrics (right to left) of the next couple
+	mipp::vector<R> beta_cur;    // node metrics (right to left) of the current couple
+	mipp::vector<R> metrics;     // alpha + gamma of the 4 symbols in the order of the starting states
+
+	// the transitions of the trellis are built at the construction from the shuffles of the chunks of states: 8 types of
+	// transitions (previous state of the 4 symbols for alpha, next state of the 4 symbols for beta)
+	std::vector<int>                      trans_off;   // first shuffle of each (type, chunk), 8*n_chunks +1
+	std::vector<int>                      trans_src;   // chunk of states to shuffle
+	mipp::vector<mipp::Reg<R>>            trans_cmask; // permutation of the states in the chunk
+	mipp::vector<mipp::Msk<mipp::N<R>()>> trans_msk;   // states of the output chunk given by the shuffle
+	mipp::vector<mipp::Reg<R>>            par_sign;    // sign of the 2 parity LLRs for each (symbol, chunk)
+
+public:
+	Decoder_RSC_DB_BCJR_intra(const int K,
+	                          const std::vector<std::vector<int>> &trellis,
+	                          const bool buffered_encoding = true,
+	                          const int n_frames = 1);
+	virtual ~Decoder_RSC_DB_BCJR_intra();
+
+protected:
+	void _decode_siso   (const R *sys, const R *par, R *ext, const int frame_id);
+	void __fwd_recursion(const R *sys, const R *par                            );
+	void __bwd_recursion(const R *sys, const R *par, R* ext                    );
+
+private:
+	inline mipp::Reg<R> gather_states(const R *metrics, const int type, const int c) const;
+	inline void         normalize    (R *metrics                                   ) const;
+};
+}
+}
+
+#include "Decoder_RSC_DB_BCJR_intra.hxx"
+
+#endif /* DECODER_RSC_DB_BCJR_INTRA_HPP_ */
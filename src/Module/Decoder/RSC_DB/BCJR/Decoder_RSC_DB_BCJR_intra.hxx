@@ -0,0 +1,235 @@
+#include <sstream>
+#include <algorithm>
+#include <mipp.h>
+
+#include "Tools/Exception/exception.hpp"
+
+#include "Decoder_RSC_DB_BCJR_intra.hpp"
+
+namespace aff3ct
+{
+namespace module
+{
+template <typename B, typename R, tools::proto_max_i<R> MAX>
+Decoder_RSC_DB_BCJR_intra<B,R,MAX>
+::Decoder_RSC_DB_BCJR_intra(const int K,
+                            const std::vector<std::vector<int>> &trellis,
+                            const bool buffered_encoding,
+                            const int n_frames)
+: Decoder(K, 2 * K, n_frames, 1),
+  Decoder_RSC_DB_BCJR<B,R>(K, trellis, buffered_encoding, n_frames),
+  n_chunks   ((int)trellis[0].size() / 4 / mipp::N<R>()),
+  alpha_intra((K/2 + 1) *     trellis[0].size() / 4),
+  gamma_intra((K/2    ) * 4 * trellis[0].size() / 4),
+  beta_prev  (                trellis[0].size() / 4),
+  beta_cur   (                trellis[0].size() / 4),
+  metrics    (            4 * trellis[0].size() / 4)
+{
+	const std::string name = "Decoder_RSC_DB_BCJR_intra";
+	this->set_name(name);
+
+	constexpr int n_lanes = mipp::N<R>();
+
+	if (this->n_states < n_lanes || this->n_states % n_lanes)
+	{
+		std::stringstream message;
+		message << "'n_states' has to be a multiple of 'mipp::nElReg<R>()' ('n_states' = " << this->n_states
+		        << ", 'mipp::nElReg<R>()' = " << n_lanes << ").";
+		throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	// the 4 first types of transitions give the previous states (alpha), the 4 last ones give the next states (beta)
+	std::vector<int> states(this->n_states);
+	std::vector<uint32_t> cmask(n_lanes);
+	mipp::vector<R> lanes(n_lanes), y_lanes(n_lanes), w_lanes(n_lanes);
+	const auto r_one = mipp::Reg<R>((R)1);
+	for (auto t = 0; t < 8; t++)
+	{
+		const auto &trans = (t < 4) ? trellis[1] : trellis[0];
+		for (auto s = 0; s < this->n_states; s++)
+			states[s] = trans[s*4 + (t % 4)];
+
+		for (auto c = 0; c < n_chunks; c++)
+		{
+			trans_off.push_back((int)trans_src.size());
+
+			// one shuffle per chunk of states which contains at least one of the required states
+			std::vector<int> srcs;
+			for (auto l = 0; l < n_lanes; l++)
+				if (std::find(srcs.begin(), srcs.end(), states[c * n_lanes +l] / n_lanes) == srcs.end())
+					srcs.push_back(states[c * n_lanes +l] / n_lanes);
+
+			for (auto src : srcs)
+			{
+				for (auto l = 0; l < n_lanes; l++)
+				{
+					const auto s = states[c * n_lanes +l];
+					cmask[l] = (s / n_lanes == src) ? (uint32_t)(s % n_lanes) : 0;
+					lanes[l] = (s / n_lanes == src) ? (R)1                    : (R)0;
+				}
+
+				trans_src  .push_back(src);
+				trans_cmask.push_back(mipp::Reg<R>::cmask(cmask.data()));
+				trans_msk  .push_back(mipp::Reg<R>(lanes.data()) == r_one);
+			}
+		}
+	}
+	trans_off.push_back((int)trans_src.size());
+
+	// the parity bits of the edges in the order of the starting states
+	for (auto u = 0; u < 4; u++)
+		for (auto c = 0; c < n_chunks; c++)
+		{
+			for (auto l = 0; l < n_lanes; l++)
+			{
+				y_lanes[l] = (R)trellis[2][(c * n_lanes +l)*4 + u];
+				w_lanes[l] = (R)trellis[3][(c * n_lanes +l)*4 + u];
+			}
+
+			par_sign.push_back(mipp::Reg<R>(y_lanes.data()));
+			par_sign.push_back(mipp::Reg<R>(w_lanes.data()));
+		}
+}
+
+template <typename B, typename R, tools::proto_max_i<R> MAX>
+Decoder_RSC_DB_BCJR_intra<B,R,MAX>
+::~Decoder_RSC_DB_BCJR_intra()
+{
+}
+
+template <typename B, typename R, tools::proto_max_i<R> MAX>
+mipp::Reg<R> Decoder_RSC_DB_BCJR_intra<B,R,MAX>
+::gather_states(const R *metrics, const int type, const int c) const
+{
+	constexpr int n_lanes = mipp::N<R>();
+
+	auto s     = trans_off[type * n_chunks + c   ];
+	auto s_end = trans_off[type * n_chunks + c +1];
+
+	auto r_m = mipp::Reg<R>(&metrics[trans_src[s] * n_lanes]).shuff(trans_cmask[s]);
+	for (s++; s < s_end; s++)
+	{
+		const auto r_src = mipp::Reg<R>(&metrics[trans_src[s] * n_lanes]).shuff(trans_cmask[s]);
+		r_m = mipp::blend(r_src, r_m, trans_msk[s]);
+	}
+
+	return r_m;
+}
+
+template <typename B, typename R, tools::proto_max_i<R> MAX>
+void Decoder_RSC_DB_BCJR_intra<B,R,MAX>
+::normalize(R *metrics) const
+{
+	constexpr int n_lanes = mipp::N<R>();
+
+	const auto r_norm_val = mipp::Reg<R>(metrics[0]);
+	for (auto c = 0; c < n_chunks; c++)
+	{
+		auto r_m = mipp::Reg<R>(&metrics[c * n_lanes]);
+		r_m -= r_norm_val;
+		r_m.store(&metrics[c * n_lanes]);
+	}
+}
+
+template <typename B, typename R, tools::proto_max_i<R> MAX>
+void Decoder_RSC_DB_BCJR_intra<B,R,MAX>
+::__fwd_recursion(const R *sys, const R *par)
+{
+	constexpr int n_lanes = mipp::N<R>();
+	const auto n_states = this->n_states;
+
+	for (auto k = 0; k < this->K/2; k++)
+	{
+		const auto a_prev = this->alpha_intra.data() + (k +0) * n_states;
+		const auto a_cur  = this->alpha_intra.data() + (k +1) * n_states;
+		const auto g_cur  = this->gamma_intra.data() + (k +0) * n_states * 4;
+
+		const auto r_y = mipp::Reg<R>(par[2*k  ]);
+		const auto r_w = mipp::Reg<R>(par[2*k+1]);
+
+		// compute the gamma values and add them to the alpha values of the starting states
+		for (auto u = 0; u < 4; u++)
+		{
+			const auto r_sys = mipp::Reg<R>(sys[4*k + u]);
+			for (auto c = 0; c < n_chunks; c++)
+			{
+				const auto idx = u * n_chunks + c;
+				const auto r_g = r_sys + mipp::neg(r_y, par_sign[2*idx +0]) + mipp::neg(r_w, par_sign[2*idx +1]);
+				r_g.store(&g_cur[idx * n_lanes]);
+
+				(mipp::Reg<R>(&a_prev[c * n_lanes]) + r_g).store(&metrics[idx * n_lanes]);
+			}
+		}
+
+		// compute the alpha values [trellis forward traversal ->]
+		for (auto c = 0; c < n_chunks; c++)
+		{
+			const auto r_m0 = this->gather_states(metrics.data() + 0 * n_states, 0, c);
+			const auto r_m1 = this->gather_states(metrics.data() + 1 * n_states, 1, c);
+			const auto r_m2 = this->gather_states(metrics.data() + 2 * n_states, 2, c);
+			const auto r_m3 = this->gather_states(metrics.data() + 3 * n_states, 3, c);
+
+			MAX(MAX(r_m0, r_m1), MAX(r_m2, r_m3)).store(&a_cur[c * n_lanes]);
+		}
+
+		this->normalize(a_cur);
+	}
+}
+
+template <typename B, typename R, tools::proto_max_i<R> MAX>
+void Decoder_RSC_DB_BCJR_intra<B,R,MAX>
+::__bwd_recursion(const R *sys, const R *par, R* ext)
+{
+	constexpr int n_lanes = mipp::N<R>();
+	const auto n_states = this->n_states;
+
+	// compute the beta values [trellis backward traversal <-] + compute the extrinsic values, the sums of the beta and
+	// gamma values are shared by the two computations
+	for (auto k = this->K/2 -1; k >= 0; k--)
+	{
+		const auto a_cur = this->alpha_intra.data() + k * n_states;
+		const auto g_cur = this->gamma_intra.data() + k * n_states * 4;
+
+		mipp::Reg<R> r_post[4];
+		for (auto c = 0; c < n_chunks; c++)
+		{
+			const auto r_a = mipp::Reg<R>(&a_cur[c * n_lanes]);
+
+			mipp::Reg<R> r_b[4];
+			for (auto u = 0; u < 4; u++)
+			{
+				r_b[u] = this->gather_states(beta_prev.data(), 4 + u, c) +
+				         mipp::Reg<R>(&g_cur[(u * n_chunks + c) * n_lanes]);
+				r_post[u] = (c == 0) ? r_a + r_b[u] : MAX(r_post[u], r_a + r_b[u]);
+			}
+
+			MAX(MAX(r_b[0], r_b[1]), MAX(r_b[2], r_b[3])).store(&beta_cur[c * n_lanes]);
+		}
+
+		for (auto u = 0; u < 4; u++)
+			ext[4*k + u] = mipp::Reduction<R,MAX>::apply(r_post[u])[0] - sys[4*k + u];
+
+		this->normalize(beta_cur.data());
+		std::swap(beta_prev, beta_cur);
+	}
+}
+
+template <typename B, typename R, tools::proto_max_i<R> MAX>
+void Decoder_RSC_DB_BCJR_intra<B,R,MAX>
+::_decode_siso(const R *sys, const R *par, R *ext, const int frame_id)
+{
+	const auto n_states = this->n_states;
+
+	// init the metrics at the borders with the values of the previous call (circular trellis)
+	std::copy(this->alpha_mp.begin(), this->alpha_mp.end(), alpha_intra.begin());
+	std::copy(this->beta_mp .begin(), this->beta_mp .end(), beta_prev  .begin());
+
+	this->__fwd_recursion(sys, par     );
+	this->__bwd_recursion(sys, par, ext);
+
+	// save the metrics at the borders for the next call
+	std::copy(alpha_intra.end() - n_states, alpha_intra.end(), this->alpha_mp.begin());
+	std::copy(beta_prev  .begin(), beta_prev.end(), this->beta_mp.begin());
+}
+}
+}
@@ -39,6 +39,10 @@ void Decoder_turbo_std<B,R>
 {
 //	auto t_load = std::chrono::steady_clock::now(); // ----------------------------------------------------------- LOAD
 	this->_load(Y_N, frame_id);
+
+	// a new frame: the SISO decoders can not reuse the metrics of the previous frame
+	this->siso_n.reset();
+	this->siso_i.reset();
 //	auto d_load = std::chrono::steady_clock::now() - t_load;
 
 //	auto t_decod = std::chrono::steady_clock::now(); // -------------------------------------------------------- DECODE
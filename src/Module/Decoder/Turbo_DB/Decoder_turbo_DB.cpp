@@ -6,6 +6,7 @@
 
 #include "Decoder_turbo_DB.hpp"
 #include "Tools/Math/utils.h"
+#include "Tools/Perf/Reorderer/Reorderer.hpp"
 
 using namespace aff3ct;
 using namespace aff3ct::module;
@@ -18,24 +19,25 @@ Decoder_turbo_DB<B,R>
                    const Interleaver<R> &pi,
                    Decoder_RSC_DB_BCJR<B,R> &siso_n,
                    Decoder_RSC_DB_BCJR<B,R> &siso_i)
-: Decoder          (K, N, siso_n.get_n_frames(), 1),
-  Decoder_SIHO<B,R>(K, N, siso_n.get_n_frames(), 1),
+: Decoder          (K, N, siso_n.get_n_frames(), siso_n.get_simd_inter_frame_level()),
+  Decoder_SIHO<B,R>(K, N, siso_n.get_n_frames(), siso_n.get_simd_inter_frame_level()),
   n_ite            (n_ite),
   pi               (pi),
   siso_n           (siso_n),
   siso_i           (siso_i),
-  l_cpy            (2 * K),
-  l_sn             (2 * K),
-  l_si             (2 * K),
-  l_sen            (2 * K),
-  l_sei            (2 * K),
-  l_pn             (    K),
-  l_pi             (    K),
-  l_e1n            (2 * K),
-  l_e2n            (2 * K),
-  l_e1i            (2 * K),
-  l_e2i            (2 * K),
-  s                (    K)
+  lut_itl          (2 * K),
+  lut_dtl          (2 * K),
+  l_sn             (2 * K * siso_n.get_simd_inter_frame_level()),
+  l_si             (2 * K * siso_n.get_simd_inter_frame_level()),
+  l_sen            (2 * K * siso_n.get_simd_inter_frame_level()),
+  l_sei            (2 * K * siso_n.get_simd_inter_frame_level()),
+  l_pn             (    K * siso_n.get_simd_inter_frame_level()),
+  l_pi             (    K * siso_n.get_simd_inter_frame_level()),
+  l_e1n            (2 * K * siso_n.get_simd_inter_frame_level()),
+  l_e2n            (2 * K * siso_n.get_simd_inter_frame_level()),
+  l_e1i            (2 * K * siso_n.get_simd_inter_frame_level()),
+  l_e2i            (2 * K * siso_n.get_simd_inter_frame_level()),
+  s                (    K * siso_n.get_simd_inter_frame_level())
 {
 	const std::string name = "Decoder_turbo_DB";
 	this->set_name(name);
@@ -86,14 +88,6 @@ Decoder_turbo_DB<B,R>
 		throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
 	}
 
-	if (siso_n.get_simd_inter_frame_level() != 1)
-	{
-		std::stringstream message;
-		message << "'siso_n.get_simd_inter_frame_level()' has to be equal to 1 "
-		        << "('siso_n.get_simd_inter_frame_level()' = " << siso_n.get_simd_inter_frame_level() << ").";
-		throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
-	}
-
 	if (siso_n.get_simd_inter_frame_level() != siso_i.get_simd_inter_frame_level())
 	{
 		std::stringstream message;
@@ -141,39 +135,52 @@ void Decoder_turbo_DB<B,R>
 	this->siso_n.notify_new_frame();
 	this->siso_i.notify_new_frame();
 
-	auto j = 0;
-	for (auto i = 0; i < this->K/2; i++)
+	// with the inter-frame SIMD the LLRs of the frames are interleaved: the LLR 'i' of the frame 'f' is at the
+	// position 'i * n_frames + f'
+	const auto n_frames = this->get_simd_inter_frame_level();
+	for (auto f = 0; f < n_frames; f++)
 	{
-		R a = tools::div2(Y_N[j++]);
-		R b = tools::div2(Y_N[j++]);
-		this->l_sn[4*i + 0] =  a + b;
-		this->l_sn[4*i + 1] =  a - b;
-		this->l_sn[4*i + 2] = -a + b;
-		this->l_sn[4*i + 3] = -a - b;
-	}
+		const auto Y_N_f = Y_N + f * this->N;
 
-	for (auto i = 0; i < this->K; i+=2)
-	{
-		this->l_pn[i] = tools::div2(Y_N[j++]);
-		this->l_pi[i] = tools::div2(Y_N[j++]);
-	}
+		auto j = 0;
+		for (auto i = 0; i < this->K/2; i++)
+		{
+			R a = tools::div2(Y_N_f[j++]);
+			R b = tools::div2(Y_N_f[j++]);
+			this->l_sn[(4*i + 0) * n_frames + f] =  a + b;
+			this->l_sn[(4*i + 1) * n_frames + f] =  a - b;
+			this->l_sn[(4*i + 2) * n_frames + f] = -a + b;
+			this->l_sn[(4*i + 3) * n_frames + f] = -a - b;
+		}
 
-	for (auto i = 1; i < this->K; i+=2)
-	{
-		this->l_pn[i] = tools::div2(Y_N[j++]);
-		this->l_pi[i] = tools::div2(Y_N[j++]);
+		for (auto i = 0; i < this->K; i+=2)
+		{
+			this->l_pn[i * n_frames + f] = tools::div2(Y_N_f[j++]);
+			this->l_pi[i * n_frames + f] = tools::div2(Y_N_f[j++]);
+		}
+
+		for (auto i = 1; i < this->K; i+=2)
+		{
+			this->l_pn[i * n_frames + f] = tools::div2(Y_N_f[j++]);
+			this->l_pi[i * n_frames + f] = tools::div2(Y_N_f[j++]);
+		}
 	}
 
+	// build the interleaving and deinterleaving LUTs of the LLRs: the swaps of the couples (the LLRs 1 and 2 of one couple
+	// out of two) and the interleaving of the couples are merged in one permutation (shared by the frames of the SIMD
+	// lanes)
+	const auto &lut     = pi.get_core().get_lut();
+	const auto &lut_inv = pi.get_core().get_lut_inv();
+	auto swap = [](const int i) { return (i % 8 == 1) ? i +1 : (i % 8 == 2) ? i -1 : i; };
+	for (auto i = 0; i < this->K / 2; i++)
+		for (auto l = 0; l < 4; l++)
+		{
+			this->lut_itl[4 * i + l] = swap(4 * lut_inv[i] + l);
+			this->lut_dtl[swap(4 * i + l)] = 4 * lut[i] + l;
+		}
+
 	// make the interleaving to get l_si (2 steps interleaving)
-	l_cpy = this->l_sn;
-	for (auto i = 0; i < 2 * this->K; i += 8)
-		std::swap(l_cpy[i+1], l_cpy[i+2]);
-	for (auto i = 0; i < this->K; i += 2)
-	{
-		const auto l = pi.get_core().get_lut_inv()[i >> 1];
-		for (auto bps = 0; bps < 2; bps++) this->l_si[2 * (i +0) + bps] = l_cpy[(4 * l + 0) + bps];
-		for (auto bps = 0; bps < 2; bps++) this->l_si[2 * (i +1) + bps] = l_cpy[(4 * l + 2) + bps];
-	}
+	this->permute(this->l_sn, this->l_si, this->lut_itl);
 
 	std::fill(this->l_e1n.begin(), this->l_e1n.end(), (R)0);
 }
@@ -195,8 +202,7 @@ void Decoder_turbo_DB<B,R>
 	do
 	{
 		// sys + ext
-		for (auto i = 0; i < 2 * this->K; i++)
-			this->l_sen[i] = this->l_sn[i] + this->l_e1n[i];
+		this->add(this->l_sn, this->l_e1n, this->l_sen);
 
 		// SISO in the natural domain
 		this->siso_n.decode_siso(this->l_sen.data(), this->l_pn.data(), this->l_e2n.data(), n_frames);
@@ -210,19 +216,10 @@ void Decoder_turbo_DB<B,R>
 		if (!stop)
 		{
 			// make the interleaving
-			l_cpy = this->l_e2n;
-			for (auto i = 0; i < 2 * this->K; i += 8)
-				std::swap(l_cpy[i+1], l_cpy[i+2]);
-			for (auto i = 0; i < this->K; i += 2)
-			{
-				const auto l = pi.get_core().get_lut_inv()[i >> 1];
-				for (auto bps = 0; bps < 2; bps++) this->l_e1i[2 * (i +0) + bps] = l_cpy[(4 * l + 0) + bps];
-				for (auto bps = 0; bps < 2; bps++) this->l_e1i[2 * (i +1) + bps] = l_cpy[(4 * l + 2) + bps];
-			}
+			this->permute(this->l_e2n, this->l_e1i, this->lut_itl);
 
 			// sys + ext
-			for (auto i = 0; i < 2 * this->K; i++)
-				this->l_sei[i] = this->l_si[i] + this->l_e1i[i];
+			this->add(this->l_si, this->l_e1i, this->l_sei);
 
 			// SISO in the interleaved domain
 			this->siso_i.decode_siso(this->l_sei.data(), this->l_pi.data(), this->l_e2i.data(), n_frames);
@@ -235,29 +232,21 @@ void Decoder_turbo_DB<B,R>
 
 			if (ite == this->n_ite || stop)
 				// add the systematic information to the extrinsic information, gives the a posteriori information
-				for (auto i = 0; i < 2 * this->K; i++)
-					this->l_e2i[i] += this->l_sei[i];
+				this->add(this->l_e2i, this->l_sei, this->l_e2i);
 
 			// make the deinterleaving
-			for (auto i = 0; i < this->K; i += 2)
-			{
-				const auto l = pi.get_core().get_lut()[i >> 1];
-				for (auto bps = 0; bps < 2; bps++) this->l_e1n[2 * (i +0) + bps] = l_e2i[(4 * l + 0) + bps];
-				for (auto bps = 0; bps < 2; bps++) this->l_e1n[2 * (i +1) + bps] = l_e2i[(4 * l + 2) + bps];
-			}
-			for (auto i = 0; i < 2 * this->K; i += 8)
-				std::swap(this->l_e1n[i+1], this->l_e1n[i+2]);
+			this->permute(this->l_e2i, this->l_e1n, this->lut_dtl);
 
 			// compute the hard decision only if we are in the last iteration
 			if (ite == this->n_ite || stop)
 			{
 				for (auto i = 0; i < this->K; i += 2)
-				{
-					this->s[i  ] = (std::max(this->l_e1n[2*i+2], this->l_e1n[2*i+3]) -
-					                std::max(this->l_e1n[2*i+0], this->l_e1n[2*i+1])) > 0;
-					this->s[i+1] = (std::max(this->l_e1n[2*i+1], this->l_e1n[2*i+3]) -
-					                std::max(this->l_e1n[2*i+0], this->l_e1n[2*i+2])) > 0;
-				}
+					for (auto f = 0; f < n_frames; f++)
+					{
+						const auto post = [&](const int l) { return this->l_e1n[(2*i+l) * n_frames + f]; };
+						this->s[(i  ) * n_frames + f] = (std::max(post(2), post(3)) - std::max(post(0), post(1))) > 0;
+						this->s[(i+1) * n_frames + f] = (std::max(post(1), post(3)) - std::max(post(0), post(2))) > 0;
+					}
 			}
 		}
 		ite++; // increment the number of iteration
@@ -281,7 +270,59 @@ template <typename B, typename R>
 void Decoder_turbo_DB<B,R>
 ::_store(B *V_K) const
 {
-	std::copy(s.data(), s.data() + this->K, V_K);
+	if (this->get_simd_inter_frame_level() == 1)
+	{
+		std::copy(s.data(), s.data() + this->K, V_K);
+	}
+	else // inter frame => output reordering
+	{
+		const auto n_frames = this->get_simd_inter_frame_level();
+
+		std::vector<B*> frames(n_frames);
+		for (auto f = 0; f < n_frames; f++)
+			frames[f] = V_K + f*this->K;
+		tools::Reorderer<B>::apply_rev(s.data(), frames, this->K);
+	}
+}
+
+template <typename B, typename R>
+void Decoder_turbo_DB<B,R>
+::add(const mipp::vector<R> &a, const mipp::vector<R> &b, mipp::vector<R> &c) const
+{
+	const auto size = (int)c.size();
+	const auto vec_loop_size = (size / mipp::nElReg<R>()) * mipp::nElReg<R>();
+	for (auto i = 0; i < vec_loop_size; i += mipp::nElReg<R>())
+	{
+		const auto r_c = mipp::Reg<R>(&a[i]) + mipp::Reg<R>(&b[i]);
+		r_c.store(&c[i]);
+	}
+	for (auto i = vec_loop_size; i < size; i++)
+		c[i] = a[i] + b[i];
+}
+
+template <typename B, typename R>
+void Decoder_turbo_DB<B,R>
+::permute(const mipp::vector<R> &in, mipp::vector<R> &out, const std::vector<int> &lut) const
+{
+	const auto size     = (int)lut.size();
+	const auto n_frames = this->get_simd_inter_frame_level();
+
+	if (n_frames == 1)
+	{
+		for (auto i = 0; i < size; i++)
+			out[i] = in[lut[i]];
+	}
+	else if (n_frames == mipp::nElReg<R>())
+	{
+		for (auto i = 0; i < size; i++)
+			mipp::Reg<R>(&in[lut[i] * n_frames]).store(&out[i * n_frames]);
+	}
+	else
+	{
+		for (auto i = 0; i < size; i++)
+			for (auto f = 0; f < n_frames; f++)
+				out[i * n_frames + f] = in[lut[i] * n_frames + f];
+	}
 }
 
 // ==================================================================================== explicit template instantiation
@@ -23,7 +23,9 @@ protected:
 	Decoder_RSC_DB_BCJR<B,R> &siso_n;
 	Decoder_RSC_DB_BCJR<B,R> &siso_i;
 
-	mipp::vector<R> l_cpy;
+	std::vector<int> lut_itl; // interleaving   of the LLRs (couple swaps included), built for each frame
+	std::vector<int> lut_dtl; // deinterleaving of the LLRs (couple swaps included), built for each frame
+
 	mipp::vector<R> l_sn;  // systematic LLRs                  in the natural     domain
 	mipp::vector<R> l_si;  // systematic LLRs                  in the interleaved domain
 	mipp::vector<R> l_sen; // systematic LLRs + extrinsic LLRs in the natural     domain
@@ -67,6 +69,10 @@ protected:
 	virtual void _decode_siho(const R *Y_N, B *V_K, const int frame_id);
 	virtual void _load       (const R *Y_N                            );
 	virtual void _store      (              B *V_K                    ) const;
+
+private:
+	inline void add    (const mipp::vector<R> &a,  const mipp::vector<R> &b, mipp::vector<R>        &c  ) const;
+	inline void permute(const mipp::vector<R> &in,       mipp::vector<R> &out, const std::vector<int> &lut) const;
 };
 }
 }
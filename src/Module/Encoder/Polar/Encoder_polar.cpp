@@ -1,6 +1,7 @@
 #include <vector>
 #include <cmath>
 #include <sstream>
+#include <algorithm>
 
 #include "Tools/Exception/exception.hpp"
 
@@ -8,10 +9,15 @@
 
 using namespace aff3ct::module;
 
+// in-word butterflies: the bit 'i' is xored with the bit 'i + k' when '(i & k) == 0' (k = 1, 2, 4, 8, 16, 32)
+static const uint64_t butterfly_masks[6] = {0x5555555555555555ULL, 0x3333333333333333ULL, 0x0F0F0F0F0F0F0F0FULL,
+                                            0x00FF00FF00FF00FFULL, 0x0000FFFF0000FFFFULL, 0x00000000FFFFFFFFULL};
+
 template <typename B>
 Encoder_polar<B>
 ::Encoder_polar(const int& K, const int& N, const std::vector<bool>& frozen_bits, const int n_frames)
-: Encoder<B>(K, N, n_frames), m((int)std::log2(N)), frozen_bits(frozen_bits), X_N_tmp(this->N)
+: Encoder<B>(K, N, n_frames), m((int)std::log2(N)), frozen_bits(frozen_bits), X_N_tmp(this->N),
+  X_N_packed(((size_t)N * n_frames + 63) / 64), info_mask((N + 63) / 64)
 {
 	const std::string name = "Encoder_polar";
 	this->set_name(name);
@@ -25,6 +31,13 @@ Encoder_polar<B>
 		throw tools::length_error(__FILE__, __LINE__, __func__, message.str());
 	}
 
+	if ((1 << m) != N)
+	{
+		std::stringstream message;
+		message << "'N' has to be a power of 2 ('N' = " << N << ").";
+		throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
 	auto k = 0; for (auto i = 0; i < this->N; i++) if (frozen_bits[i] == 0) k++;
 	if (this->K != k)
 	{
@@ -37,45 +50,120 @@ Encoder_polar<B>
 	this->notify_frozenbits_update();
 }
 
+template <typename B>
+void Encoder_polar<B>
+::encode(const B *U_K, B *X_N, const int frame_id)
+{
+	if (frame_id >= 0 || this->n_frames == 1 || this->is_memorizing())
+	{
+		Encoder<B>::encode(U_K, X_N, frame_id);
+		return;
+	}
+
+	// all the frames are encoded at once on the packed bits
+	this->pack_info_bits(U_K, this->n_frames);
+	this->_encode_packed(this->n_frames);
+	this->unpack(X_N, this->n_frames);
+}
+
 template <typename B>
 void Encoder_polar<B>
 ::_encode(const B *U_K, B *X_N, const int frame_id)
 {
-	this->convert(U_K, X_N);
-	this->light_encode(X_N);
+	this->pack_info_bits(U_K, 1);
+	this->_encode_packed(1);
+	this->unpack(X_N, 1);
+}
+
+template <typename B>
+void Encoder_polar<B>
+::_encode_packed(const int n_frames)
+{
+	this->light_encode_packed(n_frames);
 }
 
 template <typename B>
 void Encoder_polar<B>
 ::light_encode(B *bits)
 {
-	for (auto k = (this->N >> 1); k > 0; k >>= 1)
-		for (auto j = 0; j < this->N; j += 2 * k)
-			for (auto i = 0; i < k; i++)
-				bits[j + i] = bits[j + i] ^ bits[k + j + i];
+	this->pack(bits, 1);
+	this->light_encode_packed(1);
+	this->unpack(bits, 1);
 }
 
 template <typename B>
 void Encoder_polar<B>
-::convert(const B *U_K, B *U_N)
+::light_encode_packed(const int n_frames)
 {
-	if (U_K == U_N)
-	{
-		std::vector<B> U_K_tmp(this->K);
-		std::copy(U_K, U_K + this->K, U_K_tmp.begin());
+	const auto n_words = (int)(((size_t)this->N * n_frames + 63) / 64);
+	auto words = this->X_N_packed.data();
 
-		auto j = 0;
-		for (unsigned i = 0; i < frozen_bits.size(); i++)
-			U_N[i] = (frozen_bits[i]) ? (B)0 : U_K_tmp[j++];
+	// the butterfly stages commute: the strides that fit in a word are processed together word by word
+	const auto m_in_word = std::min(this->m, 6);
+	for (auto w = 0; w < n_words; w++)
+	{
+		auto x = words[w];
+		for (auto s = 0; s < m_in_word; s++)
+			x ^= (x >> (1 << s)) & butterfly_masks[s];
+		words[w] = x;
 	}
-	else
+
+	// the larger strides are xors of whole words (vectorized by the compiler)
+	for (auto kw = 1; kw < this->N / 64; kw <<= 1)
+		for (auto j = 0; j < n_words; j += 2 * kw)
+			for (auto i = 0; i < kw; i++)
+				words[j + i] ^= words[j + kw + i];
+}
+
+template <typename B>
+void Encoder_polar<B>
+::clear_frozen_bits_packed(const int n_frames)
+{
+	const auto n_words = (int)(((size_t)this->N * n_frames + 63) / 64);
+	const auto n_mask  = (int)this->info_mask.size();
+	for (auto w = 0; w < n_words; w++)
+		this->X_N_packed[w] &= this->info_mask[w % n_mask];
+}
+
+template <typename B>
+void Encoder_polar<B>
+::pack(const B *U_N, const int n_frames)
+{
+	const auto n_bits  = (size_t)this->N * n_frames;
+	const auto n_words = (n_bits + 63) / 64;
+	std::fill(this->X_N_packed.begin(), this->X_N_packed.begin() + n_words, (uint64_t)0);
+	for (size_t i = 0; i < n_bits; i++)
+		this->X_N_packed[i >> 6] |= (uint64_t)(U_N[i] != 0) << (i & 63);
+}
+
+template <typename B>
+void Encoder_polar<B>
+::pack_info_bits(const B *U_K, const int n_frames)
+{
+	// only the frozen bits are cleared, the info bits are overwritten
+	this->clear_frozen_bits_packed(n_frames);
+	for (auto f = 0; f < n_frames; f++)
 	{
-		auto j = 0;
-		for (unsigned i = 0; i < frozen_bits.size(); i++)
-			U_N[i] = (frozen_bits[i]) ? (B)0 : U_K[j++];
+		const auto off = (size_t)f * this->N;
+		for (auto k = 0; k < this->K; k++)
+		{
+			const auto i   = off + this->info_bits_pos[k];
+			const auto bit = (uint64_t)1 << (i & 63);
+			auto &word = this->X_N_packed[i >> 6];
+			word = (U_K[f * this->K + k] != 0) ? word | bit : word & ~bit;
+		}
 	}
 }
 
+template <typename B>
+void Encoder_polar<B>
+::unpack(B *X_N, const int n_frames)
+{
+	const auto n_bits = (size_t)this->N * n_frames;
+	for (size_t i = 0; i < n_bits; i++)
+		X_N[i] = (B)((this->X_N_packed[i >> 6] >> (i & 63)) & 1);
+}
+
 template <typename B>
 bool Encoder_polar<B>
 ::is_codeword(const B *X_N)
@@ -103,6 +191,12 @@ void Encoder_polar<B>
 	for (auto n = 0; n < this->N; n++)
 		if (!frozen_bits[n])
 			this->info_bits_pos[k++] = n;
+
+	// when N < 64 the mask of a frame is repeated to cover a full word
+	std::fill(this->info_mask.begin(), this->info_mask.end(), (uint64_t)0);
+	for (auto i = 0; i < std::max(this->N, 64); i++)
+		if (!frozen_bits[i % this->N])
+			this->info_mask[i >> 6] |= (uint64_t)1 << (i & 63);
 }
 
 // ==================================================================================== explicit template instantiation 
@@ -2,6 +2,7 @@
 #define ENCODER_POLAR_HPP_
 
 #include <vector>
+#include <cstdint>
 
 #include "Tools/Code/Polar/Frozenbits_notifier.hpp"
 
@@ -19,19 +20,33 @@ protected:
 	const std::vector<bool>& frozen_bits; // true means frozen, false means set to 0/1
 	      std::vector<B>     X_N_tmp; 
 
+	// the frames are encoded on packed bits (the bit 'i' of the frame 'f' is the bit '(f * N + i) % 64' of the word
+	// '(f * N + i) / 64'), all the frames are packed one after the other: when N < 64 several frames share a word
+	std::vector<uint64_t> X_N_packed;
+	std::vector<uint64_t> info_mask; // info bits mask of one word (N < 64) or of one frame (N >= 64)
+
 public:
 	Encoder_polar(const int& K, const int& N, const std::vector<bool>& frozen_bits, const int n_frames = 1);
 	virtual ~Encoder_polar() {}
 
 	void light_encode(B *bits);
 
+	using Encoder<B>::encode;
+	virtual void encode(const B *U_K, B *X_N, const int frame_id = -1);
+
 	bool is_codeword(const B *X_N);
 
 	virtual void notify_frozenbits_update();
 
 protected:
 	virtual void _encode(const B *U_K, B *X_N, const int frame_id);
-	void convert(const B *U_K, B *U_N);
+	virtual void _encode_packed(const int n_frames);
+
+	void pack          (const B *U_N,       const int n_frames);
+	void pack_info_bits(const B *U_K,       const int n_frames);
+	void unpack        (      B *X_N,       const int n_frames);
+	void light_encode_packed(               const int n_frames);
+	void clear_frozen_bits_packed(          const int n_frames);
 };
 }
 }
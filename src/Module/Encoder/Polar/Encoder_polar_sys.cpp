@@ -18,18 +18,15 @@ Encoder_polar_sys<B>
 
 template <typename B>
 void Encoder_polar_sys<B>
-::_encode(const B *U_K, B *X_N, const int frame_id)
+::_encode_packed(const int n_frames)
 {
-	this->convert(U_K, X_N);
-
 	// first time encode
-	this->light_encode(X_N);
+	this->light_encode_packed(n_frames);
 
-	for (auto i = 0; i < this->N; i++)
-		X_N[i] = (B)(!this->frozen_bits[i]) && X_N[i];
+	this->clear_frozen_bits_packed(n_frames);
 
 	// second time encode because of systematic encoder
-	this->light_encode(X_N);
+	this->light_encode_packed(n_frames);
 }
 
 // ==================================================================================== explicit template instantiation 
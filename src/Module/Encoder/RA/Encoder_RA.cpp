@@ -46,7 +46,7 @@ void Encoder_RA<B>
 		for (auto j = 0; j < rep_count; j++)
 			U[i * rep_count +j] = U_K[i];
 
-	interleaver.interleave(U.data(), tmp_X_N.data(), frame_id);
+	interleaver.interleave(U.data(), tmp_X_N.data(), frame_id, 1);
 
 	// accumulation
 	for (auto i = 1; i < this->N; i++)
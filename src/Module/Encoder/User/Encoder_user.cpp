@@ -1,3 +1,6 @@
+#include <map>
+#include <tuple>
+#include <mutex>
 #include <fstream>
 #include <sstream>
 
@@ -8,76 +11,87 @@
 using namespace aff3ct;
 using namespace aff3ct::module;
 
+// codewords already read in this process: (file name, K, N) -> frames, the encoders of the different threads share the
+// same frames instead of parsing the file again
 template <typename B>
-Encoder_user<B>
-::Encoder_user(const int K, const int N, const std::string &filename, const int n_frames)
-: Encoder<B>(K, N, n_frames), codewords(), cw_counter(0)
+static std::shared_ptr<const std::vector<std::vector<B>>> read_codewords(const std::string &filename, const int K,
+                                                                         const int N)
 {
-	const std::string name = "Encoder_user";
-	this->set_name(name);
+	static std::map<std::tuple<std::string,int,int>, std::weak_ptr<const std::vector<std::vector<B>>>> cache;
+	static std::mutex                                                                                 cache_mutex;
 
-	if (filename.empty())
-		throw tools::invalid_argument(__FILE__, __LINE__, __func__, "'filename' should not be empty.");
+	std::lock_guard<std::mutex> lock(cache_mutex);
+
+	auto &cached = cache[std::make_tuple(filename, K, N)];
+	if (auto codewords = cached.lock())
+		return codewords;
 
 	std::ifstream file(filename.c_str(), std::ios::in);
 
-	if (file.is_open())
+	if (!file.is_open())
 	{
-		int n_cw = 0, src_size = 0, cw_size = 0;
+		std::stringstream message;
+		message << "Can't open '" + filename + "' file.";
+		throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
 
-		file >> n_cw;
-		file >> cw_size;
-		file >> src_size;
+	int n_cw = 0, src_size = 0, cw_size = 0;
 
-		if (n_cw <= 0 || src_size <= 0 || cw_size <= 0)
-		{
-			std::stringstream message;
-			message << "'n_cw', 'src_size' and 'cw_size' have to be greater than 0 ('n_cw' = " << n_cw
-			        << ", 'src_size' = " << src_size << ", 'cw_size' = " << cw_size << ").";
-			throw tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
-		}
+	file >> n_cw;
+	file >> cw_size;
+	file >> src_size;
 
-		if (cw_size < src_size)
-		{
-			std::stringstream message;
-			message << "'cw_size' has to be equal or greater than 'src_size' ('cw_size' = " << cw_size
-			        << ", 'src_size' = " << src_size << ").";
-			throw tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
-		}
+	if (n_cw <= 0 || src_size <= 0 || cw_size <= 0)
+	{
+		std::stringstream message;
+		message << "'n_cw', 'src_size' and 'cw_size' have to be greater than 0 ('n_cw' = " << n_cw
+		        << ", 'src_size' = " << src_size << ", 'cw_size' = " << cw_size << ").";
+		throw tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
+	}
 
-		this->codewords.resize(n_cw);
-		for (auto i = 0; i < n_cw; i++)
-			this->codewords[i].resize(cw_size);
+	if (cw_size < src_size)
+	{
+		std::stringstream message;
+		message << "'cw_size' has to be equal or greater than 'src_size' ('cw_size' = " << cw_size
+		        << ", 'src_size' = " << src_size << ").";
+		throw tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
+	}
 
-		if ((src_size == this->K) && (cw_size == this->N))
+	if ((src_size != K) || (cw_size != N))
+	{
+		std::stringstream message;
+		message << "The number of information bits or the codeword size is wrong "
+		        << "(read: {" << src_size << "," << cw_size << "}, "
+		        << "expected: {" << K << "," << N << "}).";
+		throw tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	auto codewords = std::make_shared<std::vector<std::vector<B>>>(n_cw, std::vector<B>(cw_size));
+	for (auto i = 0; i < n_cw; i++)
+		for (auto j = 0; j < cw_size; j++)
 		{
-			for (auto i = 0; i < n_cw; i++)
-				for (auto j = 0; j < cw_size; j++)
-				{
-					int symbol;
-					file >> symbol;
-					this->codewords[i][j] = (B)symbol;
-				}
+			int symbol;
+			file >> symbol;
+			(*codewords)[i][j] = (B)symbol;
 		}
-		else
-		{
-			file.close();
 
-			std::stringstream message;
-			message << "The number of information bits or the codeword size is wrong "
-			        << "(read: {" << src_size << "," << cw_size << "}, "
-			        << "expected: {" << this->K << "," << this->N << "}).";
-			throw tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
-		}
+	cached = codewords;
+	return codewords;
+}
 
-		file.close();
-	}
-	else
-	{
-		std::stringstream message;
-		message << "Can't open '" + filename + "' file.";
-		throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
-	}
+template <typename B>
+Encoder_user<B>
+::Encoder_user(const int K, const int N, const std::string &filename, const int n_frames)
+: Encoder<B>(K, N, n_frames), codewords(), fra_first(0), fra_step(1), n_fra_played(0), cw_counter(0)
+{
+	const std::string name = "Encoder_user";
+	this->set_name(name);
+
+	if (filename.empty())
+		throw tools::invalid_argument(__FILE__, __LINE__, __func__, "'filename' should not be empty.");
+
+	this->codewords    = read_codewords<B>(filename, K, N);
+	this->n_fra_played = (int)this->codewords->size();
 }
 
 template <typename B>
@@ -86,15 +100,42 @@ Encoder_user<B>
 {
 }
 
+template <typename B>
+void Encoder_user<B>
+::select_frames(const int first, const int step)
+{
+	if (first < 0 || step <= 0)
+	{
+		std::stringstream message;
+		message << "'first' has to be positive and 'step' has to be greater than 0 ('first' = " << first
+		        << ", 'step' = " << step << ").";
+		throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	const auto n_fra_file = (int)this->codewords->size();
+	if (first < n_fra_file)
+	{
+		this->fra_first    = first;
+		this->n_fra_played = (n_fra_file - first + step -1) / step;
+	}
+	else // less frames than subsets: play a single frame
+	{
+		this->fra_first    = first % n_fra_file;
+		this->n_fra_played = 1;
+	}
+
+	this->fra_step   = step;
+	this->cw_counter = 0;
+}
+
 template <typename B>
 void Encoder_user<B>
 ::_encode(const B *U_K, B *X_N, const int frame_id)
 {
-	std::copy(this->codewords[this->cw_counter].begin(),
-	          this->codewords[this->cw_counter].end  (),
-	          X_N);
+	const auto &frame = (*this->codewords)[this->fra_first + this->cw_counter * this->fra_step];
+	std::copy(frame.begin(), frame.end(), X_N);
 
-	this->cw_counter = (this->cw_counter +1) % (int)this->codewords.size();
+	this->cw_counter = (this->cw_counter +1) % this->n_fra_played;
 }
 
 template <typename B>
@@ -2,6 +2,8 @@
 #define ENCODER_USER_HPP_
 
 #include <string>
+#include <memory>
+#include <vector>
 
 #include "../Encoder.hpp"
 
@@ -13,7 +15,11 @@ template <typename B = int>
 class Encoder_user : public Encoder<B>
 {
 private:
-	std::vector<std::vector<B>> codewords;
+	std::shared_ptr<const std::vector<std::vector<B>>> codewords; // frames of the file, shared by the encoders of a file
+
+	int fra_first;    // first frame played
+	int fra_step;     // gap between two played frames
+	int n_fra_played; // number of played frames
 	int cw_counter;
 
 public:
@@ -24,6 +30,15 @@ public:
 
 	bool is_sys() const;
 
+	/*!
+	 * \brief Plays only the frames 'first', 'first + step', 'first + 2 * step', etc. of the file (allows to split the
+	 *        frames between several encoders).
+	 *
+	 * \param first: the first frame to play.
+	 * \param step:  the gap between two played frames.
+	 */
+	void select_frames(const int first, const int step);
+
 protected:
 	void _encode(const B *U_K, B *X_N, const int frame_id);
 };
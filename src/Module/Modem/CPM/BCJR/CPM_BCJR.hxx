@@ -41,9 +41,9 @@ CPM_BCJR<SIN,SOUT,Q,MAX>
   ext_size         ( dec_size                              ),
 
   symb_apriori_prob(n_symbols                 * cpm.m_order),
-  gamma            (n_symbols * cpm.max_st_id * cpm.m_order),
-  alpha            (n_symbols * cpm.max_st_id              ),
-  beta             (n_symbols * cpm.max_st_id              ),
+  gamma            (n_symbols * cpm.n_st      * cpm.m_order),
+  alpha            (n_symbols * cpm.n_st                   ),
+  beta             (n_symbols * cpm.n_st                   ),
   proba_msg_symb   (n_symbols                 * cpm.m_order),
   proba_msg_bits   (n_symbols * cpm.n_b_per_s * 2          )
 {
@@ -154,45 +154,54 @@ template <typename SIN, typename SOUT,  typename Q, tools::proto_max<Q> MAX>
 void CPM_BCJR<SIN,SOUT,Q,MAX>
 ::compute_alpha_beta_gamma(const Q *Lch_N)
 {
+	// the states are the positions in 'cpm.allowed_states' (the initial and final state is 0)
+	const auto n_st    = cpm.n_st;
+	const auto m_order = cpm.m_order;
+	const auto next_st = cpm.compact_next_state.data();
+	const auto wave    = cpm.compact_wave_form.data();
+	const auto orig_st = cpm.compact_original_state.data();
+	const auto orig_tr = cpm.compact_input_transition.data();
+
 	// alpha and beta initialization
 	std::fill(alpha.begin(), alpha.end(), negative_inf<Q>());
 	std::fill(beta .begin(), beta .end(), negative_inf<Q>());
-	alpha[                                cpm.allowed_states[0]] = 0;
-	beta [(n_symbols -1) * cpm.max_st_id +cpm.allowed_states[0]] = 0;
+	alpha[                       0] = 0;
+	beta [(n_symbols -1) * n_st + 0] = 0;
 
 	// compute gamma
 	for (auto i = 0; i < n_symbols; i++)
-		for (auto st = 0; st < cpm.n_st; st++)
-			for (auto tr = 0; tr < cpm.m_order; tr++)
-				gamma[(i * cpm.max_st_id + cpm.allowed_states[st]) * cpm.m_order + tr] =
-				      Lch_N[i*cpm.max_wa_id + cpm.trellis_related_wave_form[cpm.allowed_states[st] * cpm.m_order +tr]] // info from the channel
-				      + symb_apriori_prob[i * cpm.m_order +tr];                                                        // info from the decoder
-
+		for (auto st = 0; st < n_st; st++)
+			for (auto tr = 0; tr < m_order; tr++)
+				gamma[(i * n_st + st) * m_order + tr] = Lch_N[i * cpm.max_wa_id + wave[st * m_order + tr]] // info from the channel
+				                                      + symb_apriori_prob[i * m_order + tr];               // info from the decoder
 
 	// compute alpha and beta
 	for (auto i = 1; i < n_symbols; i++)
 	{
-		for (auto st = 0; st < cpm.n_st; st++)
+		const auto alpha_prev = &alpha[(i -1) * n_st];
+		const auto alpha_cur  = &alpha[(i -0) * n_st];
+		const auto gamma_prev = &gamma[(i -1) * n_st * m_order];
+		const auto beta_next  = &beta [(n_symbols - (i +0)) * n_st];
+		const auto beta_cur   = &beta [(n_symbols - (i +1)) * n_st];
+		const auto gamma_cur  = &gamma[(n_symbols -  i    ) * n_st * m_order];
+
+		for (auto st = 0; st < n_st; st++)
 		{
 			// compute the alpha nodes
-			for (auto tr = 0; tr < cpm.m_order; tr++)
-				alpha        [(i -0) * cpm.max_st_id + cpm.allowed_states[st]] =
-				    MAX(alpha[(i -0) * cpm.max_st_id + cpm.allowed_states[st]],
-				        alpha[(i -1) * cpm.max_st_id + cpm.anti_trellis_original_state[cpm.allowed_states[st]*cpm.m_order +tr]] +
-				        gamma[((i-1) * cpm.max_st_id + cpm.anti_trellis_original_state[cpm.allowed_states[st]*cpm.m_order +tr]) * cpm.m_order
-				              + cpm.anti_trellis_input_transition[cpm.allowed_states[st]*cpm.m_order +tr]]);
+			for (auto tr = 0; tr < m_order; tr++)
+			{
+				const auto o_st = orig_st[st * m_order + tr];
+				alpha_cur[st] = MAX(alpha_cur[st], alpha_prev[o_st] + gamma_prev[o_st * m_order + orig_tr[st * m_order + tr]]);
+			}
 
 			// compute the beta nodes
-			for (auto tr = 0; tr < cpm.m_order; tr++)
-				beta         [(n_symbols - (i +1)) * cpm.max_st_id + cpm.allowed_states[st]] =
-				    MAX(beta [(n_symbols - (i +1)) * cpm.max_st_id + cpm.allowed_states[st]],
-				        beta [(n_symbols - (i +0)) * cpm.max_st_id + cpm.trellis_next_state[cpm.allowed_states[st]*cpm.m_order +tr]] +
-				        gamma[((n_symbols-      i) * cpm.max_st_id + cpm.allowed_states[st]) * cpm.m_order + tr]);
+			for (auto tr = 0; tr < m_order; tr++)
+				beta_cur[st] = MAX(beta_cur[st], beta_next[next_st[st * m_order + tr]] + gamma_cur[st * m_order + tr]);
 		}
 
 		// normalize alpha and beta vectors (not impact on the decoding performances)
-		BCJR_normalize<Q,MAX>(&alpha[             (i +0)  * cpm.max_st_id], cpm.max_st_id);
-		BCJR_normalize<Q,MAX>(&beta [(n_symbols - (i +1)) * cpm.max_st_id], cpm.max_st_id);
+		BCJR_normalize<Q,MAX>(alpha_cur, n_st);
+		BCJR_normalize<Q,MAX>(beta_cur,  n_st);
 	}
 }
 
@@ -200,16 +209,20 @@ template <typename SIN, typename SOUT,  typename Q, tools::proto_max<Q> MAX>
 void CPM_BCJR<SIN,SOUT,Q,MAX>
 ::symboles_probas()
 {
+	const auto n_st    = cpm.n_st;
+	const auto m_order = cpm.m_order;
+	const auto next_st = cpm.compact_next_state.data();
+
 	std::fill(proba_msg_symb.begin(), proba_msg_symb.end(), negative_inf<Q>());
 
 	for (auto i = 0; i < n_symbols; i++)
-		for (auto tr = 0; tr < cpm.m_order; tr++)
-			for (auto st = 0; st < cpm.n_st; st++)
-				proba_msg_symb        [ i * cpm.m_order  + tr] =
-				    MAX(proba_msg_symb[ i * cpm.m_order  + tr],
-				        alpha   [ i * cpm.max_st_id + cpm.allowed_states[st]] +
-				        beta    [ i * cpm.max_st_id + cpm.trellis_next_state[cpm.allowed_states[st]*cpm.m_order + tr]] +
-				        gamma   [(i * cpm.max_st_id + cpm.allowed_states[st]) * cpm.m_order + tr]);
+		for (auto tr = 0; tr < m_order; tr++)
+			for (auto st = 0; st < n_st; st++)
+				proba_msg_symb        [ i * m_order + tr] =
+				    MAX(proba_msg_symb[ i * m_order + tr],
+				        alpha   [ i * n_st + st] +
+				        beta    [ i * n_st + next_st[st * m_order + tr]] +
+				        gamma   [(i * n_st + st) * m_order + tr]);
 }
 
 template <typename SIN, typename SOUT,  typename Q, tools::proto_max<Q> MAX>
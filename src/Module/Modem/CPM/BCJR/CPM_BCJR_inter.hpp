@@ -0,0 +1,60 @@
+#ifndef CPM_BCJR_INTER_HPP_
+#define CPM_BCJR_INTER_HPP_
+
+#include <vector>
+#include <mipp.h>
+
+#include "Tools/Math/max.h"
+
+#include "../CPM_parameters.hpp"
+
+namespace aff3ct
+{
+namespace module
+{
+// inter-frame SIMD CPM BCJR: each SIMD register contains the same metric of 'mipp::nElReg<Q>()' different frames, the
+// inputs and the outputs are interleaved (| e0_f0 | e0_f1 | e0_f2 | e0_f3 | e1_f0 | ...), the trellis is the compact one
+// (the states are the positions in 'cpm.allowed_states')
+template <typename SIN = int, typename SOUT = int, typename Q = float, tools::proto_max_i<Q> MAX = tools::max_star_i>
+class CPM_BCJR_inter
+{
+protected:
+	const CPM_parameters<SIN,SOUT>& cpm; // all CPM parameters
+	const int n_symbols;                 // size of a frame (in symbols) from the channel (with tail bits)
+	const int chn_size;                  // size of a frame (wave form probas) from the channel (with tail bits)
+	const int dec_size;                  // size of a frame (bits proba) from the decoder
+	const int ext_size;                  // size of a frame (bits proba) from the bcjr
+
+	mipp::vector<Q> symb_apriori_prob;
+	mipp::vector<Q> gamma;
+	mipp::vector<Q> alpha;
+	mipp::vector<Q> beta;
+	mipp::vector<Q> proba_msg_symb;
+	mipp::vector<Q> proba_msg_bits;
+
+public:
+	CPM_BCJR_inter(const CPM_parameters<SIN,SOUT>& _cpm, const int _frame_size);
+	virtual ~CPM_BCJR_inter();
+
+	int get_n_frames() const; // number of frames decoded at once
+
+	// CPM_BCJR_inter for the demodulation ('mipp::nElReg<Q>()' interleaved frames)
+	void decode(const Q *Lch_N,                  Q *Le_N);
+	void decode(const Q *Lch_N, const Q *Ldec_N, Q *Le_N);
+
+private:
+	void LLR_to_logsymb_proba    (const Q *Ldec_N); // retrieve log symbols probability from LLR
+	void compute_alpha_beta_gamma(const Q *Lch_N ); // compute gamma, alpha and beta, heart of the processing
+	void symboles_probas         (               ); // from alpha, beta, and gamma computes new symbol probability
+	void bits_probas             (               ); // from symbol probabilities, computes bit probabilities
+	void compute_ext             (      Q *Le_N  ); // extrinsic information processing from bit probabilities
+	void compute_ext             (const Q *Ldec_N,
+	                                    Q *Le_N  ); // extrinsic information processing from bit probabilities
+	                                                // and CPM a priori LLR
+};
+}
+}
+
+#include "CPM_BCJR_inter.hxx"
+
+#endif /* CPM_BCJR_INTER_HPP_ */
@@ -0,0 +1,256 @@
+#include <limits>
+#include <algorithm>
+
+#include "CPM_BCJR_inter.hpp"
+
+namespace aff3ct
+{
+namespace module
+{
+// the max* of two -inf is NaN: the unreachable states are initialized with a finite value (the sum of three metrics
+// initialized like this can not overflow)
+template<typename Q>
+inline Q negative_inf_i(){return -std::numeric_limits<Q>::max() / (Q)4; }
+
+template <typename Q, tools::proto_max_i<Q> MAX>
+inline void BCJR_normalize_i(Q *metrics, const int &n_states)
+{
+	constexpr auto stride = mipp::nElReg<Q>();
+
+	// normalization
+	auto r_norm = mipp::Reg<Q>(negative_inf_i<Q>());
+	for (auto j = 0; j < n_states; j++)
+		r_norm = MAX(r_norm, mipp::Reg<Q>(&metrics[j * stride]));
+
+	for (auto j = 0; j < n_states; j++)
+		(mipp::Reg<Q>(&metrics[j * stride]) - r_norm).store(&metrics[j * stride]);
+}
+
+template <typename SIN, typename SOUT,  typename Q, tools::proto_max_i<Q> MAX>
+CPM_BCJR_inter<SIN,SOUT,Q,MAX>
+::CPM_BCJR_inter(const CPM_parameters<SIN,SOUT>& _cpm, const int _n_symbols)
+: cpm              (_cpm                                                        ),
+  n_symbols        (_n_symbols                                                  ),
+  chn_size         ( n_symbols           * cpm.max_wa_id                        ),
+  dec_size         ((n_symbols - cpm.tl) * cpm.n_b_per_s                        ),
+  ext_size         ( dec_size                                                   ),
+
+  symb_apriori_prob(n_symbols                 * cpm.m_order * mipp::nElReg<Q>()),
+  gamma            (n_symbols * cpm.n_st      * cpm.m_order * mipp::nElReg<Q>()),
+  alpha            (n_symbols * cpm.n_st                    * mipp::nElReg<Q>()),
+  beta             (n_symbols * cpm.n_st                    * mipp::nElReg<Q>()),
+  proba_msg_symb   (n_symbols                 * cpm.m_order * mipp::nElReg<Q>()),
+  proba_msg_bits   (n_symbols * cpm.n_b_per_s * 2           * mipp::nElReg<Q>())
+{
+}
+
+template <typename SIN, typename SOUT,  typename Q, tools::proto_max_i<Q> MAX>
+CPM_BCJR_inter<SIN,SOUT,Q,MAX>
+::~CPM_BCJR_inter()
+{
+}
+
+template <typename SIN, typename SOUT,  typename Q, tools::proto_max_i<Q> MAX>
+int CPM_BCJR_inter<SIN,SOUT,Q,MAX>
+::get_n_frames() const
+{
+	return mipp::nElReg<Q>();
+}
+
+template <typename SIN, typename SOUT,  typename Q, tools::proto_max_i<Q> MAX>
+void CPM_BCJR_inter<SIN,SOUT,Q,MAX>
+::decode(const Q *Lch_N, Q *Le_N)
+{
+	std::fill(symb_apriori_prob.begin(), symb_apriori_prob.end(), (Q)0);
+
+	compute_alpha_beta_gamma(Lch_N);
+	symboles_probas         (     );
+	bits_probas             (     );
+	compute_ext             (Le_N );
+}
+
+template <typename SIN, typename SOUT,  typename Q, tools::proto_max_i<Q> MAX>
+void CPM_BCJR_inter<SIN,SOUT,Q,MAX>
+::decode(const Q *Lch_N, const Q *Ldec_N, Q *Le_N)
+{
+	LLR_to_logsymb_proba    (Ldec_N      );
+	compute_alpha_beta_gamma(Lch_N       );
+	symboles_probas         (            );
+	bits_probas             (            );
+	compute_ext             (Ldec_N, Le_N);
+}
+
+template <typename SIN, typename SOUT,  typename Q, tools::proto_max_i<Q> MAX>
+void CPM_BCJR_inter<SIN,SOUT,Q,MAX>
+::LLR_to_logsymb_proba(const Q *Ldec_N)
+{
+	constexpr auto stride = mipp::nElReg<Q>();
+
+	std::fill(symb_apriori_prob.begin(), symb_apriori_prob.end(), (Q)0);
+
+	for (auto i = 0; i < dec_size / cpm.n_b_per_s; i++)
+		for (auto b = 0; b < cpm.n_b_per_s; b++)
+		{
+			const auto r_ldec = mipp::div2(mipp::Reg<Q>(&Ldec_N[(i * cpm.n_b_per_s + b) * stride]));
+
+			for (auto tr = 0; tr < cpm.m_order; tr++)
+			{
+				// transition_to_binary what bit state we should have for the given transition and bit position
+				const auto bit_state = (int)cpm.transition_to_binary[tr * cpm.n_b_per_s + b];
+				const auto r_apriori = mipp::Reg<Q>(&symb_apriori_prob[(i * cpm.m_order + tr) * stride]);
+
+				// match -> add probability else remove
+				const auto r_res = (bit_state == 0) ? r_apriori + r_ldec : r_apriori - r_ldec;
+				r_res.store(&symb_apriori_prob[(i * cpm.m_order + tr) * stride]);
+			}
+		}
+}
+
+template <typename SIN, typename SOUT,  typename Q, tools::proto_max_i<Q> MAX>
+void CPM_BCJR_inter<SIN,SOUT,Q,MAX>
+::compute_alpha_beta_gamma(const Q *Lch_N)
+{
+	constexpr auto stride = mipp::nElReg<Q>();
+
+	const auto n_st    = cpm.n_st;
+	const auto m_order = cpm.m_order;
+	const auto next_st = cpm.compact_next_state.data();
+	const auto wave    = cpm.compact_wave_form.data();
+	const auto orig_st = cpm.compact_original_state.data();
+	const auto orig_tr = cpm.compact_input_transition.data();
+
+	// alpha and beta initialization
+	std::fill(alpha.begin(), alpha.end(), negative_inf_i<Q>());
+	std::fill(beta .begin(), beta .end(), negative_inf_i<Q>());
+	const auto beta_last = beta.begin() + (n_symbols -1) * n_st * stride;
+	std::fill(alpha.begin(), alpha.begin() + stride, (Q)0);
+	std::fill(beta_last,     beta_last     + stride, (Q)0);
+
+	// compute gamma
+	for (auto i = 0; i < n_symbols; i++)
+		for (auto tr = 0; tr < m_order; tr++)
+		{
+			// info from the decoder
+			const auto r_apriori = mipp::Reg<Q>(&symb_apriori_prob[(i * m_order + tr) * stride]);
+			for (auto st = 0; st < n_st; st++)
+			{
+				// info from the channel
+				const auto r_chn = mipp::Reg<Q>(&Lch_N[(i * cpm.max_wa_id + wave[st * m_order + tr]) * stride]);
+				(r_chn + r_apriori).store(&gamma[((i * n_st + st) * m_order + tr) * stride]);
+			}
+		}
+
+	// compute alpha and beta
+	for (auto i = 1; i < n_symbols; i++)
+	{
+		const auto alpha_prev = &alpha[((i -1) * n_st) * stride];
+		const auto alpha_cur  = &alpha[((i -0) * n_st) * stride];
+		const auto gamma_prev = &gamma[((i -1) * n_st * m_order) * stride];
+		const auto beta_next  = &beta [((n_symbols - (i +0)) * n_st) * stride];
+		const auto beta_cur   = &beta [((n_symbols - (i +1)) * n_st) * stride];
+		const auto gamma_cur  = &gamma[((n_symbols -  i    ) * n_st * m_order) * stride];
+
+		for (auto st = 0; st < n_st; st++)
+		{
+			// compute the alpha nodes
+			auto r_alpha = mipp::Reg<Q>(&alpha_cur[st * stride]);
+			for (auto tr = 0; tr < m_order; tr++)
+			{
+				const auto o_st = orig_st[st * m_order + tr];
+				const auto o_tr = orig_tr[st * m_order + tr];
+				r_alpha = MAX(r_alpha, mipp::Reg<Q>(&alpha_prev[o_st * stride]) +
+				                       mipp::Reg<Q>(&gamma_prev[(o_st * m_order + o_tr) * stride]));
+			}
+			r_alpha.store(&alpha_cur[st * stride]);
+
+			// compute the beta nodes
+			auto r_beta = mipp::Reg<Q>(&beta_cur[st * stride]);
+			for (auto tr = 0; tr < m_order; tr++)
+				r_beta = MAX(r_beta, mipp::Reg<Q>(&beta_next[next_st[st * m_order + tr] * stride]) +
+				                     mipp::Reg<Q>(&gamma_cur[(st * m_order + tr) * stride]));
+			r_beta.store(&beta_cur[st * stride]);
+		}
+
+		// normalize alpha and beta vectors (not impact on the decoding performances)
+		BCJR_normalize_i<Q,MAX>(alpha_cur, n_st);
+		BCJR_normalize_i<Q,MAX>(beta_cur,  n_st);
+	}
+}
+
+template <typename SIN, typename SOUT,  typename Q, tools::proto_max_i<Q> MAX>
+void CPM_BCJR_inter<SIN,SOUT,Q,MAX>
+::symboles_probas()
+{
+	constexpr auto stride = mipp::nElReg<Q>();
+
+	const auto n_st    = cpm.n_st;
+	const auto m_order = cpm.m_order;
+	const auto next_st = cpm.compact_next_state.data();
+
+	for (auto i = 0; i < n_symbols; i++)
+		for (auto tr = 0; tr < m_order; tr++)
+		{
+			auto r_proba = mipp::Reg<Q>(negative_inf_i<Q>());
+			for (auto st = 0; st < n_st; st++)
+				r_proba = MAX(r_proba, mipp::Reg<Q>(&alpha[( i * n_st + st                          ) * stride]) +
+				                       mipp::Reg<Q>(&beta [( i * n_st + next_st[st * m_order + tr]) * stride]) +
+				                       mipp::Reg<Q>(&gamma[((i * n_st + st) * m_order + tr        ) * stride]));
+			r_proba.store(&proba_msg_symb[(i * m_order + tr) * stride]);
+		}
+}
+
+template <typename SIN, typename SOUT,  typename Q, tools::proto_max_i<Q> MAX>
+void CPM_BCJR_inter<SIN,SOUT,Q,MAX>
+::bits_probas()
+{
+	constexpr auto stride = mipp::nElReg<Q>();
+
+	for (auto i = 0; i < n_symbols; i++)
+		for (auto b = 0; b < cpm.n_b_per_s; b++)
+		{
+			mipp::Reg<Q> r_proba[2] = {negative_inf_i<Q>(), negative_inf_i<Q>()};
+			for (auto tr = 0; tr < cpm.m_order; tr++)
+			{
+				// bit_state = 0 or 1 ; bit 0 is msb, bit cpm.n_b_per_s-1 is lsb
+				const auto bit_state = cpm.transition_to_binary[tr * cpm.n_b_per_s + b];
+				r_proba[bit_state] = MAX(r_proba[bit_state],
+				                         mipp::Reg<Q>(&proba_msg_symb[(i * cpm.m_order + tr) * stride]));
+			}
+			r_proba[0].store(&proba_msg_bits[((i * cpm.n_b_per_s + b) * 2 +0) * stride]);
+			r_proba[1].store(&proba_msg_bits[((i * cpm.n_b_per_s + b) * 2 +1) * stride]);
+		}
+}
+
+template <typename SIN, typename SOUT,  typename Q, tools::proto_max_i<Q> MAX>
+void CPM_BCJR_inter<SIN,SOUT,Q,MAX>
+::compute_ext(Q *Le_N)
+{
+	constexpr auto stride = mipp::nElReg<Q>();
+
+	// remove tail bits
+	for (auto i = 0; i < ext_size; i ++)
+	{
+		// processing aposteriori and substracting a priori to directly obtain extrinsic
+		const auto r_ext = mipp::Reg<Q>(&proba_msg_bits[(i * 2 +0) * stride]) -
+		                   mipp::Reg<Q>(&proba_msg_bits[(i * 2 +1) * stride]);
+		r_ext.store(&Le_N[i * stride]);
+	}
+}
+
+template <typename SIN, typename SOUT,  typename Q, tools::proto_max_i<Q> MAX>
+void CPM_BCJR_inter<SIN,SOUT,Q,MAX>
+::compute_ext(const Q *Ldec_N, Q *Le_N)
+{
+	constexpr auto stride = mipp::nElReg<Q>();
+
+	// remove tail bits
+	for (auto i = 0; i < ext_size; i ++)
+	{
+		// processing aposteriori and substracting a priori to directly obtain extrinsic
+		const auto r_ext = mipp::Reg<Q>(&proba_msg_bits[(i * 2 +0) * stride]) -
+		                  (mipp::Reg<Q>(&proba_msg_bits[(i * 2 +1) * stride]) + mipp::Reg<Q>(&Ldec_N[i * stride]));
+		r_ext.store(&Le_N[i * stride]);
+	}
+}
+}
+}
@@ -190,6 +190,55 @@ void Encoder_CPE<SIN, SOUT>
 	}
 }
 
+template<typename SIN, typename SOUT>
+void Encoder_CPE<SIN, SOUT>
+::generate_compact_trellis(std::vector<int>& compact_next_state,
+                           std::vector<int>& compact_wave_form,
+                           std::vector<int>& compact_original_state,
+                           std::vector<int>& compact_input_transition)
+{
+	const std::vector<std::vector<int>*> tables = {&compact_next_state,     &compact_wave_form,
+	                                               &compact_original_state, &compact_input_transition};
+	for (auto t : tables)
+		if ((int)t->size() != cpm.n_st * cpm.m_order)
+		{
+			std::stringstream message;
+			message << "The compact trellis tables have to be of size 'cpm.n_st' * 'cpm.m_order' ('size()' = "
+			        << t->size() << ", 'cpm.n_st' = " << cpm.n_st << ", 'cpm.m_order' = " << cpm.m_order << ").";
+			throw tools::length_error(__FILE__, __LINE__, __func__, message.str());
+		}
+
+	// position of the states in 'allowed_states'
+	std::vector<int> compact_state(cpm.max_st_id, -1);
+	for (auto st = 0; st < cpm.n_st; st++)
+		compact_state[cpm.allowed_states[st]] = st;
+
+	for (auto st = 0; st < cpm.n_st; st++)
+		for (auto tr = 0; tr < cpm.m_order; tr++)
+		{
+			const auto state = cpm.allowed_states[st];
+
+			const auto next_state = compact_state[cpm.trellis_next_state         [state * cpm.m_order + tr]];
+			const auto orig_state = compact_state[cpm.anti_trellis_original_state[state * cpm.m_order + tr]];
+
+			if (next_state < 0 || orig_state < 0)
+			{
+				std::stringstream message;
+				message << "The trellis goes through a state which is not allowed ('state' = " << state
+				        << ", 'tr' = " << tr << ").";
+				throw tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
+			}
+
+			const auto wave_form  = (int)cpm.trellis_related_wave_form    [state * cpm.m_order + tr];
+			const auto input_tr   = (int)cpm.anti_trellis_input_transition[state * cpm.m_order + tr];
+
+			compact_next_state      [st * cpm.m_order + tr] = next_state;
+			compact_wave_form       [st * cpm.m_order + tr] = wave_form;
+			compact_original_state  [st * cpm.m_order + tr] = orig_state;
+			compact_input_transition[st * cpm.m_order + tr] = input_tr;
+		}
+}
+
 template<typename SIN, typename SOUT>
 SIN Encoder_CPE<SIN, SOUT>
 ::merge_bits(const SIN* in_bit, const int number_of_bits, const bool msb_to_lsb)
@@ -28,6 +28,12 @@ public:
 	void generate_anti_trellis(std::vector<int>& anti_trellis_original_state,
 	                           std::vector<SIN>& anti_trellis_input_transition);
 
+	// requires the allowed states, the trellis and the anti trellis
+	void generate_compact_trellis(std::vector<int>& compact_next_state,
+	                              std::vector<int>& compact_wave_form,
+	                              std::vector<int>& compact_original_state,
+	                              std::vector<int>& compact_input_transition);
+
 	// transition_to_binary :  value = 0 or 1 ; bit 0 is lsb, bit cpm.n_b_per_s-1 is msb
 	virtual void generate_mapper(std::vector<SIN>& transition_to_binary,
 	                             std::vector<SIN>& binary_to_transition,
@@ -48,7 +48,11 @@ public :
 	  trellis_next_state           (max_st_id     * m_order, -1),
 	  trellis_related_wave_form    (max_st_id     * m_order, -1),
 	  anti_trellis_original_state  (max_st_id     * m_order, -1),
-	  anti_trellis_input_transition(max_st_id     * m_order, -1)
+	  anti_trellis_input_transition(max_st_id     * m_order, -1),
+	  compact_next_state           (n_st          * m_order, -1),
+	  compact_wave_form            (n_st          * m_order, -1),
+	  compact_original_state       (n_st          * m_order, -1),
+	  compact_input_transition     (n_st          * m_order, -1)
 	{
 	}
 
@@ -96,6 +100,15 @@ public :
 
 	std::vector<SIN>  anti_trellis_input_transition; // from a given state and transition index,
 	                                                 // gives the related transition value
+
+	// same trellis and anti trellis but the states are the positions in 'allowed_states' (no jumps in the indexes):
+	// the tables are contiguous and the BCJR metrics are stored for the 'n_st' allowed states only
+	std::vector<int>  compact_next_state;            // from a given state and transition, gives the next state
+	std::vector<int>  compact_wave_form;             // from a given state and transition, gives the related wave form
+	std::vector<int>  compact_original_state;        // from a given state and transition index,
+	                                                 // gives the original state from where comes the transition
+	std::vector<int>  compact_input_transition;      // from a given state and transition index,
+	                                                 // gives the related transition value
 };
 }
 }
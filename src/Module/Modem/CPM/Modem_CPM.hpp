@@ -5,6 +5,7 @@
 #include <fstream>
 #include <string>
 #include <vector>
+#include <mipp.h>
 
 #include "Tools/Math/max.h"
 
@@ -13,13 +14,17 @@
 #include "CPM_parameters.hpp"
 #include "CPE/Encoder_CPE_Rimoldi.hpp"
 #include "BCJR/CPM_BCJR.hpp"
+#include "BCJR/CPM_BCJR_inter.hpp"
 
 namespace aff3ct
 {
 namespace module
 {
 // TODO: warning: working for Rimoldi decomposition only!
-template <typename B = int, typename R = float, typename Q = R, tools::proto_max<Q> MAX = tools::max_star>
+// when all the frames are demodulated at once, the frames are demodulated by groups of 'mipp::nElReg<Q>()' with the
+// inter-frame SIMD BCJR (the remaining frames are demodulated one by one)
+template <typename B = int, typename R = float, typename Q = R, tools::proto_max<Q> MAX = tools::max_star,
+          tools::proto_max_i<Q> MAX_i = tools::max_star_i>
 class Modem_CPM : public Modem<B,R,Q>
 {
 	using SIN  = B;
@@ -31,19 +36,24 @@ private:
 
 protected:
 	// inputs:
-	const bool                    no_sig2;    // no computation of sigma^2
+	const bool                       no_sig2;    // no computation of sigma^2
 
 	// modulation data:
-	CPM_parameters<SIN,SOUT>      cpm;        // all CPM parameters
-	R                             cpm_h;      // modulation index = k/p
-	R                             T_samp;     // sample duration  = 1/s_factor
-	std::vector<R>                baseband;   // translation of base band vectors
-	std::vector<R>                projection; // translation of filtering generator family
-	const int                     n_sy;       // number of symbols for one frame after encoding without tail symbols
-	const int                     n_sy_tl;    // number of symbols to send for one frame after encoding with tail symbols
-	Encoder_CPE_Rimoldi<SIN,SOUT> cpe;        // the continuous phase encoder
-
-	CPM_BCJR<SIN,SOUT,Q,MAX>      bcjr;       // demodulator
+	CPM_parameters<SIN,SOUT>         cpm;        // all CPM parameters
+	R                                cpm_h;      // modulation index = k/p
+	R                                T_samp;     // sample duration  = 1/s_factor
+	std::vector<R>                   baseband;   // translation of base band vectors
+	std::vector<R>                   projection; // translation of filtering generator family
+	const int                        n_sy;       // number of symbols for one frame after encoding without tail symbols
+	const int                        n_sy_tl;    // number of symbols to send for one frame after encoding with tail symbols
+	Encoder_CPE_Rimoldi<SIN,SOUT>    cpe;        // the continuous phase encoder
+
+	CPM_BCJR<SIN,SOUT,Q,MAX>         bcjr;       // demodulator
+	CPM_BCJR_inter<SIN,SOUT,Q,MAX_i> bcjr_inter; // inter-frame SIMD demodulator
+	const int                        n_inter;    // number of frames demodulated with 'bcjr_inter'
+	mipp::vector<Q>                  Y_inter1;   // reordered channel     information ('mipp::nElReg<Q>()' frames)
+	mipp::vector<Q>                  Y_inter2;   // reordered a priori    information ('mipp::nElReg<Q>()' frames)
+	mipp::vector<Q>                  Y_inter3;   // reordered demodulated information ('mipp::nElReg<Q>()' frames)
 
 public:
 	Modem_CPM(const int  N,
@@ -61,6 +71,11 @@ public:
 
 	void set_sigma(const R sigma);
 
+	virtual void demodulate (const Q *Y_N1,                Q *Y_N2, const int frame_id = -1);
+	using Modem<B,R,Q>::demodulate;
+	virtual void tdemodulate(const Q *Y_N1, const Q *Y_N2, Q *Y_N3, const int frame_id = -1);
+	using Modem<B,R,Q>::tdemodulate;
+
 	static int size_mod(const int N, const int bps, const int L, const int p, const int ups)
 	{
 		int m_order = (int)1 << bps;
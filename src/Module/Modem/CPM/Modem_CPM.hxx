@@ -10,19 +10,21 @@
 
 #include "Tools/Exception/exception.hpp"
 #include "Tools/Math/matrix.h"
+#include "Tools/Perf/Reorderer/Reorderer.hpp"
+
 #include "Modem_CPM.hpp"
 
 namespace aff3ct
 {
 namespace module
 {
-template <typename B, typename R, typename Q, tools::proto_max<Q> MAX>
-const std::string Modem_CPM<B,R,Q,MAX>::mapping_default = "NATURAL";
-template <typename B, typename R, typename Q, tools::proto_max<Q> MAX>
-const std::string Modem_CPM<B,R,Q,MAX>::wave_shape_default = "GMSK";
+template <typename B, typename R, typename Q, tools::proto_max<Q> MAX, tools::proto_max_i<Q> MAX_i>
+const std::string Modem_CPM<B,R,Q,MAX,MAX_i>::mapping_default = "NATURAL";
+template <typename B, typename R, typename Q, tools::proto_max<Q> MAX, tools::proto_max_i<Q> MAX_i>
+const std::string Modem_CPM<B,R,Q,MAX,MAX_i>::wave_shape_default = "GMSK";
 
-template <typename B, typename R, typename Q, tools::proto_max<Q> MAX>
-Modem_CPM<B,R,Q,MAX>
+template <typename B, typename R, typename Q, tools::proto_max<Q> MAX, tools::proto_max_i<Q> MAX_i>
+Modem_CPM<B,R,Q,MAX,MAX_i>
 ::Modem_CPM(const int  N,
             const R    sigma,
             const int  bits_per_symbol,
@@ -35,8 +37,8 @@ Modem_CPM<B,R,Q,MAX>
             const bool no_sig2,
             const int  n_frames)
 : Modem<B,R,Q>(N,
-               Modem_CPM<B,R,Q,MAX>::size_mod(N, bits_per_symbol, cpm_L, cpm_p, sampling_factor),
-               Modem_CPM<B,R,Q,MAX>::size_fil(N, bits_per_symbol, cpm_L, cpm_p),
+               Modem_CPM<B,R,Q,MAX,MAX_i>::size_mod(N, bits_per_symbol, cpm_L, cpm_p, sampling_factor),
+               Modem_CPM<B,R,Q,MAX,MAX_i>::size_fil(N, bits_per_symbol, cpm_L, cpm_p),
                sigma,
                n_frames),
   no_sig2   (no_sig2                            ),
@@ -54,7 +56,13 @@ Modem_CPM<B,R,Q,MAX>
   n_sy      (N/cpm.n_b_per_s                    ),
   n_sy_tl   (n_sy+cpm.tl                        ),
   cpe       (n_sy, cpm                          ),
-  bcjr      (cpm, n_sy_tl                       )
+  bcjr      (cpm, n_sy_tl                       ),
+  bcjr_inter(cpm, n_sy_tl                       ),
+  n_inter   (n_frames / mipp::nElReg<Q>() > 0 && mipp::nElReg<Q>() > 1 ?
+             (n_frames / mipp::nElReg<Q>()) * mipp::nElReg<Q>() : 0),
+  Y_inter1  (n_inter ? this->N_fil * mipp::nElReg<Q>() : 0),
+  Y_inter2  (n_inter ? this->N     * mipp::nElReg<Q>() : 0),
+  Y_inter3  (n_inter ? this->N     * mipp::nElReg<Q>() : 0)
 {
 	const std::string name = "Modem_CPM";
 	this->set_name(name);
@@ -81,6 +89,10 @@ Modem_CPM<B,R,Q,MAX>
 	                                cpm.trellis_related_wave_form    );
 	cpe.generate_anti_trellis      (cpm.anti_trellis_original_state,
 	                                cpm.anti_trellis_input_transition);
+	cpe.generate_compact_trellis   (cpm.compact_next_state,
+	                                cpm.compact_wave_form,
+	                                cpm.compact_original_state,
+	                                cpm.compact_input_transition     );
 
 	cpe.generate_tail_symb_transition(                               );
 
@@ -88,14 +100,14 @@ Modem_CPM<B,R,Q,MAX>
 	generate_projection            (                                 );
 }
 
-template <typename B, typename R, typename Q, tools::proto_max<Q> MAX>
-Modem_CPM<B,R,Q,MAX>
+template <typename B, typename R, typename Q, tools::proto_max<Q> MAX, tools::proto_max_i<Q> MAX_i>
+Modem_CPM<B,R,Q,MAX,MAX_i>
 ::~Modem_CPM()
 {
 }
 
-template <typename B, typename R, typename Q, tools::proto_max<Q> MAX>
-void Modem_CPM<B,R,Q,MAX>
+template <typename B, typename R, typename Q, tools::proto_max<Q> MAX, tools::proto_max_i<Q> MAX_i>
+void Modem_CPM<B,R,Q,MAX,MAX_i>
 ::set_sigma(const R sigma)
 {
 	Modem<B,R,Q>::set_sigma(sigma);
@@ -103,8 +115,8 @@ void Modem_CPM<B,R,Q,MAX>
 
 }
 
-template <typename B, typename R, typename Q, tools::proto_max<Q> MAX>
-void Modem_CPM<B,R,Q,MAX>
+template <typename B, typename R, typename Q, tools::proto_max<Q> MAX, tools::proto_max_i<Q> MAX_i>
+void Modem_CPM<B,R,Q,MAX,MAX_i>
 ::_modulate(const B *X_N1, R *X_N2, const int frame_id)
 {
 	// mapper
@@ -131,8 +143,75 @@ void Modem_CPM<B,R,Q,MAX>
 		}
 }
 
-template <typename B, typename R, typename Q, tools::proto_max<Q> MAX>
-void Modem_CPM<B,R,Q,MAX>
+template <typename B, typename R, typename Q, tools::proto_max<Q> MAX, tools::proto_max_i<Q> MAX_i>
+void Modem_CPM<B,R,Q,MAX,MAX_i>
+::demodulate(const Q *Y_N1, Q *Y_N2, const int frame_id)
+{
+	if (frame_id >= 0 || !n_inter)
+	{
+		Modem<B,R,Q>::demodulate(Y_N1, Y_N2, frame_id);
+		return;
+	}
+
+	constexpr auto n_frames_inter = mipp::nElReg<Q>();
+
+	std::vector<const Q*> frames_in (n_frames_inter);
+	std::vector<      Q*> frames_out(n_frames_inter);
+	for (auto f = 0; f < n_inter; f += n_frames_inter)
+	{
+		for (auto w = 0; w < n_frames_inter; w++)
+		{
+			frames_in [w] = Y_N1 + (f + w) * this->N_fil;
+			frames_out[w] = Y_N2 + (f + w) * this->N;
+		}
+
+		tools::Reorderer_static<Q,n_frames_inter>::apply(frames_in, Y_inter1.data(), this->N_fil);
+		bcjr_inter.decode(Y_inter1.data(), Y_inter3.data());
+		tools::Reorderer_static<Q,n_frames_inter>::apply_rev(Y_inter3.data(), frames_out, this->N);
+	}
+
+	// remaining frames
+	for (auto f = n_inter; f < this->n_frames; f++)
+		this->_demodulate(Y_N1 + f * this->N_fil, Y_N2 + f * this->N, f);
+}
+
+template <typename B, typename R, typename Q, tools::proto_max<Q> MAX, tools::proto_max_i<Q> MAX_i>
+void Modem_CPM<B,R,Q,MAX,MAX_i>
+::tdemodulate(const Q *Y_N1, const Q *Y_N2, Q *Y_N3, const int frame_id)
+{
+	if (frame_id >= 0 || !n_inter)
+	{
+		Modem<B,R,Q>::tdemodulate(Y_N1, Y_N2, Y_N3, frame_id);
+		return;
+	}
+
+	constexpr auto n_frames_inter = mipp::nElReg<Q>();
+
+	std::vector<const Q*> frames_in1(n_frames_inter);
+	std::vector<const Q*> frames_in2(n_frames_inter);
+	std::vector<      Q*> frames_out(n_frames_inter);
+	for (auto f = 0; f < n_inter; f += n_frames_inter)
+	{
+		for (auto w = 0; w < n_frames_inter; w++)
+		{
+			frames_in1[w] = Y_N1 + (f + w) * this->N_fil;
+			frames_in2[w] = Y_N2 + (f + w) * this->N;
+			frames_out[w] = Y_N3 + (f + w) * this->N;
+		}
+
+		tools::Reorderer_static<Q,n_frames_inter>::apply(frames_in1, Y_inter1.data(), this->N_fil);
+		tools::Reorderer_static<Q,n_frames_inter>::apply(frames_in2, Y_inter2.data(), this->N);
+		bcjr_inter.decode(Y_inter1.data(), Y_inter2.data(), Y_inter3.data());
+		tools::Reorderer_static<Q,n_frames_inter>::apply_rev(Y_inter3.data(), frames_out, this->N);
+	}
+
+	// remaining frames
+	for (auto f = n_inter; f < this->n_frames; f++)
+		this->_tdemodulate(Y_N1 + f * this->N_fil, Y_N2 + f * this->N, Y_N3 + f * this->N, f);
+}
+
+template <typename B, typename R, typename Q, tools::proto_max<Q> MAX, tools::proto_max_i<Q> MAX_i>
+void Modem_CPM<B,R,Q,MAX,MAX_i>
 ::_filter(const R *Y_N1, R *Y_N2, const int frame_id)
 {
 	const auto Y_real = Y_N1;
@@ -140,34 +219,51 @@ void Modem_CPM<B,R,Q,MAX>
 	const auto p_real = projection.data();
 	const auto p_imag = projection.data() + (projection.size() >> 1);
 
+	// the wave forms are processed all together in the vectorized loop: the projections on the not allowed wave forms
+	// are null (see 'generate_projection'), the corresponding outputs are set to 0
+	const auto vec_loop_size = (cpm.max_wa_id / mipp::nElReg<R>()) * mipp::nElReg<R>();
+
 	for (auto i = 0; i < n_sy_tl; i++)
-		for (auto wa = 0; wa < cpm.n_wa; wa++)
+	{
+		for (auto wa = 0; wa < vec_loop_size; wa += mipp::nElReg<R>())
 		{
-			R sum_r = (R)0;
+			auto r_sum = mipp::Reg<R>((R)0);
 			for (auto s = 0; s < cpm.s_factor; s++)
-				sum_r += Y_real[i * cpm.s_factor + s] * p_real[s * cpm.max_wa_id + cpm.allowed_wave_forms[wa]]
-				       - Y_imag[i * cpm.s_factor + s] * p_imag[s * cpm.max_wa_id + cpm.allowed_wave_forms[wa]];
+				r_sum += mipp::Reg<R>(Y_real[i * cpm.s_factor + s]) * mipp::Reg<R>(&p_real[s * cpm.max_wa_id + wa])
+				       - mipp::Reg<R>(Y_imag[i * cpm.s_factor + s]) * mipp::Reg<R>(&p_imag[s * cpm.max_wa_id + wa]);
 
-			Y_N2[i * cpm.max_wa_id + cpm.allowed_wave_forms[wa]] = sum_r;
+			r_sum.storeu(&Y_N2[i * cpm.max_wa_id + wa]);
 		}
+
+		for (auto wa = 0; wa < cpm.n_wa; wa++)
+			if (cpm.allowed_wave_forms[wa] >= vec_loop_size)
+			{
+				R sum_r = (R)0;
+				for (auto s = 0; s < cpm.s_factor; s++)
+					sum_r += Y_real[i * cpm.s_factor + s] * p_real[s * cpm.max_wa_id + cpm.allowed_wave_forms[wa]]
+					       - Y_imag[i * cpm.s_factor + s] * p_imag[s * cpm.max_wa_id + cpm.allowed_wave_forms[wa]];
+
+				Y_N2[i * cpm.max_wa_id + cpm.allowed_wave_forms[wa]] = sum_r;
+			}
+	}
 }
 
-template <typename B, typename R, typename Q, tools::proto_max<Q> MAX>
-void Modem_CPM<B,R,Q,MAX>
+template <typename B, typename R, typename Q, tools::proto_max<Q> MAX, tools::proto_max_i<Q> MAX_i>
+void Modem_CPM<B,R,Q,MAX,MAX_i>
 ::_demodulate(const Q *Y_N1, Q *Y_N2, const int frame_id)
 {
 	bcjr.decode(Y_N1, Y_N2);
 }
 
-template <typename B, typename R, typename Q, tools::proto_max<Q> MAX>
-void Modem_CPM<B,R,Q,MAX>
+template <typename B, typename R, typename Q, tools::proto_max<Q> MAX, tools::proto_max_i<Q> MAX_i>
+void Modem_CPM<B,R,Q,MAX,MAX_i>
 ::_tdemodulate(const Q *Y_N1, const Q *Y_N2, Q *Y_N3, const int frame_id)
 {
 	bcjr.decode(Y_N1, Y_N2, Y_N3);
 }
 
-template <typename B, typename R, typename Q, tools::proto_max<Q> MAX>
-void Modem_CPM<B,R,Q,MAX>
+template <typename B, typename R, typename Q, tools::proto_max<Q> MAX, tools::proto_max_i<Q> MAX_i>
+void Modem_CPM<B,R,Q,MAX,MAX_i>
 ::generate_baseband()
 {
 	if ((int)baseband.size() != (cpm.max_wa_id * cpm.s_factor * 2))
@@ -239,8 +335,8 @@ public:
 	}
 };
 
-template <typename B, typename R, typename Q, tools::proto_max<Q> MAX>
-R Modem_CPM<B,R,Q,MAX>
+template <typename B, typename R, typename Q, tools::proto_max<Q> MAX, tools::proto_max_i<Q> MAX_i>
+R Modem_CPM<B,R,Q,MAX,MAX_i>
 ::calculate_phase_response(const R t_stamp)
 {
 	if (cpm.wave_shape == "GMSK")
@@ -262,8 +358,8 @@ R Modem_CPM<B,R,Q,MAX>
 	}
 }
 
-template <typename B, typename R, typename Q, tools::proto_max<Q> MAX>
-void Modem_CPM<B,R,Q,MAX>
+template <typename B, typename R, typename Q, tools::proto_max<Q> MAX, tools::proto_max_i<Q> MAX_i>
+void Modem_CPM<B,R,Q,MAX,MAX_i>
 ::generate_projection()
 {
 	if (projection.size() != baseband.size())
@@ -285,6 +381,20 @@ void Modem_CPM<B,R,Q,MAX>
 
 		for (auto i = 0; i < (int)projection.size() ; i++)
 			projection[i] *= factor;
+
+		// null projections on the not allowed wave forms, whatever the content of the baseband
+		std::vector<bool> is_allowed(cpm.max_wa_id, false);
+		for (auto wa = 0; wa < cpm.n_wa; wa++)
+			is_allowed[cpm.allowed_wave_forms[wa]] = true;
+
+		const auto p_imag = projection.size() >> 1;
+		for (auto s = 0; s < cpm.s_factor; s++)
+			for (auto wa = 0; wa < cpm.max_wa_id; wa++)
+				if (!is_allowed[wa])
+				{
+					projection[         s * cpm.max_wa_id + wa] = (R)0;
+					projection[p_imag + s * cpm.max_wa_id + wa] = (R)0;
+				}
 	}
 	//else if(filters_type == "ORTHO_NORM")
 	//{
@@ -114,6 +114,12 @@ unsigned long long Monitor_BFER_reduction<B>
 	return cur_be;
 }
 
+template <typename B>
+void Monitor_BFER_reduction<B>
+::synchronize()
+{
+}
+
 template <typename B>
 void Monitor_BFER_reduction<B>
 ::reset()
@@ -26,6 +26,8 @@ public:
 	unsigned long long get_n_fe                   () const;
 	unsigned long long get_n_be                   () const;
 
+	// gathers the final values of the other reducers (if any) at the end of a SNR point, before the final report
+	virtual void synchronize();
 	virtual void reset();
 	virtual void clear_callbacks();
 };
@@ -10,13 +10,6 @@
 using namespace aff3ct;
 using namespace aff3ct::module;
 
-struct monitor_vals
-{
-	unsigned long long n_be;
-	unsigned long long n_fe;
-	unsigned long long n_fra;
-};
-
 void MPI_SUM_monitor_vals_func(void *in, void *inout, int *len, MPI_Datatype *datatype)
 {
 	auto    in_cvt = static_cast<monitor_vals*>(in   );
@@ -39,7 +32,11 @@ Monitor_BFER_reduction_mpi<B>
   master_thread_id(master_thread_id),
   is_fe_limit_achieved(false),
   t_last_mpi_comm(std::chrono::steady_clock::now()),
-  d_mpi_comm_frequency(d_mpi_comm_frequency)
+  d_mpi_comm_frequency(d_mpi_comm_frequency),
+  mpi_req(MPI_REQUEST_NULL),
+  is_mpi_req_pending(false),
+  mvals_send({0, 0, 0}),
+  mvals_recv({0, 0, 0})
 {
 	const std::string name = "Monitor_BFER_reduction_mpi";
 	this->set_name(name);
@@ -78,30 +75,27 @@ template <typename B>
 Monitor_BFER_reduction_mpi<B>
 ::~Monitor_BFER_reduction_mpi()
 {
+	// a pending request can't be left behind, the other processes are waiting for it
+	if (is_mpi_req_pending)
+		MPI_Wait(&mpi_req, MPI_STATUS_IGNORE);
 }
 
 template <typename B>
 bool Monitor_BFER_reduction_mpi<B>
 ::fe_limit_achieved()
 {
-	// only the master thread can do this
-	if (std::this_thread::get_id() == this->master_thread_id &&
-	    ((std::chrono::steady_clock::now() - t_last_mpi_comm) >= d_mpi_comm_frequency))
+	// only the master thread can do this, the communications are overlapped with the simulation: a reduction is
+	// posted every 'd_mpi_comm_frequency' and its result is collected later without blocking the master thread
+	if (std::this_thread::get_id() == this->master_thread_id)
 	{
-		monitor_vals mvals_recv;
-		monitor_vals mvals_send = { this->get_n_be()           - this->n_bit_errors,
-		                            this->get_n_fe()           - this->n_frame_errors,
-		                            this->get_n_analyzed_fra() - this->n_analyzed_frames };
-
-		MPI_Allreduce(&mvals_send, &mvals_recv, 1, MPI_monitor_vals, MPI_SUM_monitor_vals, MPI_COMM_WORLD);
-
-		this->n_bit_errors      = mvals_recv.n_be  - mvals_send.n_be;
-		this->n_frame_errors    = mvals_recv.n_fe  - mvals_send.n_fe;
-		this->n_analyzed_frames = mvals_recv.n_fra - mvals_send.n_fra;
-
-		t_last_mpi_comm = std::chrono::steady_clock::now();
-
-		is_fe_limit_achieved = mvals_recv.n_fe >= this->get_fe_limit();
+		if (is_mpi_req_pending)
+		{
+			if (test_reduction())
+				update_from_reduction();
+		}
+		else if (!is_fe_limit_achieved &&
+		         (std::chrono::steady_clock::now() - t_last_mpi_comm) >= d_mpi_comm_frequency)
+			post_reduction();
 	}
 
 	return is_fe_limit_achieved;
@@ -111,10 +105,79 @@ template <typename B>
 void Monitor_BFER_reduction_mpi<B>
 ::reset()
 {
+	if (is_mpi_req_pending)
+	{
+		wait_reduction();
+		update_from_reduction();
+	}
+
 	Monitor_BFER_reduction<B>::reset();
 	is_fe_limit_achieved = false;
 }
 
+template <typename B>
+void Monitor_BFER_reduction_mpi<B>
+::post_reduction()
+{
+	mvals_send = { this->get_n_be()           - this->n_bit_errors,
+	               this->get_n_fe()           - this->n_frame_errors,
+	               this->get_n_analyzed_fra() - this->n_analyzed_frames };
+
+	if (auto ret = MPI_Iallreduce(&mvals_send, &mvals_recv, 1, MPI_monitor_vals, MPI_SUM_monitor_vals,
+	                              MPI_COMM_WORLD, &mpi_req))
+	{
+		std::stringstream message;
+		message << "'MPI_Iallreduce' returned '" << ret << "' error code.";
+		throw tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	is_mpi_req_pending = true;
+	t_last_mpi_comm = std::chrono::steady_clock::now();
+}
+
+template <typename B>
+bool Monitor_BFER_reduction_mpi<B>
+::test_reduction()
+{
+	int flag = 0;
+	if (auto ret = MPI_Test(&mpi_req, &flag, MPI_STATUS_IGNORE))
+	{
+		std::stringstream message;
+		message << "'MPI_Test' returned '" << ret << "' error code.";
+		throw tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	is_mpi_req_pending = !flag;
+	return !is_mpi_req_pending;
+}
+
+template <typename B>
+void Monitor_BFER_reduction_mpi<B>
+::wait_reduction()
+{
+	if (auto ret = MPI_Wait(&mpi_req, MPI_STATUS_IGNORE))
+	{
+		std::stringstream message;
+		message << "'MPI_Wait' returned '" << ret << "' error code.";
+		throw tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	is_mpi_req_pending = false;
+}
+
+template <typename B>
+void Monitor_BFER_reduction_mpi<B>
+::update_from_reduction()
+{
+	// keep only the contribution of the other processes, the local one is read from the monitors
+	this->n_bit_errors      = mvals_recv.n_be  - mvals_send.n_be;
+	this->n_frame_errors    = mvals_recv.n_fe  - mvals_send.n_fe;
+	this->n_analyzed_frames = mvals_recv.n_fra - mvals_send.n_fra;
+
+	// all the processes see the same reduced values: the stop decision is the same everywhere without any barrier
+	is_fe_limit_achieved = mvals_recv.n_fe >= this->get_fe_limit();
+}
+
 // ==================================================================================== explicit template instantiation 
 #include "Tools/types.h"
 #ifdef MULTI_PREC
@@ -15,6 +15,13 @@ namespace aff3ct
 {
 namespace module
 {
+struct monitor_vals
+{
+	unsigned long long n_be;
+	unsigned long long n_fe;
+	unsigned long long n_fra;
+};
+
 template <typename B = int>
 class Monitor_BFER_reduction_mpi : public Monitor_BFER_reduction<B>
 {
@@ -28,6 +35,12 @@ private:
 	MPI_Datatype MPI_monitor_vals;
 	MPI_Op       MPI_SUM_monitor_vals;
 
+	// non-blocking reduction in flight (the buffers have to live until the request completes)
+	MPI_Request  mpi_req;
+	bool         is_mpi_req_pending;
+	monitor_vals mvals_send;
+	monitor_vals mvals_recv;
+
 public:
 	Monitor_BFER_reduction_mpi(const std::vector<Monitor_BFER<B>*> &monitors,
 	                           const std::thread::id master_thread_id,
@@ -37,6 +50,12 @@ public:
 	bool fe_limit_achieved();
 
 	void reset();
+
+private:
+	void post_reduction();
+	bool test_reduction();
+	void wait_reduction();
+	void update_from_reduction();
 };
 }
 }
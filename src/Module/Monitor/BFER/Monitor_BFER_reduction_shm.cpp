@@ -0,0 +1,334 @@
+#if !defined(ENABLE_MPI) && (defined(__linux__) || defined(__linux) || defined(__APPLE__))
+
+#include <cerrno>
+#include <chrono>
+#include <cstring>
+#include <sstream>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/wait.h>
+
+#include "Tools/Exception/exception.hpp"
+
+#include "Monitor_BFER_reduction_shm.hpp"
+
+using namespace aff3ct;
+using namespace aff3ct::module;
+
+static size_t monitor_shm_size(const int n_procs)
+{
+	return sizeof(monitor_shm_header) + (size_t)n_procs * sizeof(monitor_shm_slot);
+}
+
+void aff3ct::module::create_monitor_shm(const std::string &shm_name, const int n_procs)
+{
+	if (n_procs <= 0)
+	{
+		std::stringstream message;
+		message << "'n_procs' has to be greater than 0 ('n_procs' = " << n_procs << ").";
+		throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	auto fd = shm_open(shm_name.c_str(), O_CREAT | O_EXCL | O_RDWR, 0600);
+	if (fd == -1)
+	{
+		std::stringstream message;
+		message << "'shm_open' failed ('shm_name' = " << shm_name << ", 'errno' = " << std::strerror(errno) << ").";
+		throw tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	// the memory added by 'ftruncate' is filled with zeros
+	if (ftruncate(fd, (off_t)monitor_shm_size(n_procs)) == -1)
+	{
+		close(fd);
+		shm_unlink(shm_name.c_str());
+
+		std::stringstream message;
+		message << "'ftruncate' failed ('shm_name' = " << shm_name << ", 'errno' = " << std::strerror(errno) << ").";
+		throw tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	close(fd);
+}
+
+void aff3ct::module::register_monitor_shm_proc(const std::string &shm_name, const int n_procs, const int proc_rank,
+                                               const int pid)
+{
+	if (proc_rank < 0 || proc_rank >= n_procs)
+	{
+		std::stringstream message;
+		message << "'proc_rank' has to be positive and smaller than 'n_procs' ('proc_rank' = " << proc_rank
+		        << ", 'n_procs' = " << n_procs << ").";
+		throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	auto fd = shm_open(shm_name.c_str(), O_RDWR, 0600);
+	if (fd == -1)
+	{
+		std::stringstream message;
+		message << "'shm_open' failed ('shm_name' = " << shm_name << ", 'errno' = " << std::strerror(errno) << ").";
+		throw tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	const auto size = monitor_shm_size(n_procs);
+	auto ptr = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+	close(fd);
+
+	if (ptr == MAP_FAILED)
+	{
+		std::stringstream message;
+		message << "'mmap' failed ('shm_name' = " << shm_name << ", 'errno' = " << std::strerror(errno) << ").";
+		throw tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	auto slots = reinterpret_cast<monitor_shm_slot*>(static_cast<char*>(ptr) + sizeof(monitor_shm_header));
+	slots[proc_rank].pid = pid;
+
+	munmap(ptr, size);
+}
+
+void aff3ct::module::unlink_monitor_shm(const std::string &shm_name)
+{
+	shm_unlink(shm_name.c_str());
+}
+
+template <typename B>
+Monitor_BFER_reduction_shm<B>
+::Monitor_BFER_reduction_shm(const std::vector<Monitor_BFER<B>*> &monitors,
+                             const std::thread::id master_thread_id,
+                             const std::string &shm_name,
+                             const int n_procs,
+                             const int proc_rank)
+: Monitor_BFER_reduction<B>(monitors),
+  master_thread_id(master_thread_id),
+  n_procs(n_procs),
+  proc_rank(proc_rank),
+  is_fe_limit_achieved(false),
+  gen(0),
+  n_barriers(0),
+  is_synchronized(false),
+  local_be(0),
+  local_fe(0),
+  local_fra(0),
+  shm_size(monitor_shm_size(n_procs)),
+  shm_header(nullptr),
+  shm_slots(nullptr)
+{
+	const std::string name = "Monitor_BFER_reduction_shm";
+	this->set_name(name);
+
+	if (n_procs <= 0)
+	{
+		std::stringstream message;
+		message << "'n_procs' has to be greater than 0 ('n_procs' = " << n_procs << ").";
+		throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	if (proc_rank < 0 || proc_rank >= n_procs)
+	{
+		std::stringstream message;
+		message << "'proc_rank' has to be positive and smaller than 'n_procs' ('proc_rank' = " << proc_rank
+		        << ", 'n_procs' = " << n_procs << ").";
+		throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	auto fd = shm_open(shm_name.c_str(), O_RDWR, 0600);
+	if (fd == -1)
+	{
+		std::stringstream message;
+		message << "'shm_open' failed ('shm_name' = " << shm_name << ", 'errno' = " << std::strerror(errno) << ").";
+		throw tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	auto ptr = mmap(nullptr, shm_size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+	close(fd);
+
+	if (ptr == MAP_FAILED)
+	{
+		std::stringstream message;
+		message << "'mmap' failed ('shm_name' = " << shm_name << ", 'errno' = " << std::strerror(errno) << ").";
+		throw tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	shm_header = static_cast<monitor_shm_header*>(ptr);
+	shm_slots  = reinterpret_cast<monitor_shm_slot*>(static_cast<char*>(ptr) + sizeof(monitor_shm_header));
+
+	// the segment stays mapped in the processes: the name is removed as soon as all the processes attached it, so
+	// nothing is left in '/dev/shm' if a process crashes later
+	if (shm_header->n_attached.fetch_add(1) +1 == n_procs)
+		shm_unlink(shm_name.c_str());
+}
+
+template <typename B>
+Monitor_BFER_reduction_shm<B>
+::~Monitor_BFER_reduction_shm()
+{
+	if (shm_header != nullptr)
+		munmap(shm_header, shm_size);
+}
+
+template <typename B>
+bool Monitor_BFER_reduction_shm<B>
+::fe_limit_achieved()
+{
+	// only the master thread can do this
+	if (std::this_thread::get_id() == this->master_thread_id)
+	{
+		if (Monitor::is_over())
+			shm_header->stop = 1;
+		else if (shm_header->stop)
+			Monitor::stop();
+
+		publish();
+		gather();
+
+		// decide on the published values: the other processes will see at least as many frame errors
+		is_fe_limit_achieved = local_fe + this->n_frame_errors >= this->get_fe_limit();
+	}
+
+	return is_fe_limit_achieved || Monitor::is_interrupt();
+}
+
+template <typename B>
+void Monitor_BFER_reduction_shm<B>
+::synchronize()
+{
+	// the other processes can still be simulating this SNR point: publish the final values and wait for them before
+	// reading the totals
+	publish();
+	barrier();
+	gather();
+
+	is_synchronized = true;
+}
+
+template <typename B>
+void Monitor_BFER_reduction_shm<B>
+::reset()
+{
+	if (!is_synchronized)
+		synchronize();
+
+	// wait for all the processes to have read the totals before starting the next point with cleared counters
+	barrier();
+	is_synchronized = false;
+
+	Monitor_BFER_reduction<B>::reset();
+	is_fe_limit_achieved = false;
+	gen++;
+
+	auto &slot = shm_slots[proc_rank];
+	slot.n_be  = 0;
+	slot.n_fe  = 0;
+	slot.n_fra = 0;
+	slot.gen.store(gen, std::memory_order_release);
+}
+
+template <typename B>
+void Monitor_BFER_reduction_shm<B>
+::publish()
+{
+	local_be  = this->get_n_be()           - this->n_bit_errors;
+	local_fe  = this->get_n_fe()           - this->n_frame_errors;
+	local_fra = this->get_n_analyzed_fra() - this->n_analyzed_frames;
+
+	auto &slot = shm_slots[proc_rank];
+	slot.n_be  = local_be;
+	slot.n_fe  = local_fe;
+	slot.n_fra = local_fra;
+}
+
+template <typename B>
+void Monitor_BFER_reduction_shm<B>
+::gather()
+{
+	unsigned long long n_be = 0, n_fe = 0, n_fra = 0;
+	for (auto p = 0; p < n_procs; p++)
+	{
+		// the slots of the processes that did not start this SNR point yet are skipped
+		if (p == proc_rank || shm_slots[p].gen.load(std::memory_order_acquire) != gen)
+			continue;
+
+		n_be  += shm_slots[p].n_be;
+		n_fe  += shm_slots[p].n_fe;
+		n_fra += shm_slots[p].n_fra;
+	}
+
+	this->n_bit_errors      = n_be;
+	this->n_frame_errors    = n_fe;
+	this->n_analyzed_frames = n_fra;
+}
+
+template <typename B>
+void Monitor_BFER_reduction_shm<B>
+::barrier()
+{
+	if (Monitor::is_over())
+		shm_header->stop = 1;
+
+	n_barriers++;
+	shm_header->n_arrived++;
+
+	// the counter is never reset, the k-th barrier is passed when all the processes arrived k times
+	const auto n_expected = n_barriers * (unsigned long long)n_procs;
+	while (shm_header->n_arrived < n_expected && !shm_header->stop)
+	{
+		check_procs();
+		std::this_thread::sleep_for(std::chrono::milliseconds(1));
+	}
+
+	if (shm_header->stop)
+		Monitor::stop();
+}
+
+template <typename B>
+void Monitor_BFER_reduction_shm<B>
+::check_procs() const
+{
+	auto dead_rank = -1;
+
+	if (proc_rank == 0)
+	{
+		// the first process is the parent of the others: their exit status is checked without reaping them
+		for (auto p = 1; p < n_procs && dead_rank == -1; p++)
+		{
+			const auto pid = shm_slots[p].pid.load();
+			if (pid == 0)
+				continue;
+
+			siginfo_t info;
+			info.si_pid = 0;
+			if (waitid(P_PID, (id_t)pid, &info, WEXITED | WNOHANG | WNOWAIT) == 0 && info.si_pid != 0)
+				dead_rank = p;
+		}
+	}
+	else if (getppid() != (pid_t)shm_slots[0].pid.load())
+		// the process has been reparented: the first process is dead, the deaths of the other processes are reported
+		// by the first process through the stop flag
+		dead_rank = 0;
+
+	if (dead_rank != -1)
+	{
+		shm_header->stop = 1;
+
+		std::stringstream message;
+		message << "A process exited before the end of the SNR point ('dead_rank' = " << dead_rank
+		        << ", 'pid' = " << shm_slots[dead_rank].pid.load() << ").";
+		throw tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
+	}
+}
+
+// ==================================================================================== explicit template instantiation
+#include "Tools/types.h"
+#ifdef MULTI_PREC
+template class aff3ct::module::Monitor_BFER_reduction_shm<B_8>;
+template class aff3ct::module::Monitor_BFER_reduction_shm<B_16>;
+template class aff3ct::module::Monitor_BFER_reduction_shm<B_32>;
+template class aff3ct::module::Monitor_BFER_reduction_shm<B_64>;
+#else
+template class aff3ct::module::Monitor_BFER_reduction_shm<B>;
+#endif
+// ==================================================================================== explicit template instantiation
+
+#endif
@@ -0,0 +1,88 @@
+#if !defined(ENABLE_MPI) && (defined(__linux__) || defined(__linux) || defined(__APPLE__))
+
+#ifndef MONITOR_REDUCTION_SHM_HPP_
+#define MONITOR_REDUCTION_SHM_HPP_
+
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "Monitor_BFER_reduction.hpp"
+
+namespace aff3ct
+{
+namespace module
+{
+// counters of one process, 'gen' is the number of SNR points already simulated by this process
+struct monitor_shm_slot
+{
+	std::atomic<int>                pid;
+	std::atomic<unsigned long long> gen;
+	std::atomic<unsigned long long> n_be;
+	std::atomic<unsigned long long> n_fe;
+	std::atomic<unsigned long long> n_fra;
+};
+
+// shared memory segment layout: the header is followed by one slot per process
+struct monitor_shm_header
+{
+	std::atomic<int>                stop;
+	std::atomic<int>                n_attached;
+	std::atomic<unsigned long long> n_arrived;
+};
+
+// has to be called before forking the processes, the segment is zero initialized
+void create_monitor_shm(const std::string &shm_name, const int n_procs);
+// records the PID of a process (called by the first process right after each fork), the liveness of the processes is
+// checked in the barriers
+void register_monitor_shm_proc(const std::string &shm_name, const int n_procs, const int proc_rank, const int pid);
+// the segment is unlinked by the last process attaching it, this function only cleans up when a process died before
+void unlink_monitor_shm(const std::string &shm_name);
+
+template <typename B = int>
+class Monitor_BFER_reduction_shm : public Monitor_BFER_reduction<B>
+{
+private:
+	const std::thread::id master_thread_id;
+	const int             n_procs;
+	const int             proc_rank;
+	bool                  is_fe_limit_achieved;
+	unsigned long long    gen;
+	unsigned long long    n_barriers;
+	bool                  is_synchronized;
+
+	// local values of the last publication
+	unsigned long long    local_be;
+	unsigned long long    local_fe;
+	unsigned long long    local_fra;
+
+	size_t                shm_size;
+	monitor_shm_header   *shm_header;
+	monitor_shm_slot     *shm_slots;
+
+public:
+	Monitor_BFER_reduction_shm(const std::vector<Monitor_BFER<B>*> &monitors,
+	                           const std::thread::id master_thread_id,
+	                           const std::string &shm_name,
+	                           const int n_procs,
+	                           const int proc_rank);
+	virtual ~Monitor_BFER_reduction_shm();
+
+	bool fe_limit_achieved();
+
+	void synchronize();
+	void reset();
+
+private:
+	void publish();
+	void gather ();
+	void barrier();
+	void check_procs() const;
+};
+}
+}
+
+#endif /* MONITOR_REDUCTION_SHM_HPP_ */
+
+#endif
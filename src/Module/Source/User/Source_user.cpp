@@ -1,3 +1,5 @@
+#include <map>
+#include <mutex>
 #include <fstream>
 #include <sstream>
 
@@ -8,62 +10,72 @@
 using namespace aff3ct;
 using namespace aff3ct::module;
 
+// sources already read in this process: (file name, K) -> frames, the sources of the different threads share the same
+// frames instead of parsing the file again
 template <typename B>
-Source_user<B>
-::Source_user(const int K, const std::string filename, const int n_frames)
-: Source<B>(K, n_frames), source(), src_counter(0)
+static std::shared_ptr<const std::vector<std::vector<B>>> read_source(const std::string &filename, const int K)
 {
-	const std::string name = "Source_user";
-	this->set_name(name);
+	static std::map<std::pair<std::string,int>, std::weak_ptr<const std::vector<std::vector<B>>>> cache;
+	static std::mutex                                                                             cache_mutex;
 
-	if (filename.empty())
-		throw tools::invalid_argument(__FILE__, __LINE__, __func__, "'filename' should not be empty.");
+	std::lock_guard<std::mutex> lock(cache_mutex);
+
+	auto &cached = cache[std::make_pair(filename, K)];
+	if (auto source = cached.lock())
+		return source;
 
 	std::ifstream file(filename.c_str(), std::ios::in);
 
-	if (file.is_open())
+	if (!file.is_open())
+		throw tools::invalid_argument(__FILE__, __LINE__, __func__, "Can't open '" + filename + "' file.");
+
+	int n_src = 0, src_size = 0;
+
+	file >> n_src;
+	file >> src_size;
+
+	if (n_src <= 0 || src_size <= 0)
 	{
-		int n_src = 0, src_size = 0;
+		std::stringstream message;
+		message << "'n_src', and 'src_size' have to be greater than 0 ('n_src' = " << n_src
+		        << ", 'src_size' = " << src_size << ").";
+		throw tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
+	}
 
-		file >> n_src;
-		file >> src_size;
+	if (src_size != K)
+	{
+		std::stringstream message;
+		message << "The size is wrong (read: " << src_size << ", expected: " << K << ").";
+		throw tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
+	}
 
-		if (n_src <= 0 || src_size <= 0)
+	auto source = std::make_shared<std::vector<std::vector<B>>>(n_src, std::vector<B>(src_size));
+	for (auto i = 0; i < n_src; i++)
+		for (auto j = 0; j < src_size; j++)
 		{
-			std::stringstream message;
-			message << "'n_src', and 'src_size' have to be greater than 0 ('n_src' = " << n_src
-			        << ", 'src_size' = " << src_size << ").";
-			throw tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
+			int bit;
+			file >> bit;
+
+			(*source)[i][j] = bit != 0;
 		}
 
-		this->source.resize(n_src);
-		for (auto i = 0; i < n_src; i++)
-			this->source[i].resize(src_size);
+	cached = source;
+	return source;
+}
 
-		if (src_size == this->K)
-		{
-			for (auto i = 0; i < n_src; i++)
-				for (auto j = 0; j < src_size; j++)
-				{
-					int bit;
-					file >> bit;
-
-					this->source[i][j] = bit != 0;
-				}
-		}
-		else
-		{
-			file.close();
+template <typename B>
+Source_user<B>
+::Source_user(const int K, const std::string filename, const int n_frames)
+: Source<B>(K, n_frames), source(), fra_first(0), fra_step(1), n_fra_played(0), src_counter(0)
+{
+	const std::string name = "Source_user";
+	this->set_name(name);
 
-			std::stringstream message;
-			message << "The size is wrong (read: " << src_size << ", expected: " << this->K << ").";
-			throw tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
-		}
+	if (filename.empty())
+		throw tools::invalid_argument(__FILE__, __LINE__, __func__, "'filename' should not be empty.");
 
-		file.close();
-	}
-	else
-		throw tools::invalid_argument(__FILE__, __LINE__, __func__, "Can't open '" + filename + "' file.");
+	this->source       = read_source<B>(filename, K);
+	this->n_fra_played = (int)this->source->size();
 }
 
 template <typename B>
@@ -72,15 +84,42 @@ Source_user<B>
 {
 }
 
+template <typename B>
+void Source_user<B>
+::select_frames(const int first, const int step)
+{
+	if (first < 0 || step <= 0)
+	{
+		std::stringstream message;
+		message << "'first' has to be positive and 'step' has to be greater than 0 ('first' = " << first
+		        << ", 'step' = " << step << ").";
+		throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	const auto n_fra_file = (int)this->source->size();
+	if (first < n_fra_file)
+	{
+		this->fra_first    = first;
+		this->n_fra_played = (n_fra_file - first + step -1) / step;
+	}
+	else // less frames than subsets: play a single frame
+	{
+		this->fra_first    = first % n_fra_file;
+		this->n_fra_played = 1;
+	}
+
+	this->fra_step    = step;
+	this->src_counter = 0;
+}
+
 template <typename B>
 void Source_user<B>
 ::_generate(B *U_K, const int frame_id)
 {
-	std::copy(this->source[this->src_counter].begin(),
-	          this->source[this->src_counter].end  (),
-	          U_K);
+	const auto &frame = (*this->source)[this->fra_first + this->src_counter * this->fra_step];
+	std::copy(frame.begin(), frame.end(), U_K);
 
-	this->src_counter = (this->src_counter +1) % (int)this->source.size();
+	this->src_counter = (this->src_counter +1) % this->n_fra_played;
 }
 
 // ==================================================================================== explicit template instantiation 
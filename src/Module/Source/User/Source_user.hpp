@@ -2,6 +2,7 @@
 #define SOURCE_USER_HPP_
 
 #include <string>
+#include <memory>
 #include <random>
 #include <vector>
 
@@ -15,13 +16,26 @@ template <typename B>
 class Source_user : public Source<B>
 {
 private:
-	std::vector<std::vector<B>> source;
+	std::shared_ptr<const std::vector<std::vector<B>>> source; // frames of the file, shared by the sources of a file
+
+	int fra_first;    // first frame played
+	int fra_step;     // gap between two played frames
+	int n_fra_played; // number of played frames
 	int src_counter;
 
 public:
 	Source_user(const int K, std::string filename, const int n_frames = 1);
 	virtual ~Source_user();
 
+	/*!
+	 * \brief Plays only the frames 'first', 'first + step', 'first + 2 * step', etc. of the file (allows to split the
+	 *        frames between several sources).
+	 *
+	 * \param first: the first frame to play.
+	 * \param step:  the gap between two played frames.
+	 */
+	void select_frames(const int first, const int step);
+
 protected:
 	void _generate(B *U_K, const int frame_id);
 };
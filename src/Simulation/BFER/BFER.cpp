@@ -8,12 +8,15 @@
 #include "Tools/general_utils.h"
 #include "Tools/system_functions.h"
 #include "Tools/Display/bash_tools.h"
+#include "Tools/Threads/thread_pinning.h"
 #include "Tools/Exception/exception.hpp"
 #include "Tools/Display/Statistics/Statistics.hpp"
 #include "Tools/Display/Terminal/BFER/Terminal_BFER.hpp"
 
 #ifdef ENABLE_MPI
 #include "Module/Monitor/BFER/Monitor_BFER_reduction_mpi.hpp"
+#elif defined(__linux__) || defined(__linux) || defined(__APPLE__)
+#include "Module/Monitor/BFER/Monitor_BFER_reduction_shm.hpp"
 #endif
 
 #include "Factory/Module/Monitor/Monitor.hpp"
@@ -54,6 +57,16 @@ BFER<B,R,Q>
 		throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
 	}
 
+#ifdef ENABLE_MPI
+	const auto first_cpu = 0;
+#else
+	// the forked processes use the next cores
+	const auto first_cpu = params_BFER.proc_rank * params_BFER.n_threads;
+#endif
+	const auto cpus = tools::get_cpu_placement(params_BFER.thread_pin, first_cpu + params_BFER.n_threads);
+	if (!cpus.empty())
+		thread_cpus.assign(cpus.begin() + first_cpu, cpus.end());
+
 	if (params_BFER.err_track_enable)
 	{
 		for (auto tid = 0; tid < params_BFER.n_threads; tid++)
@@ -79,6 +92,16 @@ BFER<B,R,Q>
 	                                                              std::this_thread::get_id(),
 	                                                              params_BFER.mpi_comm_freq);
 #else
+#if defined(__linux__) || defined(__linux) || defined(__APPLE__)
+	if (params_BFER.n_procs > 1)
+		// build a monitor to compute BER/FER (reduce the other monitors and the other processes)
+		this->monitor_red = new module::Monitor_BFER_reduction_shm<B>(this->monitor,
+		                                                              std::this_thread::get_id(),
+		                                                              params_BFER.shm_name,
+		                                                              params_BFER.n_procs,
+		                                                              params_BFER.proc_rank);
+	else
+#endif
 	// build a monitor to compute BER/FER (reduce the other monitors)
 	this->monitor_red = new module::Monitor_BFER_reduction<B>(this->monitor);
 #endif
@@ -195,7 +218,7 @@ void BFER<B,R,Q>
 		    (params_BFER.statistics && !params_BFER.debug)) && params_BFER.mpi_rank == 0)
 #else
 		if (((!params_BFER.ter->disabled && snr == params_BFER.snr_min && !params_BFER.debug) ||
-		    (params_BFER.statistics && !params_BFER.debug)))
+		    (params_BFER.statistics && !params_BFER.debug)) && params_BFER.proc_rank == 0)
 #endif
 			terminal->legend(std::cout);
 
@@ -204,10 +227,20 @@ void BFER<B,R,Q>
 		if (!params_BFER.ter->disabled && params_BFER.ter->frequency != std::chrono::nanoseconds(0) && !params_BFER.debug
 		    && params_BFER.mpi_rank == 0)
 #else
-		if (!params_BFER.ter->disabled && params_BFER.ter->frequency != std::chrono::nanoseconds(0) && !params_BFER.debug)
+		if (!params_BFER.ter->disabled && params_BFER.ter->frequency != std::chrono::nanoseconds(0) && !params_BFER.debug
+		    && params_BFER.proc_rank == 0)
 #endif
 			terminal->start_temp_report(params_BFER.ter->frequency);
 
+		if (this->dumper_red != nullptr)
+		{
+			std::stringstream s_snr_b;
+			s_snr_b << std::setprecision(2) << std::fixed << snr_b;
+
+			// the erroneous frames are written to the files during the simulation by a background thread
+			this->dumper_red->open(params_BFER.err_track_path + "_" + s_snr_b.str());
+		}
+
 		try
 		{
 			this->_launch();
@@ -221,10 +254,13 @@ void BFER<B,R,Q>
 			this->simu_error = true;
 		}
 
+		// the final report has to display the values of all the processes
+		this->monitor_red->synchronize();
+
 #ifdef ENABLE_MPI
 		if (!params_BFER.ter->disabled && terminal != nullptr && !this->simu_error && params_BFER.mpi_rank == 0)
 #else
-		if (!params_BFER.ter->disabled && terminal != nullptr && !this->simu_error)
+		if (!params_BFER.ter->disabled && terminal != nullptr && !this->simu_error && params_BFER.proc_rank == 0)
 #endif
 		{
 			if (params_BFER.debug)
@@ -249,14 +285,9 @@ void BFER<B,R,Q>
 			}
 		}
 
-		if (this->dumper_red != nullptr && !this->simu_error)
-		{
-			std::stringstream s_snr_b;
-			s_snr_b << std::setprecision(2) << std::fixed << snr_b;
-
-			this->dumper_red->dump(params_BFER.err_track_path + "_" + s_snr_b.str());
-			this->dumper_red->clear();
-		}
+		// nothing is dumped when the simulation failed (the files would contain an incomplete set of frames)
+		if (this->dumper_red != nullptr)
+			this->dumper_red->close(this->simu_error);
 
 		if (!params_BFER.err_track_revert && !module::Monitor::is_interrupt() &&
 		    this->monitor_red->get_n_fe() < this->monitor_red->get_fe_limit() &&
@@ -297,12 +328,22 @@ tools::Terminal_BFER<B>* BFER<B,R,Q>
 	return factory::Terminal_BFER::build<B>(*params_BFER.ter, *this->monitor_red);
 }
 
+template <typename B, typename R, typename Q>
+void BFER<B,R,Q>
+::pin_thread(const int tid)
+{
+	if (!thread_cpus.empty())
+		tools::pin_thread(thread_cpus[tid]);
+}
+
 template <typename B, typename R, typename Q>
 void BFER<B,R,Q>
 ::start_thread_build_comm_chain(BFER<B,R,Q> *simu, const int tid)
 {
 	try
 	{
+		// the modules are allocated (and first touched) on the core that will run them
+		simu->pin_thread(tid);
 		simu->__build_communication_chain(tid);
 
 		if (simu->params_BFER.err_track_enable)
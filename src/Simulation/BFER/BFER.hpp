@@ -57,6 +57,9 @@ protected:
 	// terminal (for the output of the code)
 	tools::Terminal_BFER<B> *terminal;
 
+	// CPU core of each thread (empty if the threads are not pinned)
+	std::vector<int> thread_cpus;
+
 public:
 	explicit BFER(const factory::BFER::parameters& params_BFER);
 	virtual ~BFER();
@@ -71,6 +74,8 @@ protected:
 	module::Monitor_BFER <B>* build_monitor (const int tid = 0);
 	tools ::Terminal_BFER<B>* build_terminal(                 );
 
+	void pin_thread(const int tid = 0);
+
 private:
 	static void start_thread_build_comm_chain(BFER<B,R,Q> *simu, const int tid);
 };
@@ -1,5 +1,10 @@
 #include "Tools/Exception/exception.hpp"
 
+#include "Module/Source/User/Source_user.hpp"
+#include "Module/Encoder/User/Encoder_user.hpp"
+#include "Module/Channel/User/Channel_user.hpp"
+#include "Tools/Interleaver/User/Interleaver_core_user.hpp"
+
 #include "Factory/Module/Coset/Coset.hpp"
 
 #include "BFER_ite.hpp"
@@ -87,6 +92,17 @@ void BFER_ite<B,R,Q>
 
 	this->monitor[tid]->add_handler_check(std::bind(&module::Codec_SISO_SIHO<B,Q>::reset, codec[tid]));
 
+	if (this->params_BFER_ite.err_track_revert)
+	{
+		// split the dumped frames between the threads: the thread 'tid' plays the frames 'tid', 'tid + n_threads', ...
+		const auto n_thr = this->params_BFER_ite.n_threads;
+		if (auto src = dynamic_cast<module::Source_user <B>*>(source [tid]              )) src->select_frames(tid, n_thr);
+		if (auto enc = dynamic_cast<module::Encoder_user<B>*>(codec  [tid]->get_encoder())) enc->select_frames(tid, n_thr);
+		if (auto chn = dynamic_cast<module::Channel_user<R>*>(channel[tid]              )) chn->select_frames(tid, n_thr);
+		if (auto itl = dynamic_cast<tools::Interleaver_core_user<>*>(interleaver_core[tid]))
+			itl->select_frames(tid, n_thr);
+	}
+
 	interleaver_core[tid]->init();
 	if (interleaver_core[tid]->is_uniform())
 		this->monitor[tid]->add_handler_check(std::bind(&tools::Interleaver_core<>::refresh,
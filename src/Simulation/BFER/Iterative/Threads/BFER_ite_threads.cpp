@@ -7,6 +7,7 @@
 #include "Tools/Exception/exception.hpp"
 #include "Tools/Display/Frame_trace/Frame_trace.hpp"
 #include "Tools/Display/bash_tools.h"
+#include "Tools/Algo/Predicate_ite.hpp"
 
 #include "Factory/Tools/Display/Terminal/BFER/Terminal_BFER.hpp"
 
@@ -18,21 +19,18 @@ using namespace aff3ct::simulation;
 template <typename B, typename R, typename Q>
 BFER_ite_threads<B,R,Q>
 ::BFER_ite_threads(const factory::BFER_ite::parameters &params_BFER_ite)
-: BFER_ite<B,R,Q>(params_BFER_ite)
+: BFER_ite<B,R,Q>(params_BFER_ite),
+  graph(params_BFER_ite.n_threads, nullptr)
 {
-	if (this->params_BFER_ite.err_track_revert)
-	{
-		if (this->params_BFER_ite.n_threads != 1)
-			std::clog << tools::format_warning("Multi-threading detected with error tracking revert feature! "
-			                                   "Each thread will play the same frames. Please run with one thread.")
-			          << std::endl;
-	}
 }
 
 template <typename B, typename R, typename Q>
 BFER_ite_threads<B,R,Q>
 ::~BFER_ite_threads()
 {
+	for (auto g : graph)
+		if (g != nullptr)
+			delete g;
 }
 
 template <typename B, typename R, typename Q>
@@ -63,7 +61,9 @@ void BFER_ite_threads<B,R,Q>
 {
 	try
 	{
+		simu->pin_thread(tid);
 		simu->sockets_binding(tid);
+		simu->build_graph    (tid);
 		simu->simulation_loop(tid);
 	}
 	catch (std::exception const& e)
@@ -225,8 +225,6 @@ void BFER_ite_threads<B,R,Q>
 	{
 		if (!mdm.is_demodulator())
 			mdm[mdm::tsk::tdemodulate_wg][mdm::sck::tdemodulate_wg::Y_N3](qnt[qnt::tsk::process][qnt::sck::process::Y_N2]);
-		else // output socket binding (trick to avoid runtime re-binding)
-			mdm[mdm::tsk::tdemodulate_wg][mdm::sck::tdemodulate_wg::Y_N3](mdm[mdm::tsk::demodulate][mdm::sck::demodulate::Y_N2]);
 
 		mdm[mdm::tsk::tdemodulate_wg][mdm::sck::tdemodulate_wg::Y_N1](qnt[qnt::tsk::process     ][qnt::sck::process     ::Y_N2]);
 		mdm[mdm::tsk::tdemodulate_wg][mdm::sck::tdemodulate_wg::H_N ](chn[chn::tsk::add_noise_wg][chn::sck::add_noise_wg::H_N ]);
@@ -236,18 +234,14 @@ void BFER_ite_threads<B,R,Q>
 	{
 		if (!mdm.is_demodulator())
 			mdm[mdm::tsk::tdemodulate][mdm::sck::tdemodulate::Y_N3](qnt[qnt::tsk::process][qnt::sck::process::Y_N2]);
-		else // output socket binding (trick to avoid runtime re-binding)
-			mdm[mdm::tsk::tdemodulate][mdm::sck::tdemodulate::Y_N3](mdm[mdm::tsk::demodulate][mdm::sck::demodulate::Y_N2]);
 
 		mdm[mdm::tsk::tdemodulate][mdm::sck::tdemodulate::Y_N1](qnt[qnt::tsk::process   ][qnt::sck::process   ::Y_N2]);
 		mdm[mdm::tsk::tdemodulate][mdm::sck::tdemodulate::Y_N2](itl[itl::tsk::interleave][itl::sck::interleave::itl ]);
 	}
 
 	// ------------------------------------------------------------------------------------------------- deinterleaving
-	if (this->params_BFER_ite.chn->type.find("RAYLEIGH") != std::string::npos)
-		itl[itl::tsk::deinterleave][itl::sck::deinterleave::itl](mdm[mdm::tsk::tdemodulate_wg][mdm::sck::tdemodulate_wg::Y_N3]);
-	else
-		itl[itl::tsk::deinterleave][itl::sck::deinterleave::itl](mdm[mdm::tsk::tdemodulate   ][mdm::sck::tdemodulate   ::Y_N3]);
+	// the input of the deinterleaver is bound at runtime by the funnel of the graph (demodulation or turbo
+	// demodulation output)
 
 	// ----------------------------------------------------------------------------------------------------------------
 	// --------------------------------------------------------------------------------- end of turbo demodulation loop
@@ -303,7 +297,7 @@ void BFER_ite_threads<B,R,Q>
 
 template <typename B, typename R, typename Q>
 void BFER_ite_threads<B,R,Q>
-::simulation_loop(const int tid)
+::build_graph(const int tid)
 {
 	auto &source          = *this->source         [tid];
 	auto &crc             = *this->crc            [tid];
@@ -321,6 +315,127 @@ void BFER_ite_threads<B,R,Q>
 	auto &decoder_siso = *codec.get_decoder_siso();
 	auto &decoder_siho = *codec.get_decoder_siho();
 
+	using namespace module;
+
+	const auto rayleigh = this->params_BFER_ite.chn->type.find("RAYLEIGH") != std::string::npos;
+
+	if (this->graph[tid] != nullptr)
+		delete this->graph[tid];
+	this->graph[tid] = new tools::Graph();
+	auto &g = *this->graph[tid];
+
+	auto &chain = g.create<tools::Sequence>();
+	g.set_root(chain);
+
+	if (this->params_BFER_ite.src->type != "AZCW")
+	{
+		chain.add(source[src::tsk::generate]);
+		if (this->params_BFER_ite.crc->type != "NO")
+			chain.add(crc[crc::tsk::build]);
+		if (this->params_BFER_ite.cdc->enc->type != "NO")
+			chain.add(encoder[enc::tsk::encode]);
+
+		chain.add(interleaver_bit[itl::tsk::interleave]);
+		chain.add(modem          [mdm::tsk::modulate  ]);
+	}
+
+	if (this->params_BFER_ite.chn->type != "NO")
+		chain.add(channel[rayleigh ? chn::tsk::add_noise_wg : chn::tsk::add_noise]);
+	if (modem.is_filter())
+		chain.add(modem[mdm::tsk::filter]);
+	if (this->params_BFER_ite.qnt->type != "NO")
+		chain.add(quantizer[qnt::tsk::process]);
+	if (modem.is_demodulator())
+		chain.add(modem[rayleigh ? mdm::tsk::demodulate_wg : mdm::tsk::demodulate]);
+
+	// ----------------------------------------------------------------------------------------------------------------
+	// ---------------------------------------------------------------------------------------- turbo demodulation loop
+	// ----------------------------------------------------------------------------------------------------------------
+	auto &ite_body = g.create<tools::Sequence>();
+
+	// ------------------------------------------------------------------------------------------------------- decoding
+	if (this->params_BFER_ite.coset)
+	{
+		ite_body.add(coset_real  [cst::tsk::apply      ]);
+		ite_body.add(decoder_siso[dec::tsk::decode_siso]);
+		ite_body.add(coset_real  [cst::tsk::apply      ]);
+	}
+	else
+	{
+		ite_body.add(decoder_siso[dec::tsk::decode_siso]);
+	}
+
+	// --------------------------------------------------------------------------------------------------- interleaving
+	ite_body.add(interleaver_llr[itl::tsk::interleave]);
+
+	// --------------------------------------------------------------------------------------------------- demodulation
+	if (modem.is_demodulator())
+		ite_body.add(modem[rayleigh ? mdm::tsk::tdemodulate_wg : mdm::tsk::tdemodulate]);
+
+	// ------------------------------------------------------------------------------------------------- deinterleaving
+	// the first pass deinterleaves the demodulator output, the next ones execute an iteration and deinterleave the
+	// turbo demodulator output
+	auto &first_pass = g.create<tools::Predicate_node>(g.create_predicate<tools::Predicate_ite>(1));
+	auto &no_ite     = g.create<tools::Sequence>();
+	auto &router     = g.create<tools::Router>(first_pass, no_ite, ite_body);
+	auto &funnel     = g.create<tools::Funnel>(router);
+
+	auto &dmd_out = rayleigh ? modem[mdm::tsk::demodulate_wg ][mdm::sck::demodulate_wg ::Y_N2]
+	                         : modem[mdm::tsk::demodulate    ][mdm::sck::demodulate    ::Y_N2];
+	auto &tdm_out = rayleigh ? modem[mdm::tsk::tdemodulate_wg][mdm::sck::tdemodulate_wg::Y_N3]
+	                         : modem[mdm::tsk::tdemodulate   ][mdm::sck::tdemodulate   ::Y_N3];
+	funnel.add(interleaver_llr[itl::tsk::deinterleave][itl::sck::deinterleave::itl], dmd_out, tdm_out);
+
+	auto &pass = g.create<tools::Sequence>();
+	pass.add(router);
+	pass.add(funnel);
+	pass.add(interleaver_llr[itl::tsk::deinterleave]);
+
+	// --------------------------------------------------------------------------------------------------- CRC checking
+	tools::Sequence *crc_check = nullptr;
+	if (this->params_BFER_ite.crc->type != "NO")
+	{
+		crc_check = &g.create<tools::Sequence>();
+		crc_check->add(codec[cdc::tsk::extract_sys_bit]);
+		crc_check->add(crc  [crc::tsk::check          ]);
+	}
+
+	// one more pass than the number of iterations: the CRC is checked from the pass 'crc_start +1'
+	chain.add(g.create<tools::Loop>(pass, this->params_BFER_ite.n_ite +1, crc_check,
+	                                this->params_BFER_ite.crc_start +1));
+
+	// ----------------------------------------------------------------------------------------------------------------
+	// --------------------------------------------------------------------------------- end of turbo demodulation loop
+	// ----------------------------------------------------------------------------------------------------------------
+
+	if (this->params_BFER_ite.coset)
+		chain.add(coset_real[cst::tsk::apply]);
+
+	if (this->params_BFER_ite.coded_monitoring)
+	{
+		chain.add(decoder_siho[dec::tsk::decode_siho_cw]);
+		if (this->params_BFER_ite.coset)
+			chain.add(coset_bit[cst::tsk::apply]);
+	}
+	else
+	{
+		chain.add(decoder_siho[dec::tsk::decode_siho]);
+		if (this->params_BFER_ite.coset)
+			chain.add(coset_bit[cst::tsk::apply]);
+		if (this->params_BFER_ite.crc->type != "NO")
+			chain.add(crc[crc::tsk::extract]);
+	}
+
+	chain.add(monitor[mnt::tsk::check_errors]);
+}
+
+template <typename B, typename R, typename Q>
+void BFER_ite_threads<B,R,Q>
+::simulation_loop(const int tid)
+{
+	auto &monitor = *this->monitor[tid];
+	auto &graph   = *this->graph  [tid];
+
 	using namespace module;
 	using namespace std::chrono;
 	auto t_snr = steady_clock::now();
@@ -341,121 +456,7 @@ void BFER_ite_threads<B,R,Q>
 			std::cout << "#" << std::endl;
 		}
 
-		if (this->params_BFER_ite.src->type != "AZCW")
-		{
-			source[src::tsk::generate].exec();
-			if (this->params_BFER_ite.crc->type != "NO")
-				crc[crc::tsk::build].exec();
-			if (this->params_BFER_ite.cdc->enc->type != "NO")
-				encoder[enc::tsk::encode].exec();
-
-			interleaver_bit[itl::tsk::interleave].exec();
-			modem          [mdm::tsk::modulate  ].exec();
-		}
-
-		if (this->params_BFER_ite.chn->type.find("RAYLEIGH") != std::string::npos)
-		{
-			if (this->params_BFER_ite.chn->type != "NO")
-				channel[chn::tsk::add_noise_wg].exec();
-			if (modem.is_filter())
-				modem [mdm::tsk::filter].exec();
-			if (this->params_BFER_ite.qnt->type != "NO")
-				quantizer[qnt::tsk::process].exec();
-			if (modem.is_demodulator())
-				modem[mdm::tsk::demodulate_wg].exec();
-		}
-		else
-		{
-			if (this->params_BFER_ite.chn->type != "NO")
-				channel[chn::tsk::add_noise].exec();
-			if (modem.is_filter())
-				modem[mdm::tsk::filter].exec();
-			if (this->params_BFER_ite.qnt->type != "NO")
-				quantizer[qnt::tsk::process].exec();
-			if (modem.is_demodulator())
-				modem[mdm::tsk::demodulate].exec();
-		}
-
-		interleaver_llr[itl::tsk::deinterleave].exec();
-
-		// ------------------------------------------------------------------------------------------------------------
-		// ------------------------------------------------------------------------------------ turbo demodulation loop
-		// ------------------------------------------------------------------------------------------------------------
-		for (auto ite = 1; ite <= this->params_BFER_ite.n_ite; ite++)
-		{
-			// ------------------------------------------------------------------------------------------- CRC checking
-			if (this->params_BFER_ite.crc->type != "NO" && ite >= this->params_BFER_ite.crc_start)
-			{
-				codec[cdc::tsk::extract_sys_bit].exec();
-				if (crc[crc::tsk::check].exec())
-					break;
-			}
-
-			// ----------------------------------------------------------------------------------------------- decoding
-			if (this->params_BFER_ite.coset)
-			{
-				coset_real  [cst::tsk::apply      ].exec();
-				decoder_siso[dec::tsk::decode_siso].exec();
-				coset_real  [cst::tsk::apply      ].exec();
-			}
-			else
-			{
-				decoder_siso[dec::tsk::decode_siso].exec();
-			}
-
-			// ------------------------------------------------------------------------------------------- interleaving
-			interleaver_llr[itl::tsk::interleave].exec();
-
-			// ------------------------------------------------------------------------------------------- demodulation
-			if (this->params_BFER_ite.chn->type.find("RAYLEIGH") != std::string::npos)
-			{
-				if (modem.is_demodulator())
-					modem[mdm::tsk::tdemodulate_wg].exec();
-			}
-			else
-			{
-				if (modem.is_demodulator())
-					modem[mdm::tsk::tdemodulate].exec();
-			}
-
-			// ----------------------------------------------------------------------------------------- deinterleaving
-			interleaver_llr[itl::tsk::deinterleave].exec();
-		}
-
-		if (this->params_BFER_ite.coset)
-		{
-			coset_real[cst::tsk::apply].exec();
-
-			if (this->params_BFER_ite.coded_monitoring)
-			{
-				decoder_siho[dec::tsk::decode_siho_cw].exec();
-				coset_bit   [cst::tsk::apply         ].exec();
-			}
-			else
-			{
-				decoder_siho[dec::tsk::decode_siho].exec();
-				coset_bit   [cst::tsk::apply      ].exec();
-
-				if (this->params_BFER_ite.crc->type != "NO")
-					crc[crc::tsk::extract].exec();
-			}
-		}
-		else
-		{
-			if (this->params_BFER_ite.coded_monitoring)
-			{
-				decoder_siho[dec::tsk::decode_siho_cw].exec();
-			}
-			else
-			{
-				decoder_siho[dec::tsk::decode_siho].exec();
-
-				if (this->params_BFER_ite.crc->type != "NO")
-					crc[crc::tsk::extract].exec();
-			}
-		}
-
-		monitor[mnt::tsk::check_errors].exec();
+		graph.exec();
 	}
 }
 
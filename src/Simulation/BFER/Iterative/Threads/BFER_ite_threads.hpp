@@ -1,6 +1,10 @@
 #ifndef SIMULATION_BFER_ITE_THREADS_HPP_
 #define SIMULATION_BFER_ITE_THREADS_HPP_
 
+#include <vector>
+
+#include "Tools/Dataflow/Graph.hpp"
+
 #include "../BFER_ite.hpp"
 
 namespace aff3ct
@@ -10,6 +14,9 @@ namespace simulation
 template <typename B = int, typename R = float, typename Q = R>
 class BFER_ite_threads : public BFER_ite<B,R,Q>
 {
+protected:
+	std::vector<tools::Graph*> graph; // communication chain of each thread
+
 public:
 	explicit BFER_ite_threads(const factory::BFER_ite::parameters &params_BFER_ite);
 	virtual ~BFER_ite_threads();
@@ -19,6 +26,7 @@ protected:
 
 private:
 	void sockets_binding(const int tid = 0);
+	void build_graph    (const int tid = 0);
 	void simulation_loop(const int tid = 0);
 
 	static void start_thread(BFER_ite_threads<B,R,Q> *simu, const int tid = 0);
@@ -1,5 +1,10 @@
 #include "Tools/Exception/exception.hpp"
 
+#include "Module/Source/User/Source_user.hpp"
+#include "Module/Encoder/User/Encoder_user.hpp"
+#include "Module/Channel/User/Channel_user.hpp"
+#include "Tools/Interleaver/User/Interleaver_core_user.hpp"
+
 #include "Factory/Module/Coset/Coset.hpp"
 
 #include "BFER_std.hpp"
@@ -72,9 +77,21 @@ void BFER_std<B,R,Q>
 
 	this->monitor[tid]->add_handler_check(std::bind(&module::Codec_SIHO<B,Q>::reset, codec[tid]));
 
+	if (this->params_BFER_std.err_track_revert)
+	{
+		// split the dumped frames between the threads: the thread 'tid' plays the frames 'tid', 'tid + n_threads', ...
+		const auto n_thr = this->params_BFER_std.n_threads;
+		if (auto src = dynamic_cast<module::Source_user <B>*>(source [tid]              )) src->select_frames(tid, n_thr);
+		if (auto enc = dynamic_cast<module::Encoder_user<B>*>(codec  [tid]->get_encoder())) enc->select_frames(tid, n_thr);
+		if (auto chn = dynamic_cast<module::Channel_user<R>*>(channel[tid]              )) chn->select_frames(tid, n_thr);
+	}
+
 	try
 	{
 		auto *interleaver = codec[tid]->get_interleaver(); // can raise an exceptions
+		if (this->params_BFER_std.err_track_revert)
+			if (auto itl = dynamic_cast<tools::Interleaver_core_user<>*>(interleaver))
+				itl->select_frames(tid, this->params_BFER_std.n_threads);
 		interleaver->init();
 		if (interleaver->is_uniform())
 			this->monitor[tid]->add_handler_check(std::bind(&tools::Interleaver_core<>::refresh, interleaver));
@@ -1,9 +1,13 @@
+#include <cmath>
+#include <limits>
 #include <cstring>
 #include <string>
 #include <vector>
 #include <chrono>
 #include <thread>
 
+#include "Tools/general_utils.h"
+#include "Tools/system_functions.h"
 #include "Tools/Exception/exception.hpp"
 #include "Tools/Display/Frame_trace/Frame_trace.hpp"
 #include "Tools/Display/bash_tools.h"
@@ -18,14 +22,42 @@ using namespace aff3ct::simulation;
 template <typename B, typename R, typename Q>
 BFER_std_threads<B,R,Q>
 ::BFER_std_threads(const factory::BFER_std::parameters &params_BFER_std)
-: BFER_std<B,R,Q>(params_BFER_std)
+: BFER_std<B,R,Q>(params_BFER_std),
+  n_activated_pts(0),
+  n_running_workers(0)
 {
-	if (this->params_BFER_std.err_track_revert)
+	if (this->params_BFER_std.snr_par > 1)
 	{
-		if (this->params_BFER_std.n_threads != 1)
-			std::clog << tools::format_warning("Multi-threading detected with error tracking revert feature! "
-			                                   "Each thread will play the same frames. Please run with one thread.")
-			          << std::endl;
+		const auto bit_rate = (float)this->params_BFER_std.src->K / (float)this->params_BFER_std.cdc->N;
+		for (auto snr = this->params_BFER_std.snr_min; snr <= this->params_BFER_std.snr_max;
+		     snr += this->params_BFER_std.snr_step)
+		{
+			float snr_s, snr_b;
+			if (this->params_BFER_std.snr_type == "EB")
+			{
+				snr_b = snr;
+				snr_s = tools::ebn0_to_esn0(snr_b, bit_rate, this->params_BFER_std.mdm->bps);
+			}
+			else // if (this->params_BFER_std.snr_type == "ES")
+			{
+				snr_s = snr;
+				snr_b = tools::esn0_to_ebn0(snr_s, bit_rate, this->params_BFER_std.mdm->bps);
+			}
+
+			snr_pts  .push_back(snr  );
+			snr_s_pts.push_back(snr_s);
+			snr_b_pts.push_back(snr_b);
+			sigma_pts.push_back(tools::esn0_to_sigma(snr_s, this->params_BFER_std.mdm->upf));
+		}
+
+		const auto n_pts = snr_pts.size();
+		monitor_pts    .resize(n_pts, std::vector<module::Monitor_BFER<B>*>(params_BFER_std.n_threads, nullptr));
+		monitor_red_pts.resize(n_pts, nullptr);
+		terminal_pts   .resize(n_pts, nullptr);
+		t_start_pts    .resize(n_pts);
+		n_workers_pts  .resize(n_pts, 0);
+		active_pts     .resize(n_pts, false);
+		done_pts       .resize(n_pts, false);
 	}
 }
 
@@ -33,6 +65,45 @@ template <typename B, typename R, typename Q>
 BFER_std_threads<B,R,Q>
 ::~BFER_std_threads()
 {
+	for (auto p = 0; p < (int)snr_pts.size(); p++)
+	{
+		if (terminal_pts   [p] != nullptr) { delete terminal_pts   [p]; terminal_pts   [p] = nullptr; }
+		if (monitor_red_pts[p] != nullptr) { delete monitor_red_pts[p]; monitor_red_pts[p] = nullptr; }
+		for (auto tid = 0; tid < this->params_BFER_std.n_threads; tid++)
+			if (monitor_pts[p][tid] != nullptr) { delete monitor_pts[p][tid]; monitor_pts[p][tid] = nullptr; }
+	}
+}
+
+template <typename B, typename R, typename Q>
+void BFER_std_threads<B,R,Q>
+::__build_communication_chain(const int tid)
+{
+	BFER_std<B,R,Q>::__build_communication_chain(tid);
+
+	// each SNR point has its own monitors, they trigger the same handlers than the monitor of the thread
+	for (auto p = 0; p < (int)snr_pts.size(); p++)
+	{
+		monitor_pts[p][tid] = this->build_monitor(tid);
+		monitor_pts[p][tid]->add_handler_check(std::bind(&module::Codec_SIHO<B,Q>::reset, this->codec[tid]));
+
+		try
+		{
+			auto *interleaver = this->codec[tid]->get_interleaver(); // can raise an exceptions
+			if (interleaver->is_uniform())
+				monitor_pts[p][tid]->add_handler_check(std::bind(&tools::Interleaver_core<>::refresh, interleaver));
+		}
+		catch (const std::exception&) { /* do nothing if there is no interleaver */ }
+	}
+}
+
+template <typename B, typename R, typename Q>
+void BFER_std_threads<B,R,Q>
+::launch()
+{
+	if (this->params_BFER_std.snr_par > 1)
+		this->launch_concurrent();
+	else
+		BFER_std<B,R,Q>::launch();
 }
 
 template <typename B, typename R, typename Q>
@@ -63,6 +134,7 @@ void BFER_std_threads<B,R,Q>
 {
 	try
 	{
+		simu->pin_thread(tid);
 		simu->sockets_binding(tid);
 		simu->simulation_loop(tid);
 	}
@@ -231,11 +303,34 @@ void BFER_std_threads<B,R,Q>
 		mnt[mnt::tsk::check_errors][mnt::sck::check_errors::U](src[src::tsk::generate][src::sck::generate::U_K ]);
 		mnt[mnt::tsk::check_errors][mnt::sck::check_errors::V](crc[crc::tsk::extract ][crc::sck::extract ::V_K2]);
 	}
+
+	// the monitors of the concurrent SNR points read the same data than the monitor of the thread
+	for (auto p = 0; p < (int)snr_pts.size(); p++)
+	{
+		auto &mnt_pt = *this->monitor_pts[p][tid];
+		mnt_pt[mnt::tsk::check_errors][mnt::sck::check_errors::U](mnt[mnt::tsk::check_errors][mnt::sck::check_errors::U]);
+		mnt_pt[mnt::tsk::check_errors][mnt::sck::check_errors::V](mnt[mnt::tsk::check_errors][mnt::sck::check_errors::V]);
+	}
 }
 
 template <typename B, typename R, typename Q>
 void BFER_std_threads<B,R,Q>
 ::simulation_loop(const int tid)
+{
+	using namespace std::chrono;
+	auto t_snr = steady_clock::now();
+
+	// communication chain execution
+	while (!this->monitor_red->fe_limit_achieved() && // while max frame error count has not been reached
+	       (this->params_BFER_std.stop_time == seconds(0) || 
+	       (steady_clock::now() - t_snr) < this->params_BFER_std.stop_time) &&
+	       (this->monitor_red->get_n_analyzed_fra() < this->max_fra || this->max_fra == 0))
+		this->simulation_step(tid, *this->monitor[tid]);
+}
+
+template <typename B, typename R, typename Q>
+void BFER_std_threads<B,R,Q>
+::simulation_step(const int tid, module::Monitor_BFER<B> &monitor)
 {
 	auto &source     = *this->source    [tid];
 	auto &crc        = *this->crc       [tid];
@@ -247,100 +342,309 @@ void BFER_std_threads<B,R,Q>
 	auto &coset_real = *this->coset_real[tid];
 	auto &decoder    = *this->codec     [tid]->get_decoder_siho();
 	auto &coset_bit  = *this->coset_bit [tid];
-	auto &monitor    = *this->monitor   [tid];
 
 	using namespace module;
-	using namespace std::chrono;
-	auto t_snr = steady_clock::now();
 
-	// communication chain execution
-	while (!this->monitor_red->fe_limit_achieved() && // while max frame error count has not been reached
-	       (this->params_BFER_std.stop_time == seconds(0) || 
-	       (steady_clock::now() - t_snr) < this->params_BFER_std.stop_time) &&
-	       (this->monitor_red->get_n_analyzed_fra() < this->max_fra || this->max_fra == 0))
+	if (this->params_BFER_std.debug)
 	{
-		if (this->params_BFER_std.debug)
-		{
-			if (!monitor[mnt::tsk::check_errors].get_n_calls())
-				std::cout << "#" << std::endl;
-
-			std::cout << "# -------------------------------" << std::endl;
-			std::cout << "# New communication (n°" << monitor[mnt::tsk::check_errors].get_n_calls() << ")" << std::endl;
-			std::cout << "# -------------------------------" << std::endl;
+		if (!monitor[mnt::tsk::check_errors].get_n_calls())
 			std::cout << "#" << std::endl;
-		}
 
-		if (this->params_BFER_std.src->type != "AZCW")
+		std::cout << "# -------------------------------" << std::endl;
+		std::cout << "# New communication (n°" << monitor[mnt::tsk::check_errors].get_n_calls() << ")" << std::endl;
+		std::cout << "# -------------------------------" << std::endl;
+		std::cout << "#" << std::endl;
+	}
+
+	if (this->params_BFER_std.src->type != "AZCW")
+	{
+		source[src::tsk::generate].exec();
+		if (this->params_BFER_std.crc->type != "NO")
+			crc[crc::tsk::build].exec();
+		if (this->params_BFER_std.cdc->enc->type != "NO")
+			encoder[enc::tsk::encode].exec();
+		if (this->params_BFER_std.cdc->pct != nullptr && this->params_BFER_std.cdc->pct->type != "NO")
+			puncturer[pct::tsk::puncture].exec();
+		modem[mdm::tsk::modulate].exec();
+	}
+
+	if (this->params_BFER_std.chn->type.find("RAYLEIGH") != std::string::npos)
+	{
+		if (this->params_BFER_std.chn->type != "NO")
+			channel[chn::tsk::add_noise_wg].exec();
+		if (modem.is_filter())
+			modem[mdm::tsk::filter].exec();
+		if (modem.is_demodulator())
+			modem[mdm::tsk::demodulate_wg].exec();
+		if (this->params_BFER_std.qnt->type != "NO")
+			quantizer[qnt::tsk::process].exec();
+	}
+	else
+	{
+		if (this->params_BFER_std.chn->type != "NO")
+			channel[chn::tsk::add_noise].exec();
+		if (modem.is_filter())
+			modem[mdm::tsk::filter].exec();
+		if (modem.is_demodulator())
+			modem[mdm::tsk::demodulate].exec();
+		if (this->params_BFER_std.qnt->type != "NO")
+			quantizer[qnt::tsk::process].exec();
+	}
+
+	if (this->params_BFER_std.cdc->pct != nullptr && this->params_BFER_std.cdc->pct->type != "NO")
+		puncturer[pct::tsk::depuncture].exec();
+
+	if (this->params_BFER_std.coset)
+	{
+		coset_real[cst::tsk::apply].exec();
+
+		if (this->params_BFER_std.coded_monitoring)
 		{
-			source[src::tsk::generate].exec();
+			decoder  [dec::tsk::decode_siho_cw].exec();
+			coset_bit[cst::tsk::apply         ].exec();
+		}
+		else
+		{
+			decoder  [dec::tsk::decode_siho].exec();
+			coset_bit[cst::tsk::apply      ].exec();
 			if (this->params_BFER_std.crc->type != "NO")
-				crc[crc::tsk::build].exec();
-			if (this->params_BFER_std.cdc->enc->type != "NO")
-				encoder[enc::tsk::encode].exec();
-			if (this->params_BFER_std.cdc->pct != nullptr && this->params_BFER_std.cdc->pct->type != "NO")
-				puncturer[pct::tsk::puncture].exec();
-			modem[mdm::tsk::modulate].exec();
+				crc[crc::tsk::extract].exec();
 		}
-
-		if (this->params_BFER_std.chn->type.find("RAYLEIGH") != std::string::npos)
+	}
+	else
+	{
+		if (this->params_BFER_std.coded_monitoring)
 		{
-			if (this->params_BFER_std.chn->type != "NO")
-				channel[chn::tsk::add_noise_wg].exec();
-			if (modem.is_filter())
-				modem[mdm::tsk::filter].exec();
-			if (modem.is_demodulator())
-				modem[mdm::tsk::demodulate_wg].exec();
-			if (this->params_BFER_std.qnt->type != "NO")
-				quantizer[qnt::tsk::process].exec();
+			decoder[dec::tsk::decode_siho_cw].exec();
 		}
 		else
 		{
-			if (this->params_BFER_std.chn->type != "NO")
-				channel[chn::tsk::add_noise].exec();
-			if (modem.is_filter())
-				modem[mdm::tsk::filter].exec();
-			if (modem.is_demodulator())
-				modem[mdm::tsk::demodulate].exec();
-			if (this->params_BFER_std.qnt->type != "NO")
-				quantizer[qnt::tsk::process].exec();
+			decoder[dec::tsk::decode_siho].exec();
+			if (this->params_BFER_std.crc->type != "NO")
+				crc[crc::tsk::extract].exec();
 		}
+	}
 
-		if (this->params_BFER_std.cdc->pct != nullptr && this->params_BFER_std.cdc->pct->type != "NO")
-			puncturer[pct::tsk::depuncture].exec();
+	monitor[mnt::tsk::check_errors].exec();
+}
 
-		if (this->params_BFER_std.coset)
-		{
-			coset_real[cst::tsk::apply].exec();
+template <typename B, typename R, typename Q>
+void BFER_std_threads<B,R,Q>
+::launch_concurrent()
+{
+	this->terminal = this->build_terminal();
 
-			if (this->params_BFER_std.coded_monitoring)
-			{
-				decoder  [dec::tsk::decode_siho_cw].exec();
-				coset_bit[cst::tsk::apply         ].exec();
-			}
-			else
-			{
-				decoder  [dec::tsk::decode_siho].exec();
-				coset_bit[cst::tsk::apply      ].exec();
-				if (this->params_BFER_std.crc->type != "NO")
-					crc[crc::tsk::extract].exec();
-			}
-		}
+	this->build_communication_chain();
+
+	if (module::Monitor::is_over())
+	{
+		this->release_objects();
+		return;
+	}
+
+	for (size_t p = 0; p < snr_pts.size(); p++)
+		monitor_red_pts[p] = new module::Monitor_BFER_reduction<B>(monitor_pts[p]);
+
+	const auto display     = !this->params_BFER_std.ter->disabled;
+	const auto temp_report = display && this->params_BFER_std.ter->frequency != std::chrono::nanoseconds(0);
+
+	if (display)
+		this->terminal->legend(std::cout);
+
+	// the threads are not bound to a SNR point, each one moves to the point that needs the most frames
+	n_running_workers = this->params_BFER_std.n_threads;
+	std::vector<std::thread> threads(this->params_BFER_std.n_threads);
+	for (auto tid = 0; tid < this->params_BFER_std.n_threads; tid++)
+		threads[tid] = std::thread(BFER_std_threads<B,R,Q>::start_thread_concurrent, this, tid);
+
+	// the master thread displays the SNR points in the order of the SNR sweep
+	for (size_t p = 0; p < snr_pts.size(); p++)
+	{
+		std::unique_lock<std::mutex> lock(mutex_pts);
+		cond_pts.wait(lock, [&]() { return active_pts[p] || !n_running_workers; });
+		if (!active_pts[p])
+			break;
+		lock.unlock();
+
+		if (temp_report)
+			terminal_pts[p]->start_temp_report(this->params_BFER_std.ter->frequency);
+
+		lock.lock();
+		cond_pts.wait(lock, [&]() { return (done_pts[p] && !n_workers_pts[p]) || !n_running_workers; });
+		lock.unlock();
+
+		if (display)
+			terminal_pts[p]->final_report(std::cout);
 		else
+			terminal_pts[p]->stop_temp_report();
+
+		if (!module::Monitor::is_interrupt() &&
+		    this->monitor_red_pts[p]->get_n_fe() < this->monitor_red_pts[p]->get_fe_limit())
+			module::Monitor::stop();
+
+		lock.lock();
+		this->monitor_red_pts[p]->reset();
+		lock.unlock();
+		cond_pts.notify_all();
+
+		if (module::Monitor::is_over())
+			break;
+	}
+
+	for (auto tid = 0; tid < this->params_BFER_std.n_threads; tid++)
+		threads[tid].join();
+
+	if (!this->prev_err_messages.empty())
+	{
+		std::cerr << tools::apply_on_each_line(tools::addr2line(this->prev_err_messages.back()), &tools::format_error)
+		          << std::endl;
+		this->simu_error = true;
+	}
+
+	this->release_objects();
+}
+
+template <typename B, typename R, typename Q>
+void BFER_std_threads<B,R,Q>
+::start_thread_concurrent(BFER_std_threads<B,R,Q> *simu, const int tid)
+{
+	try
+	{
+		simu->pin_thread(tid);
+		simu->sockets_binding(tid);
+		simu->concurrent_loop(tid);
+	}
+	catch (std::exception const& e)
+	{
+		module::Monitor::stop();
+
+		simu->mutex_exception.lock();
+		if (std::find(simu->prev_err_messages.begin(), simu->prev_err_messages.end(), e.what()) == simu->prev_err_messages.end())
+			simu->prev_err_messages.push_back(e.what());
+		simu->mutex_exception.unlock();
+	}
+
+	std::unique_lock<std::mutex> lock(simu->mutex_pts);
+	simu->n_running_workers--;
+	simu->cond_pts.notify_all();
+}
+
+template <typename B, typename R, typename Q>
+void BFER_std_threads<B,R,Q>
+::concurrent_loop(const int tid)
+{
+	using namespace std::chrono;
+
+	// time spent on a SNR point before to look for the point that needs the most frames
+	const auto quantum = milliseconds(100);
+
+	auto pt = -1, sigma_pt = -1;
+	while ((pt = this->pick_point(tid, pt)) >= 0)
+	{
+		if (pt != sigma_pt)
 		{
-			if (this->params_BFER_std.coded_monitoring)
+			this->set_sigma(tid, this->sigma_pts[pt]);
+			sigma_pt = pt;
+		}
+
+		auto &monitor = *this->monitor_pts[pt][tid];
+		const auto t_quantum = steady_clock::now();
+		while (!this->is_point_over(pt) && (steady_clock::now() - t_quantum) < quantum)
+			this->simulation_step(tid, monitor);
+	}
+}
+
+template <typename B, typename R, typename Q>
+int BFER_std_threads<B,R,Q>
+::pick_point(const int tid, const int prev_pt)
+{
+	std::unique_lock<std::mutex> lock(mutex_pts);
+
+	if (prev_pt >= 0)
+		n_workers_pts[prev_pt]--;
+
+	const auto n_pts = snr_pts.size();
+	while (!module::Monitor::is_over())
+	{
+		// close the points that are over and keep 'snr_par' points in progress
+		size_t n_in_progress = 0;
+		for (size_t p = 0; p < n_activated_pts; p++)
+			if (active_pts[p] && !done_pts[p])
 			{
-				decoder[dec::tsk::decode_siho_cw].exec();
+				if (this->is_point_over((int)p))
+					done_pts[p] = true;
+				else
+					n_in_progress++;
 			}
-			else
+
+		while (!module::Monitor::is_interrupt() && n_activated_pts < n_pts &&
+		       n_in_progress < (size_t)this->params_BFER_std.snr_par)
+		{
+			const auto p = n_activated_pts++;
+			terminal_pts[p] = factory::Terminal_BFER::build<B>(*this->params_BFER_std.ter, *monitor_red_pts[p]);
+			terminal_pts[p]->set_esn0(snr_s_pts[p]);
+			terminal_pts[p]->set_ebn0(snr_b_pts[p]);
+			t_start_pts [p] = std::chrono::steady_clock::now();
+			active_pts  [p] = true;
+			n_in_progress++;
+		}
+
+		// the expected number of remaining frames is estimated from the current FER, it is shared between the workers
+		auto best_pt    = -1;
+		auto best_score = -1.f;
+		for (size_t p = 0; p < n_activated_pts; p++)
+			if (active_pts[p] && !done_pts[p])
 			{
-				decoder[dec::tsk::decode_siho].exec();
-				if (this->params_BFER_std.crc->type != "NO")
-					crc[crc::tsk::extract].exec();
+				const auto n_fe  = monitor_red_pts[p]->get_n_fe();
+				const auto n_fra = monitor_red_pts[p]->get_n_analyzed_fra();
+				const auto lim   = monitor_red_pts[p]->get_fe_limit();
+				const auto need  = n_fe ? (float)(lim - std::min((unsigned long long)lim, n_fe)) * (float)n_fra / (float)n_fe
+				                        : std::numeric_limits<float>::max();
+				const auto score = need / (float)(n_workers_pts[p] +1);
+				if (score > best_score)
+				{
+					best_score = score;
+					best_pt    = (int)p;
+				}
 			}
+
+		if (best_pt >= 0)
+		{
+			n_workers_pts[best_pt]++;
+			cond_pts.notify_all();
+			return best_pt;
 		}
 
-		monitor[mnt::tsk::check_errors].exec();
+		if (n_activated_pts == n_pts)
+			break;
+
+		// the points have been interrupted, wait until the master thread displays them
+		cond_pts.notify_all();
+		cond_pts.wait_for(lock, std::chrono::milliseconds(10));
 	}
+
+	cond_pts.notify_all();
+	return -1;
+}
+
+template <typename B, typename R, typename Q>
+bool BFER_std_threads<B,R,Q>
+::is_point_over(const int pt)
+{
+	using namespace std::chrono;
+
+	return this->monitor_red_pts[pt]->fe_limit_achieved() ||
+	       (this->params_BFER_std.stop_time != seconds(0) &&
+	       (steady_clock::now() - t_start_pts[pt]) >= this->params_BFER_std.stop_time);
+}
+
+template <typename B, typename R, typename Q>
+void BFER_std_threads<B,R,Q>
+::set_sigma(const int tid, const float sigma)
+{
+	this->channel[tid]->set_sigma(                                                         sigma);
+	this->modem  [tid]->set_sigma(this->params_BFER_std.mdm->complex ? sigma * std::sqrt(2.f) : sigma);
+	this->codec  [tid]->set_sigma(                                                         sigma);
 }
 
 // ==================================================================================== explicit template instantiation
@@ -1,6 +1,11 @@
 #ifndef SIMULATION_BFER_STD_THREADS_HPP_
 #define SIMULATION_BFER_STD_THREADS_HPP_
 
+#include <mutex>
+#include <chrono>
+#include <vector>
+#include <condition_variable>
+
 #include "../BFER_std.hpp"
 
 namespace aff3ct
@@ -10,18 +15,48 @@ namespace simulation
 template <typename B = int, typename R = float, typename Q = R>
 class BFER_std_threads : public BFER_std<B,R,Q>
 {
+private:
+	// concurrent SNR points (only used when 'snr_par' > 1)
+	std::vector<float>                                                                        snr_pts;
+	std::vector<float>                                                                        snr_s_pts;
+	std::vector<float>                                                                        snr_b_pts;
+	std::vector<float>                                                                        sigma_pts;
+	std::vector<std::vector<module::Monitor_BFER<B>*>>                                        monitor_pts;
+	std::vector<module::Monitor_BFER_reduction<B>*>                                           monitor_red_pts;
+	std::vector<tools::Terminal_BFER<B>*>                                                     terminal_pts;
+	std::vector<std::chrono::time_point<std::chrono::steady_clock, std::chrono::nanoseconds>> t_start_pts;
+	std::vector<int>                                                                          n_workers_pts;
+	std::vector<bool>                                                                         active_pts;
+	std::vector<bool>                                                                         done_pts;
+
+	size_t                  n_activated_pts;
+	int                     n_running_workers;
+	std::mutex              mutex_pts;
+	std::condition_variable cond_pts;
+
 public:
 	explicit BFER_std_threads(const factory::BFER_std::parameters &params_BFER_std);
 	virtual ~BFER_std_threads();
 
+	void launch();
+
 protected:
+	virtual void __build_communication_chain(const int tid = 0);
 	virtual void _launch();
 
 private:
 	void sockets_binding(const int tid = 0);
 	void simulation_loop(const int tid = 0);
+	void simulation_step(const int tid, module::Monitor_BFER<B> &monitor);
+
+	void launch_concurrent();
+	void concurrent_loop  (const int tid = 0);
+	int  pick_point       (const int tid, const int prev_pt);
+	bool is_point_over    (const int pt);
+	void set_sigma        (const int tid, const float sigma);
 
-	static void start_thread(BFER_std_threads<B,R,Q> *simu, const int tid = 0);
+	static void start_thread           (BFER_std_threads<B,R,Q> *simu, const int tid = 0);
+	static void start_thread_concurrent(BFER_std_threads<B,R,Q> *simu, const int tid = 0);
 };
 }
 }
@@ -0,0 +1,439 @@
+#include <thread>
+#include <chrono>
+#include <sstream>
+#include <iostream>
+#include <algorithm>
+#include <type_traits>
+
+#include "Tools/Exception/exception.hpp"
+#include "Tools/Display/bash_tools.h"
+#include "Tools/Display/Statistics/Statistics.hpp"
+#include "Tools/Threads/thread_pinning.h"
+
+#include "DEC.hpp"
+
+using namespace aff3ct;
+using namespace aff3ct::simulation;
+
+template <typename B, typename R, typename Q>
+DEC<B,R,Q>
+::DEC(const factory::DEC::parameters &params_DEC)
+: Simulation(params_DEC),
+  params_DEC(params_DEC),
+
+  crc      (params_DEC.n_threads, nullptr),
+  codec    (params_DEC.n_threads, nullptr),
+  quantizer(params_DEC.n_threads, nullptr),
+
+  chain_in (params_DEC.n_threads, nullptr),
+  chain_out(params_DEC.n_threads, nullptr),
+  chain    (params_DEC.n_threads, nullptr),
+
+  n_fra_file(0),
+  sizeof_llr(0),
+  n_fra_read(0),
+
+  N           (params_DEC.cdc->N),
+  K           (params_DEC.src->K),
+  n_fra_inter (params_DEC.src->n_frames),
+  n_fra_thread(((params_DEC.chunk + n_fra_inter -1) / n_fra_inter) * n_fra_inter),
+
+  llr_buff(2, std::vector<R      >(params_DEC.n_threads * n_fra_thread * N)),
+  out_buff(2, std::vector<uint8_t>(params_DEC.n_threads * n_fra_thread * K)),
+
+  thread_errors(params_DEC.n_threads)
+{
+#ifdef ENABLE_MPI
+	std::clog << tools::format_warning("This simulation is not MPI ready, the same file will be decoded by each MPI "
+	                                   "processes.") << std::endl;
+#endif
+
+	if (params_DEC.n_threads < 1)
+	{
+		std::stringstream message;
+		message << "'n_threads' has to be greater than 0 ('n_threads' = " << params_DEC.n_threads << ").";
+		throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	if (params_DEC.chunk < 1)
+	{
+		std::stringstream message;
+		message << "'chunk' has to be greater than 0 ('chunk' = " << params_DEC.chunk << ").";
+		throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	const auto cpus = tools::get_cpu_placement(params_DEC.thread_pin, params_DEC.n_threads);
+	if (!cpus.empty())
+		thread_cpus = cpus;
+
+	this->modules["crc"      ] = std::vector<module::Module*>(params_DEC.n_threads, nullptr);
+	this->modules["codec"    ] = std::vector<module::Module*>(params_DEC.n_threads, nullptr);
+	this->modules["puncturer"] = std::vector<module::Module*>(params_DEC.n_threads, nullptr);
+	this->modules["decoder"  ] = std::vector<module::Module*>(params_DEC.n_threads, nullptr);
+	this->modules["quantizer"] = std::vector<module::Module*>(params_DEC.n_threads, nullptr);
+}
+
+template <typename B, typename R, typename Q>
+DEC<B,R,Q>
+::~DEC()
+{
+	release_objects();
+}
+
+template <typename B, typename R, typename Q>
+void DEC<B,R,Q>
+::_build_communication_chain()
+{
+	release_objects();
+
+	for (auto tid = 0; tid < params_DEC.n_threads; tid++)
+	{
+		crc      [tid] = build_crc      (tid);
+		codec    [tid] = build_codec    (tid);
+		quantizer[tid] = build_quantizer(tid);
+
+		if (params_DEC.sigma > 0.f)
+			codec[tid]->set_sigma(params_DEC.sigma);
+
+		tools::Interleaver_core<> *interleaver = nullptr;
+		try { interleaver = codec[tid]->get_interleaver(); } // can raise an exceptions
+		catch (const std::exception&) { /* do nothing if there is no interleaver */ }
+
+		if (interleaver != nullptr)
+		{
+			interleaver->init();
+			// the frames of the file have been interleaved with the same permutation
+			if (interleaver->is_uniform())
+				throw tools::invalid_argument(__FILE__, __LINE__, __func__, "The uniform interleavers can't be used "
+				                                                            "to decode a file.");
+		}
+
+		this->modules["crc"      ][tid] = crc      [tid];
+		this->modules["codec"    ][tid] = codec    [tid];
+		this->modules["puncturer"][tid] = codec    [tid]->get_puncturer();
+		this->modules["decoder"  ][tid] = codec    [tid]->get_decoder_siho();
+		this->modules["quantizer"][tid] = quantizer[tid];
+	}
+}
+
+template <typename B, typename R, typename Q>
+void DEC<B,R,Q>
+::sockets_binding(const int tid)
+{
+	using namespace module;
+
+	auto &crc = *this->crc      [tid];
+	auto &pct = *this->codec    [tid]->get_puncturer();
+	auto &dec = *this->codec    [tid]->get_decoder_siho();
+	auto &qnt = *this->quantizer[tid];
+
+	chain[tid] = new tools::Sequence();
+
+	// the input socket of the first executed task is bound to the LLRs of the chunk before each decoding
+	Socket *out = nullptr;
+	if (params_DEC.qnt->type != "NO")
+	{
+		chain_in[tid] = &qnt[qnt::tsk::process][qnt::sck::process::Y_N1];
+		out           = &qnt[qnt::tsk::process][qnt::sck::process::Y_N2];
+		chain[tid]->add(qnt[qnt::tsk::process]);
+	}
+
+	if (params_DEC.cdc->pct != nullptr && params_DEC.cdc->pct->type != "NO")
+	{
+		if (out != nullptr)
+			pct[pct::tsk::depuncture][pct::sck::depuncture::Y_N1](*out);
+		else
+			chain_in[tid] = &pct[pct::tsk::depuncture][pct::sck::depuncture::Y_N1];
+		out = &pct[pct::tsk::depuncture][pct::sck::depuncture::Y_N2];
+		chain[tid]->add(pct[pct::tsk::depuncture]);
+	}
+
+	if (out != nullptr)
+		dec[dec::tsk::decode_siho][dec::sck::decode_siho::Y_N](*out);
+	else
+		chain_in[tid] = &dec[dec::tsk::decode_siho][dec::sck::decode_siho::Y_N];
+	chain[tid]->add(dec[dec::tsk::decode_siho]);
+
+	if (params_DEC.crc->type != "NO")
+	{
+		crc[crc::tsk::extract][crc::sck::extract::V_K1](dec[dec::tsk::decode_siho][dec::sck::decode_siho::V_K]);
+		chain_out[tid] = &crc[crc::tsk::extract][crc::sck::extract::V_K2];
+		chain[tid]->add(crc[crc::tsk::extract]);
+	}
+	else
+		chain_out[tid] = &dec[dec::tsk::decode_siho][dec::sck::decode_siho::V_K];
+}
+
+template <typename B, typename R, typename Q>
+void DEC<B,R,Q>
+::open_files()
+{
+	llr_file.open(params_DEC.llr_path.c_str(), std::ios::binary);
+	if (!llr_file.is_open())
+		throw tools::invalid_argument(__FILE__, __LINE__, __func__, "Can't open '" + params_DEC.llr_path + "' file.");
+
+	unsigned fra_size = 0;
+	llr_file.read((char*)&n_fra_file, sizeof(n_fra_file));
+	llr_file.read((char*)&fra_size,   sizeof(fra_size  ));
+	const auto head_bytes = (std::streamoff)llr_file.tellg();
+
+	llr_file.seekg(0, std::ios_base::end);
+	const auto body_bytes = (unsigned long long)((std::streamoff)llr_file.tellg() - head_bytes);
+	llr_file.seekg(head_bytes, std::ios_base::beg);
+
+	if (n_fra_file == 0 || fra_size == 0)
+	{
+		std::stringstream message;
+		message << "'n_fra_file' and 'fra_size' have to be greater than 0 ('n_fra_file' = " << n_fra_file
+		        << ", 'fra_size' = " << fra_size << ").";
+		throw tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	if ((int)fra_size != N)
+	{
+		std::stringstream message;
+		message << "The frame size is wrong (read: " << fra_size << ", expected: " << N << ").";
+		throw tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	const auto n_llrs = (unsigned long long)n_fra_file * fra_size;
+	sizeof_llr = (unsigned)(body_bytes / n_llrs);
+	if ((sizeof_llr != sizeof(float) && sizeof_llr != sizeof(double)) || body_bytes % n_llrs)
+	{
+		std::stringstream message;
+		message << "The LLRs have to be stored as 32-bit or 64-bit floats ('body_bytes' = " << body_bytes
+		        << ", 'n_llrs' = " << n_llrs << ").";
+		throw tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	if (sizeof_llr != sizeof(R) || !std::is_floating_point<R>::value)
+		raw_buff.resize(params_DEC.n_threads * n_fra_thread * N * sizeof_llr);
+
+	if (!params_DEC.out_path.empty())
+	{
+		out_file.open(params_DEC.out_path.c_str(), std::ios::binary);
+		if (!out_file.is_open())
+			throw tools::invalid_argument(__FILE__, __LINE__, __func__, "Can't open '" + params_DEC.out_path +
+			                                                            "' file.");
+
+		const unsigned n_bits = (unsigned)K;
+		out_file.write((char*)&n_fra_file, sizeof(n_fra_file));
+		out_file.write((char*)&n_bits,     sizeof(n_bits    ));
+	}
+}
+
+template <typename B, typename R, typename Q>
+int DEC<B,R,Q>
+::read_chunk(std::vector<R> &llrs)
+{
+	const auto n_fra = (int)std::min((unsigned)(params_DEC.n_threads * n_fra_thread), n_fra_file - n_fra_read);
+	if (n_fra == 0)
+		return 0;
+
+	const auto n_llrs = (size_t)n_fra * N;
+	if (raw_buff.empty())
+		llr_file.read(reinterpret_cast<char*>(llrs.data()), n_llrs * sizeof(R));
+	else
+	{
+		llr_file.read(raw_buff.data(), n_llrs * sizeof_llr);
+		if (sizeof_llr == sizeof(float))
+		{
+			const auto raw = reinterpret_cast<const float*>(raw_buff.data());
+			for (size_t i = 0; i < n_llrs; i++)
+				llrs[i] = (R)raw[i];
+		}
+		else
+		{
+			const auto raw = reinterpret_cast<const double*>(raw_buff.data());
+			for (size_t i = 0; i < n_llrs; i++)
+				llrs[i] = (R)raw[i];
+		}
+	}
+
+	if (!llr_file)
+	{
+		std::stringstream message;
+		message << "The LLR file is truncated ('n_fra_read' = " << n_fra_read << ", 'n_fra_file' = " << n_fra_file
+		        << ").";
+		throw tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	// the last frames of the last chunk are erased (null LLRs) to complete the inter frame groups
+	std::fill(llrs.begin() + n_llrs, llrs.end(), (R)0);
+
+	n_fra_read += n_fra;
+	return n_fra;
+}
+
+template <typename B, typename R, typename Q>
+void DEC<B,R,Q>
+::write_chunk(const std::vector<uint8_t> &bits, const int n_fra)
+{
+	if (out_file.is_open() && n_fra > 0)
+		out_file.write(reinterpret_cast<const char*>(bits.data()), (size_t)n_fra * K);
+}
+
+template <typename B, typename R, typename Q>
+void DEC<B,R,Q>
+::decode_slice(const int tid, R *Y_N, uint8_t *V_K, const int n_fra)
+{
+	for (auto f = 0; f < n_fra; f += n_fra_inter)
+	{
+		chain_in[tid]->bind((void*)(Y_N + f * N));
+		codec[tid]->reset();
+		chain[tid]->exec();
+
+		const auto dec_bits = static_cast<const B*>(chain_out[tid]->get_dataptr());
+		const auto n_bits   = std::min(n_fra - f, n_fra_inter) * K;
+		for (auto i = 0; i < n_bits; i++)
+			V_K[f * K +i] = dec_bits[i] ? 1 : 0;
+	}
+}
+
+template <typename B, typename R, typename Q>
+void DEC<B,R,Q>
+::start_thread(DEC<B,R,Q> *simu, const int tid, R *Y_N, uint8_t *V_K, const int n_fra)
+{
+	try
+	{
+		if (!simu->thread_cpus.empty())
+			tools::pin_thread(simu->thread_cpus[tid]);
+
+		simu->decode_slice(tid, Y_N, V_K, n_fra);
+	}
+	catch (std::exception const& e)
+	{
+		simu->thread_errors[tid] = e.what();
+	}
+}
+
+template <typename B, typename R, typename Q>
+void DEC<B,R,Q>
+::launch()
+{
+	using namespace std::chrono;
+
+	this->build_communication_chain();
+	for (auto tid = 0; tid < params_DEC.n_threads; tid++)
+		this->sockets_binding(tid);
+
+	this->open_files();
+
+	const auto t_start = steady_clock::now();
+
+	auto cur   = 0;
+	auto n_fra = this->read_chunk(llr_buff[cur]);
+	auto n_prv = 0;
+	while (n_fra > 0)
+	{
+		// decode the current chunk: each thread decodes a contiguous slice of frames
+		std::vector<std::thread> threads;
+		for (auto tid = 0; tid < params_DEC.n_threads; tid++)
+		{
+			const auto f_start = std::min(tid * n_fra_thread, n_fra);
+			const auto f_stop  = std::min(f_start + n_fra_thread, n_fra);
+			if (f_stop > f_start)
+				threads.push_back(std::thread(DEC<B,R,Q>::start_thread, this, tid,
+				                              llr_buff[cur].data() + f_start * N,
+				                              out_buff[cur].data() + f_start * K,
+				                              f_stop - f_start));
+		}
+
+		// meanwhile, write the previous chunk and read the next one
+		this->write_chunk(out_buff[1 - cur], n_prv);
+		const auto n_nxt = this->read_chunk(llr_buff[1 - cur]);
+
+		for (auto &t : threads)
+			t.join();
+
+		for (auto tid = 0; tid < params_DEC.n_threads; tid++)
+			if (!thread_errors[tid].empty())
+			{
+				this->simu_error = true;
+				throw tools::runtime_error(__FILE__, __LINE__, __func__, thread_errors[tid]);
+			}
+
+		n_prv = n_fra;
+		n_fra = n_nxt;
+		cur   = 1 - cur;
+	}
+	this->write_chunk(out_buff[1 - cur], n_prv);
+
+	const auto elapsed = duration_cast<nanoseconds>(steady_clock::now() - t_start).count() * 1e-9;
+
+	llr_file.close();
+	if (out_file.is_open())
+		out_file.close();
+
+	const auto info_thr = (double)n_fra_read * K / elapsed * 1e-6;
+	const auto llr_thr  = (double)n_fra_read * N / elapsed * 1e-6;
+
+	std::cout << "# Decoded frames:  " << n_fra_read << std::endl;
+	std::cout << "# Elapsed time:    " << elapsed    << " sec" << std::endl;
+	std::cout << "# Throughput:      " << info_thr   << " Mb/s (information bits), "
+	                                   << llr_thr    << " MLLR/s (LLRs)" << std::endl;
+
+	if (params_DEC.statistics)
+	{
+		std::vector<std::vector<const module::Module*>> mod_vec;
+		for (auto &vm : this->modules)
+		{
+			std::vector<const module::Module*> sub_mod_vec;
+			for (auto *m : vm.second)
+				sub_mod_vec.push_back(m);
+			mod_vec.push_back(sub_mod_vec);
+		}
+
+		std::cout << "#" << std::endl;
+		tools::Stats::show(mod_vec, true, std::cout);
+		std::cout << "#" << std::endl;
+	}
+}
+
+template <typename B, typename R, typename Q>
+void DEC<B,R,Q>
+::release_objects()
+{
+	for (auto tid = 0; tid < params_DEC.n_threads; tid++)
+	{
+		if (chain    [tid] != nullptr) { delete chain    [tid]; chain    [tid] = nullptr; }
+		if (crc      [tid] != nullptr) { delete crc      [tid]; crc      [tid] = nullptr; }
+		if (codec    [tid] != nullptr) { delete codec    [tid]; codec    [tid] = nullptr; }
+		if (quantizer[tid] != nullptr) { delete quantizer[tid]; quantizer[tid] = nullptr; }
+	}
+}
+
+template <typename B, typename R, typename Q>
+module::CRC<B>* DEC<B,R,Q>
+::build_crc(const int tid)
+{
+	return params_DEC.crc->template build<B>();
+}
+
+template <typename B, typename R, typename Q>
+module::Codec_SIHO<B,Q>* DEC<B,R,Q>
+::build_codec(const int tid)
+{
+	// all the threads use the same codec (interleaver and frozen bits) than the one which produced the frames
+	auto crc = params_DEC.crc->type == "NO" ? nullptr : this->crc[tid];
+	return params_DEC.cdc->template build<B,Q>(crc);
+}
+
+template <typename B, typename R, typename Q>
+module::Quantizer<R,Q>* DEC<B,R,Q>
+::build_quantizer(const int tid)
+{
+	return params_DEC.qnt->template build<R,Q>();
+}
+
+// ==================================================================================== explicit template instantiation
+#include "Tools/types.h"
+#ifdef MULTI_PREC
+template class aff3ct::simulation::DEC<B_8,R_8,Q_8>;
+template class aff3ct::simulation::DEC<B_16,R_16,Q_16>;
+template class aff3ct::simulation::DEC<B_32,R_32,Q_32>;
+template class aff3ct::simulation::DEC<B_64,R_64,Q_64>;
+#else
+template class aff3ct::simulation::DEC<B,R,Q>;
+#endif
+// ==================================================================================== explicit template instantiation
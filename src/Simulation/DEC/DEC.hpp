@@ -0,0 +1,100 @@
+/*!
+ * \file
+ * \brief Decodes a file of LLRs (offline decoding of captured frames).
+ *
+ * \section LICENSE
+ * This file is under MIT license (https://opensource.org/licenses/MIT).
+ */
+#ifndef SIMULATION_DEC_HPP_
+#define SIMULATION_DEC_HPP_
+
+#include <string>
+#include <vector>
+#include <fstream>
+#include <cstdint>
+
+#include "Module/CRC/CRC.hpp"
+#include "Module/Codec/Codec_SIHO.hpp"
+#include "Module/Quantizer/Quantizer.hpp"
+#include "Tools/Dataflow/Node.hpp"
+
+#include "Factory/Simulation/DEC/DEC.hpp"
+
+#include "../Simulation.hpp"
+
+namespace aff3ct
+{
+namespace simulation
+{
+/*!
+ * \class DEC
+ *
+ * \brief Decodes a file of LLRs (offline decoding of captured frames).
+ *
+ * The LLR file is streamed chunk by chunk: while the threads decode the current chunk, the main thread writes the
+ * decoded bits of the previous chunk and reads the next one (double buffering). Each thread decodes a contiguous
+ * slice of the chunk, so the decoded bits are written in the order of the LLR file.
+ */
+template <typename B = int, typename R = float, typename Q = R>
+class DEC : public Simulation
+{
+protected:
+	const factory::DEC::parameters &params_DEC;
+
+	// decoding chain
+	std::vector<module::CRC       <B  >*> crc;
+	std::vector<module::Codec_SIHO<B,Q>*> codec;
+	std::vector<module::Quantizer <R,Q>*> quantizer;
+
+	// first input socket and last output socket of the decoding chain of each thread
+	std::vector<module::Socket*> chain_in;
+	std::vector<module::Socket*> chain_out;
+	std::vector<tools::Sequence*> chain;
+
+	// CPU core of each thread (empty if the threads are not pinned)
+	std::vector<int> thread_cpus;
+
+	std::ifstream llr_file;
+	std::ofstream out_file;
+	unsigned      n_fra_file;  // number of frames in the LLR file
+	unsigned      sizeof_llr;  // number of bytes of a LLR in the file
+	unsigned      n_fra_read;  // number of frames read so far
+
+	const int N;               // number of LLRs per frame (in the file)
+	const int K;               // number of information bits per frame (in the output)
+	const int n_fra_inter;     // number of frames decoded at once by a decoder (inter frame level)
+	const int n_fra_thread;    // number of frames decoded by each thread in a chunk
+
+	// double buffers (LLRs and decoded bits), 'n_threads * n_fra_thread' frames each
+	std::vector<std::vector<R      >> llr_buff;
+	std::vector<std::vector<uint8_t>> out_buff;
+	std::vector<char>                 raw_buff;
+
+	std::vector<std::string> thread_errors;
+
+public:
+	explicit DEC(const factory::DEC::parameters &params_DEC);
+	virtual ~DEC();
+
+	void launch();
+
+protected:
+	void _build_communication_chain();
+	void sockets_binding(const int tid);
+	void release_objects();
+
+	void open_files ();
+	int  read_chunk (std::vector<R> &llrs);
+	void write_chunk(const std::vector<uint8_t> &bits, const int n_fra);
+
+	void decode_slice(const int tid, R *Y_N, uint8_t *V_K, const int n_fra);
+	static void start_thread(DEC<B,R,Q> *simu, const int tid, R *Y_N, uint8_t *V_K, const int n_fra);
+
+	module::CRC       <B  >* build_crc      (const int tid = 0);
+	module::Codec_SIHO<B,Q>* build_codec    (const int tid = 0);
+	module::Quantizer <R,Q>* build_quantizer(const int tid = 0);
+};
+}
+}
+
+#endif /* SIMULATION_DEC_HPP_ */
@@ -0,0 +1,211 @@
+#ifndef LC_SORTER_BITONIC_HPP
+#define LC_SORTER_BITONIC_HPP
+
+#include <limits>
+#include <vector>
+#include <algorithm>
+#include <mipp.h>
+
+#include "LC_sorter.hpp"
+
+namespace aff3ct
+{
+namespace tools
+{
+/*!
+ * \class LC_sorter_bitonic
+ *
+ * \brief Selects the positions of the K smallest values with a bitonic sorting network.
+ *
+ * The sequence of the compare-exchanges does not depend on the data: the values are compared with min/max and the
+ * directions are applied with selections. The n values are seen as R registers of W elements and the element 'x' of the
+ * network is stored in the lane 'x / R' of the register 'x % R': all the stages with a stride smaller than R compare
+ * two full registers (vectorized), only the log2(W) * (log2(W) +1) / 2 stages with a bigger stride are computed inside
+ * the registers. When K is a power of two, the values are not fully sorted: the blocks of K values are sorted, then
+ * merged two by two with a single min stage (the K smallest values of two blocks sorted in opposite directions are their
+ * min) until one block remains. For the selection of L paths among 2L candidates, this is one min stage instead of the
+ * last log2(2L) stages of the sort.
+ *
+ * The K-th smallest value is then used as a threshold to gather the positions without data dependent branches. Works
+ * for any arithmetic type (float, int16, int8, ...), the number of values is padded to a power of two.
+ *
+ * Unlike LC_sorter, the returned positions are in the increasing order of the positions (not in the increasing order of
+ * the values). When several values are equal to the threshold, the first ones are selected. The small selections
+ * (K < 8) are delegated to LC_sorter.
+ */
+template <typename T>
+class LC_sorter_bitonic
+{
+private:
+	int               max_elmts;
+	mipp::vector<T>   vals;
+	std::vector<int>  idx;
+	LC_sorter<T>      sorter_tree;
+
+public:
+	explicit LC_sorter_bitonic(const int max_elmts)
+	: max_elmts(next_pow2(max_elmts)), vals(this->max_elmts), idx(this->max_elmts +1), sorter_tree(this->max_elmts)
+	{
+	}
+
+	inline void partial_sort(const T* values, std::vector<int> &pos, int n_elmts = -1, int K = -1)
+	{
+		K       = (K       <= 0) ? (int)pos.size() : K;
+		n_elmts = (n_elmts <= 0) ? max_elmts       : n_elmts;
+
+		if (K < 8)
+		{
+			sorter_tree.partial_sort(values, pos, n_elmts, K);
+			return;
+		}
+
+		const auto n = next_pow2(n_elmts);
+		if (n > max_elmts)
+		{
+			max_elmts = n;
+			vals.resize(max_elmts);
+			idx .resize(max_elmts +1);
+		}
+
+		// the small sets are sorted without the registers
+		const auto W = (n >= 2 * mipp::nElReg<T>()) ? mipp::nElReg<T>() : 1;
+		const auto R = n / W;
+
+		std::copy(values, values + n_elmts, vals.begin());
+		std::fill(vals.begin() + n_elmts, vals.begin() + n, std::numeric_limits<T>::max());
+
+		T thr;
+		if ((K & (K -1)) == 0 && 2 * K <= n)
+		{
+			// sort the blocks of K values in alternate directions
+			for (auto k = 2; k <= K; k <<= 1)
+				for (auto j = k >> 1; j > 0; j >>= 1)
+					LC_sorter_bitonic<T>::stage(vals.data(), R, W, k, j);
+
+			// merge the blocks two by two: the K smallest values of two blocks sorted in opposite directions are their
+			// min, the remaining blocks are sorted again (in alternate directions) before the next merge
+			for (auto p = K; p < n; p <<= 1)
+			{
+				LC_sorter_bitonic<T>::stage(vals.data(), R, W, n, p);
+				if (2 * p < n)
+					for (auto j = K >> 1; j > 0; j >>= 1)
+						LC_sorter_bitonic<T>::stage(vals.data(), R, W, 2 * p, j);
+			}
+
+			// the K smallest values are in the first block
+			thr = std::numeric_limits<T>::lowest();
+			for (auto x = 0; x < K; x++)
+				thr = std::max(thr, vals[phys(x, R, W)]);
+		}
+		else
+		{
+			for (auto k = 2; k <= n; k <<= 1)
+				for (auto j = k >> 1; j > 0; j >>= 1)
+					LC_sorter_bitonic<T>::stage(vals.data(), R, W, k, j);
+
+			// the K-th smallest value
+			thr = vals[phys(K -1, R, W)];
+		}
+
+		// gather the positions: first the values strictly smaller than the threshold, then the values equal to it
+		auto c = 0;
+		for (auto i = 0; i < n_elmts; i++)
+		{
+			idx[c] = i;
+			c += (values[i] < thr) ? 1 : 0;
+		}
+		for (auto i = 0; i < n_elmts; i++)
+		{
+			idx[c] = i;
+			c += (values[i] == thr && c < K) ? 1 : 0;
+		}
+
+		std::copy(idx.begin(), idx.begin() + K, pos.begin());
+	}
+
+private:
+	static inline int phys(const int x, const int R, const int W)
+	{
+		return (x % R) * W + x / R;
+	}
+
+	// one stage of the network: compare-exchange of the elements 'x' and 'x + j' ('x & j' = 0), increasing order if
+	// 'x & k' = 0
+	static void stage(T *values, const int R, const int W, const int k, const int j)
+	{
+		if (j < R && W == mipp::nElReg<T>())
+		{
+			// the two elements are in the same lane of two different registers
+			if (k < R)
+			{
+				// the direction is the same for all the lanes of a register
+				for (auto r = 0; r < R; r += 2 * j)
+				{
+					const auto up = (r & k) == 0;
+					for (auto rr = r; rr < r + j; rr++)
+					{
+						const auto a  = mipp::Reg<T>(&values[(rr    ) * W]);
+						const auto b  = mipp::Reg<T>(&values[(rr + j) * W]);
+						const auto lo = mipp::min(a, b);
+						const auto hi = mipp::max(a, b);
+
+						(up ? lo : hi).store(&values[(rr    ) * W]);
+						(up ? hi : lo).store(&values[(rr + j) * W]);
+					}
+				}
+			}
+			else
+			{
+				// the direction depends on the lane (x = w * R + r)
+				bool down[mipp::N<T>()];
+				for (auto w = 0; w < mipp::N<T>(); w++)
+					down[w] = ((w * R) & k) != 0;
+				const auto m_down = mipp::Msk<mipp::N<T>()>(down);
+
+				for (auto r = 0; r < R; r += 2 * j)
+					for (auto rr = r; rr < r + j; rr++)
+					{
+						const auto a  = mipp::Reg<T>(&values[(rr    ) * W]);
+						const auto b  = mipp::Reg<T>(&values[(rr + j) * W]);
+						const auto lo = mipp::min(a, b);
+						const auto hi = mipp::max(a, b);
+
+						mipp::blend(hi, lo, m_down).store(&values[(rr    ) * W]);
+						mipp::blend(lo, hi, m_down).store(&values[(rr + j) * W]);
+					}
+			}
+		}
+		else
+		{
+			// the two elements are in the same register (or the set is not stored in registers)
+			for (auto x = 0; x < R * W; x += 2 * j)
+			{
+				const auto up = (x & k) == 0;
+				for (auto xx = x; xx < x + j; xx++)
+				{
+					const auto p  = phys(xx,     R, W);
+					const auto q  = phys(xx + j, R, W);
+					const auto a  = values[p];
+					const auto b  = values[q];
+					const auto lo = std::min(a, b);
+					const auto hi = std::max(a, b);
+
+					values[p] = up ? lo : hi;
+					values[q] = up ? hi : lo;
+				}
+			}
+		}
+	}
+
+	static int next_pow2(const int n)
+	{
+		auto p = 1;
+		while (p < n)
+			p <<= 1;
+		return p;
+	}
+};
+}
+}
+
+#endif /* LC_SORTER_BITONIC_HPP */
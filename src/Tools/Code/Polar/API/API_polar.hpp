@@ -5,7 +5,12 @@ namespace aff3ct
 {
 namespace tools
 {
-class API_polar {};
+class API_polar
+{
+public:
+	// true if the API implements the kernels of the generalized nodes (G-PC nodes)
+	static constexpr bool has_generalized_nodes() { return false; }
+};
 }
 }
 
@@ -30,6 +30,8 @@ private:
 public:
 	static constexpr int get_n_frames() { return mipp::nElReg<R>(); }
 
+	static constexpr bool has_generalized_nodes() { return true; }
+
 	template <typename T>
 	static bool isAligned(const T *ptr)
 	{
@@ -219,6 +221,30 @@ public:
 
 		xo0_inter_intra<B, 0, get_n_frames()>::apply(s_b, s_c, n_elmts);
 	}
+
+	// ------------------------------------------------------------------------------------------------------------ gpc
+
+	template <int N_ELMTS = 0, class AB = std::allocator<B>, class AR = std::allocator<R>>
+	static void gpc(std::vector<B,AB> &s, const std::vector<R,AR> &l, const int off_l_a, const int off_s_a,
+	                const int n_elmts, const int n_sub)
+	{
+		const R *__restrict l_a = l.data() + ol(off_l_a);
+		      B *__restrict s_a = s.data() + os(off_s_a);
+
+		gpc_inter_intra<B, R, HI, get_n_frames()>::apply(l_a, s_a, n_elmts / n_sub, n_sub * get_n_frames());
+	}
+
+	// -------------------------------------------------------------------------------------------------------- gpc_rep
+
+	template <int N_ELMTS = 0, class AB = std::allocator<B>, class AR = std::allocator<R>>
+	static void gpc_rep(std::vector<B,AB> &s, const std::vector<R,AR> &l, const int off_l_a, const int off_s_a,
+	                    const int n_elmts, const int n_sub)
+	{
+		const R *__restrict l_a = l.data() + ol(off_l_a);
+		      B *__restrict s_a = s.data() + os(off_s_a);
+
+		gpc_rep_inter_intra<B, R, HI, get_n_frames()>::apply(l_a, s_a, n_elmts / n_sub, n_sub * get_n_frames());
+	}
 };
 }
 }
@@ -32,6 +32,8 @@ class API_polar_dynamic_intra : public API_polar
 public:
 	static constexpr int get_n_frames() { return 1; }
 
+	static constexpr bool has_generalized_nodes() { return true; }
+
 	template <typename T>
 	static bool isAligned(const T *ptr)
 	{
@@ -240,6 +242,32 @@ public:
 		if (n_elmts >= mipp::nElReg<B>()) xo0_inter_intra<B>::apply(s_b, s_c, n_elmts);
 		else                              xo0_seq        <B>::apply(s_b, s_c, n_elmts);
 	}
+
+	// ------------------------------------------------------------------------------------------------------------ gpc
+
+	template <int N_ELMTS = 0, class AB = std::allocator<B>, class AR = std::allocator<R>>
+	static void gpc(std::vector<B,AB> &s, const std::vector<R,AR> &l, const int off_l_a, const int off_s_a,
+	                const int n_elmts, const int n_sub)
+	{
+		const R *__restrict l_a = l.data() + off_l_a;
+		      B *__restrict s_a = s.data() + off_s_a;
+
+		if (n_sub >= mipp::nElReg<R>()) gpc_inter_intra<B, R, HI>::apply(l_a, s_a, n_elmts / n_sub, n_sub);
+		else                             gpc_seq        <B, R, H >::apply(l_a, s_a, n_elmts / n_sub, n_sub);
+	}
+
+	// -------------------------------------------------------------------------------------------------------- gpc_rep
+
+	template <int N_ELMTS = 0, class AB = std::allocator<B>, class AR = std::allocator<R>>
+	static void gpc_rep(std::vector<B,AB> &s, const std::vector<R,AR> &l, const int off_l_a, const int off_s_a,
+	                    const int n_elmts, const int n_sub)
+	{
+		const R *__restrict l_a = l.data() + off_l_a;
+		      B *__restrict s_a = s.data() + off_s_a;
+
+		if (n_sub >= mipp::nElReg<R>()) gpc_rep_inter_intra<B, R, HI>::apply(l_a, s_a, n_elmts / n_sub, n_sub);
+		else                             gpc_rep_seq        <B, R, H >::apply(l_a, s_a, n_elmts / n_sub, n_sub);
+	}
 };
 }
 }
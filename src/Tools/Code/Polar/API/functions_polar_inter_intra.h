@@ -1,6 +1,7 @@
 #ifndef FUNCTIONS_POLAR_INTER_INTRA_H_
 #define FUNCTIONS_POLAR_INTER_INTRA_H_
 
+#include <limits>
 #include <algorithm>
 #ifdef _MSC_VER
 #include <iterator>
@@ -365,6 +366,118 @@ struct xo0_inter_intra <B,0,N_FRAMES>
 #endif
 	}
 };
+
+// ============================================================================================================== gpc()
+// ====================================================================================================================
+// ====================================================================================================================
+
+// the columns of the ('n_rows' x 'n_cols') matrix of LLRs are independent SPC codes (G-PC node), 'n_cols' has to be a
+// multiple of the register size (with the inter-frame strategy, the frames are interleaved in the columns)
+template <typename B, typename R, proto_h_i<B,R> HI, int N_FRAMES = 1>
+struct gpc_inter_intra
+{
+	static void apply(const R *__restrict l_a, B *__restrict s_a, const int n_rows, const int n_cols)
+	{
+		gpc_inter_intra<B,R,HI,N_FRAMES>::decode(l_a, s_a, n_rows, n_cols, nullptr);
+	}
+
+	// 'parity' is the expected parity of the columns for each frame (nullptr if the parities are even)
+	static void decode(const R *__restrict l_a, B *__restrict s_a, const int n_rows, const int n_cols,
+	                   const bool *parity)
+	{
+		constexpr auto stride = mipp::nElmtsPerRegister<R>();
+
+#ifndef _MSC_VER
+		R cur_min_abs[mipp::nElmtsPerRegister<R>()] __attribute__((aligned(MIPP_REQUIRED_ALIGNMENT)));
+		R prod_sign  [mipp::nElmtsPerRegister<R>()] __attribute__((aligned(MIPP_REQUIRED_ALIGNMENT)));
+#else
+		R cur_min_abs[mipp::nElmtsPerRegister<R>()];
+		R prod_sign  [mipp::nElmtsPerRegister<R>()];
+#endif
+
+		for (auto c = 0; c < n_cols; c += stride)
+		{
+			// vectorized part of the SPCs
+			auto r_cur_min_abs = mipp::set1<R>(std::numeric_limits<R>::max());
+			auto r_prod_sign   = mipp::set1<R>((R)1);
+
+			for (auto i = c; i < n_rows * n_cols; i += n_cols)
+			{
+				const auto r_l_a = mipp::load<R>(l_a +i);
+				const auto r_s_a = HI(r_l_a);
+
+				r_cur_min_abs = mipp::min<R>(r_cur_min_abs, mipp::abs<R>(r_l_a));
+				r_prod_sign   = mipp::xorb<R>(r_prod_sign, r_s_a);
+
+				mipp::store<B>(s_a +i, r_s_a);
+			}
+
+			mipp::store<R>(cur_min_abs, r_cur_min_abs);
+			mipp::store<R>(prod_sign,   r_prod_sign  );
+
+			// sequential part of the SPCs
+			for (auto j = 0; j < stride; j++)
+			{
+				const auto expected = parity != nullptr && parity[j % N_FRAMES];
+				if ((prod_sign[j] < 0) != expected) // make the correction
+				{
+					auto i = c + j;
+					while (i < (n_rows -1) * n_cols && std::abs(l_a[i]) != cur_min_abs[j]) i += n_cols;
+					s_a[i] = (s_a[i] == 0) ? bit_init<B>() : 0;
+				}
+			}
+		}
+	}
+};
+
+// the columns are SPC codes that have the same parity in each frame (G-PC node with repeated parities)
+template <typename B, typename R, proto_h_i<B,R> HI, int N_FRAMES = 1>
+struct gpc_rep_inter_intra
+{
+	static void apply(const R *__restrict l_a, B *__restrict s_a, const int n_rows, const int n_cols)
+	{
+		constexpr auto stride = mipp::nElmtsPerRegister<R>();
+
+#ifndef _MSC_VER
+		R cur_min_abs[mipp::nElmtsPerRegister<R>()] __attribute__((aligned(MIPP_REQUIRED_ALIGNMENT)));
+		R prod_sign  [mipp::nElmtsPerRegister<R>()] __attribute__((aligned(MIPP_REQUIRED_ALIGNMENT)));
+#else
+		R cur_min_abs[mipp::nElmtsPerRegister<R>()];
+		R prod_sign  [mipp::nElmtsPerRegister<R>()];
+#endif
+
+		// cost of the even and of the odd parities: sum of the smallest reliabilities of the columns to correct
+		double cost[N_FRAMES][2];
+		for (auto f = 0; f < N_FRAMES; f++)
+			cost[f][0] = cost[f][1] = 0.;
+
+		for (auto c = 0; c < n_cols; c += stride)
+		{
+			auto r_cur_min_abs = mipp::set1<R>(std::numeric_limits<R>::max());
+			auto r_prod_sign   = mipp::set1<R>((R)1);
+
+			for (auto i = c; i < n_rows * n_cols; i += n_cols)
+			{
+				const auto r_l_a = mipp::load<R>(l_a +i);
+
+				r_cur_min_abs = mipp::min<R>(r_cur_min_abs, mipp::abs<R>(r_l_a));
+				r_prod_sign   = mipp::xorb<R>(r_prod_sign, HI(r_l_a));
+			}
+
+			mipp::store<R>(cur_min_abs, r_cur_min_abs);
+			mipp::store<R>(prod_sign,   r_prod_sign  );
+
+			for (auto j = 0; j < stride; j++)
+				cost[j % N_FRAMES][prod_sign[j] >= 0] += (double)cur_min_abs[j];
+		}
+
+		bool parity[N_FRAMES];
+		for (auto f = 0; f < N_FRAMES; f++)
+			parity[f] = cost[f][1] < cost[f][0];
+
+		gpc_inter_intra<B,R,HI,N_FRAMES>::decode(l_a, s_a, n_rows, n_cols, parity);
+	}
+};
 }
 }
 
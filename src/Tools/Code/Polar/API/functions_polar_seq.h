@@ -1,6 +1,7 @@
 #ifndef FUNCTIONS_POLAR_SEQ_H_
 #define FUNCTIONS_POLAR_SEQ_H_
 
+#include <limits>
 #include <algorithm>
 #ifdef _MSC_VER
 #include <iterator>
@@ -347,6 +348,76 @@ struct xo0_seq <B, 0>
 #endif
 	}
 };
+
+// ============================================================================================================== gpc()
+// ====================================================================================================================
+// ====================================================================================================================
+
+// decodes a SPC code whose bits are spaced by 'stride' elements, 'parity' is the expected parity of the codeword
+template <typename B, typename R, proto_h<B,R> H>
+inline void spc_strided_seq(const R *__restrict l_a, B *__restrict s_a, const int n_elmts, const int stride,
+                            const bool parity)
+{
+	auto cur_min_abs = std::numeric_limits<R>::max();
+	auto cur_min_pos = 0;
+	auto cur_parity  = false;
+	for (auto i = 0; i < n_elmts * stride; i += stride)
+	{
+		s_a[i] = H(l_a[i]);
+		auto sign = (s_a[i] == 0) ? 1 : -1;
+		auto abs  = (R)sign * l_a[i];
+
+		if (cur_min_abs > abs)
+		{
+			cur_min_abs = abs;
+			cur_min_pos = i;
+		}
+
+		cur_parity ^= (sign < 0);
+	}
+
+	if (cur_parity != parity)
+		s_a[cur_min_pos] = (s_a[cur_min_pos] == 0) ? bit_init<B>() : 0; // correction
+}
+
+// the 'n_cols' columns of the ('n_rows' x 'n_cols') matrix of LLRs are independent SPC codes (G-PC node)
+template <typename B, typename R, proto_h<B,R> H>
+struct gpc_seq
+{
+	static void apply(const R *__restrict l_a, B *__restrict s_a, const int n_rows, const int n_cols)
+	{
+		for (auto c = 0; c < n_cols; c++)
+			spc_strided_seq<B,R,H>(l_a + c, s_a + c, n_rows, n_cols, false);
+	}
+};
+
+// the columns are SPC codes that all have the same parity (G-PC node with repeated parities): the parity that
+// requires the less reliable corrections is selected
+template <typename B, typename R, proto_h<B,R> H>
+struct gpc_rep_seq
+{
+	static void apply(const R *__restrict l_a, B *__restrict s_a, const int n_rows, const int n_cols)
+	{
+		double cost[2] = {0., 0.};
+		for (auto c = 0; c < n_cols; c++)
+		{
+			auto cur_min_abs = std::numeric_limits<R>::max();
+			auto cur_parity  = false;
+			for (auto i = c; i < n_rows * n_cols; i += n_cols)
+			{
+				auto sign = (H(l_a[i]) == 0) ? 1 : -1;
+				auto abs  = (R)sign * l_a[i];
+				cur_min_abs = std::min(cur_min_abs, (R)abs);
+				cur_parity ^= (sign < 0);
+			}
+			cost[!cur_parity] += (double)cur_min_abs;
+		}
+
+		const auto parity = cost[1] < cost[0];
+		for (auto c = 0; c < n_cols; c++)
+			spc_strided_seq<B,R,H>(l_a + c, s_a + c, n_rows, n_cols, parity);
+	}
+};
 }
 }
 
@@ -0,0 +1,117 @@
+#ifdef _WIN32
+#include <process.h>
+#define getpid _getpid
+#else
+#include <unistd.h>
+#endif
+
+#include <cstdio>
+#include <map>
+#include <mutex>
+#include <tuple>
+#include <fstream>
+#include <iomanip>
+
+#include "Frozenbits_generator.hpp"
+
+using namespace aff3ct::tools;
+
+// best channels already computed in this process: (method name, N, sigma) -> best channels
+static std::map<std::tuple<std::string,int,float>, std::vector<uint32_t>> best_channels_cache;
+static std::mutex                                                         best_channels_mutex;
+
+static std::string db_filename(const std::string &db_path, const std::string &name, const int N, const float sigma)
+{
+	// 9 significant digits are enough to read back exactly the same float value
+	std::ostringstream s_stream;
+	s_stream << db_path << "/" << name << "_N" << N << "_s" << std::setprecision(9) << sigma << ".pc";
+	return s_stream.str();
+}
+
+static bool db_load(const std::string &filename, const int N, std::vector<uint32_t> &best_channels)
+{
+	std::ifstream file(filename.c_str());
+	if (!file.is_open())
+		return false;
+
+	// same format as the files of the "FILE" and "TV" methods
+	int N_file;
+	std::string type, sigma;
+	file >> N_file >> type >> sigma;
+	if (!file.good() || N_file != N)
+		return false;
+
+	for (auto &c : best_channels)
+		if (!(file >> c) || c >= (uint32_t)N)
+			return false;
+
+	return true;
+}
+
+static void db_store(const std::string &filename, const std::string &name, const int N, const float sigma,
+                     const std::vector<uint32_t> &best_channels)
+{
+	// the file is written under a temporary name and then renamed: an other run sharing the same database never reads
+	// a partially written file
+	const auto tmp_filename = filename + ".tmp" + std::to_string((long long)getpid());
+
+	std::ofstream file(tmp_filename.c_str());
+	if (!file.is_open())
+	{
+		std::stringstream message;
+		message << "Impossible to write in the frozen bits database ('filename' = " << tmp_filename << ").";
+		throw runtime_error(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	file << N << std::endl << name << std::endl << std::setprecision(9) << sigma << std::endl;
+	for (auto c : best_channels)
+		file << c << " ";
+	file << std::endl;
+	file.close();
+
+	if (std::rename(tmp_filename.c_str(), filename.c_str()) != 0)
+	{
+		std::remove(tmp_filename.c_str());
+
+		std::stringstream message;
+		message << "Impossible to rename '" << tmp_filename << "' in '" << filename << "'.";
+		throw runtime_error(__FILE__, __LINE__, __func__, message.str());
+	}
+}
+
+void Frozenbits_generator
+::evaluate_cached()
+{
+	const auto name = this->get_cache_name();
+	if (name.empty())
+	{
+		this->evaluate();
+		return;
+	}
+
+	// the lock is kept during the evaluation: when all the threads ask for the same sigma value, only the first one
+	// computes the best channels
+	std::lock_guard<std::mutex> lock(best_channels_mutex);
+
+	const auto key = std::make_tuple(name, this->N, this->sigma);
+	auto it = best_channels_cache.find(key);
+	if (it != best_channels_cache.end())
+	{
+		this->best_channels = it->second;
+		return;
+	}
+
+	if (this->db_path.empty())
+		this->evaluate();
+	else
+	{
+		const auto filename = db_filename(this->db_path, name, this->N, this->sigma);
+		if (!db_load(filename, this->N, this->best_channels))
+		{
+			this->evaluate();
+			db_store(filename, name, this->N, this->sigma, this->best_channels);
+		}
+	}
+
+	best_channels_cache[key] = this->best_channels;
+}
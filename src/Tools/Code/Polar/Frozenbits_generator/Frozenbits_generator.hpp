@@ -9,6 +9,7 @@
 #define FROZENBITS_GENERATOR_HPP_
 
 #include <sstream>
+#include <string>
 #include <vector>
 
 #include "Tools/Exception/exception.hpp"
@@ -30,6 +31,8 @@ protected:
 
 	std::vector<uint32_t> best_channels; /*!< The best channels in a codeword sorted by descending order. */
 
+	std::string db_path; /*!< Directory of the best channels database (empty if there is no database). */
+
 public:
 	/*!
 	 * \brief Constructor.
@@ -71,6 +74,19 @@ public:
 		return this->sigma;
 	}
 
+	/*!
+	 * \brief Sets the directory of the best channels database.
+	 *
+	 * The best channels are loaded from this directory when they have already been computed for the same codeword
+	 * size and the same sigma value, otherwise they are computed and stored in this directory.
+	 *
+	 * \param db_path: the database directory (empty to disable the database).
+	 */
+	void set_db_path(const std::string &db_path)
+	{
+		this->db_path = db_path;
+	}
+
 	/*!
 	 * \brief Generates the frozen bits vector.
 	 *
@@ -86,7 +102,7 @@ public:
 			throw length_error(__FILE__, __LINE__, __func__, message.str());
 		}
 
-		this->evaluate();
+		this->evaluate_cached();
 
 		// init frozen_bits vector, true means frozen bits, false means information bits
 		std::fill(frozen_bits.begin(), frozen_bits.end(), true);
@@ -112,6 +128,25 @@ protected:
 	 * This method fills the internal Frozenbits_generator::best_channels attribute.
 	 */
 	virtual void evaluate() = 0;
+
+	/*!
+	 * \brief Gets the name of the generation method in the best channels cache.
+	 *
+	 * \return the name of the method, an empty string means that the best channels can't be cached.
+	 */
+	virtual std::string get_cache_name() const
+	{
+		return "";
+	}
+
+private:
+	/*!
+	 * \brief Evaluates the best channels or gets them from the process-wide cache (or from the database).
+	 *
+	 * The cache is shared by all the generators of the process (and so by all the simulation threads), it is indexed
+	 * by the generation method name, the codeword size and the sigma value.
+	 */
+	void evaluate_cached();
 };
 }
 }
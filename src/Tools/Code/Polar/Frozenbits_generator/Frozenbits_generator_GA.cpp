@@ -52,6 +52,12 @@ void Frozenbits_generator_GA
 	std::sort(this->best_channels.begin(), this->best_channels.end(), [this](int i1, int i2) { return z[i1] > z[i2]; });
 }
 
+std::string Frozenbits_generator_GA
+::get_cache_name() const
+{
+	return "GA";
+}
+
 double Frozenbits_generator_GA
 ::phi(double t)
 {
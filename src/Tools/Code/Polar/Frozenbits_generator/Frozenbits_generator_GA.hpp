@@ -2,6 +2,7 @@
 #define FROZENBITS_GENERATOR_GA_HPP_
 
 #include <limits>
+#include <string>
 #include <vector>
 
 #include "Frozenbits_generator.hpp"
@@ -36,6 +37,7 @@ public:
 
 protected:
 	void   evaluate();
+	std::string get_cache_name() const;
 	double phi    (double t);
 	double phi_inv(double t);
 };
@@ -25,7 +25,9 @@ Pattern_polar_parser
   pattern_rate1(pattern_rate1),
   polar_tree(new Binary_tree<Pattern_polar_i>(m +1)),
   pattern_types(),
-  leaves_pattern_types()
+  pattern_sub_sizes(),
+  leaves_pattern_types(),
+  parsed_frozen_bits(frozen_bits)
 {
 	this->recursive_allocate_nodes_patterns(this->polar_tree->get_root());
 	this->generate_nodes_indexes           (this->polar_tree->get_root());
@@ -45,7 +47,9 @@ Pattern_polar_parser
   pattern_rate1(patterns[pattern_rate1_id]),
   polar_tree(new Binary_tree<Pattern_polar_i>(m +1)),
   pattern_types(),
-  leaves_pattern_types()
+  pattern_sub_sizes(),
+  leaves_pattern_types(),
+  parsed_frozen_bits(frozen_bits)
 {
 	this->recursive_allocate_nodes_patterns(this->polar_tree->get_root());
 	this->generate_nodes_indexes           (this->polar_tree->get_root());
@@ -61,10 +65,17 @@ Pattern_polar_parser
 void Pattern_polar_parser
 ::notify_frozenbits_update()
 {
+	// the tree does not depend on anything else than the frozen bits
+	if (this->frozen_bits == this->parsed_frozen_bits)
+		return;
+
+	this->parsed_frozen_bits = this->frozen_bits;
+
 	this->recursive_deallocate_nodes_patterns(this->polar_tree->get_root());
 	delete this->polar_tree;
 	this->polar_tree = nullptr;
 	this->pattern_types.clear();
+	this->pattern_sub_sizes.clear();
 	this->leaves_pattern_types.clear();
 
 	this->polar_tree = new Binary_tree<Pattern_polar_i>(m +1);
@@ -126,6 +137,7 @@ void Pattern_polar_parser
 {
 	node_curr->get_c()->set_id((unsigned int)pattern_types.size());
 	pattern_types.push_back((unsigned char)node_curr->get_c()->type());
+	pattern_sub_sizes.push_back(node_curr->get_c()->get_sub_size());
 
 	if (!node_curr->is_leaf()) // stop condition
 	{
@@ -133,8 +145,10 @@ void Pattern_polar_parser
 		this->generate_nodes_indexes(node_curr->get_right()); // recursive call
 	}
 	else
-		leaves_pattern_types.push_back(std::make_pair<unsigned char, int>((unsigned char)node_curr->get_c()->type(),
-		                                                                  node_curr->get_c()->get_size()));
+	{
+		const auto leaves = node_curr->get_c()->get_leaves();
+		leaves_pattern_types.insert(leaves_pattern_types.end(), leaves.begin(), leaves.end());
+	}
 }
 
 void Pattern_polar_parser
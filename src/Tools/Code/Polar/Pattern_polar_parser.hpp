@@ -38,7 +38,9 @@ protected:
 	const Pattern_polar_i               *pattern_rate1; /*!< Terminal pattern when the bit is an information bit. */
 	      Binary_tree<Pattern_polar_i>  *polar_tree;    /*!< Tree of patterns. */
 	      std::vector<unsigned char>     pattern_types; /*!< Tree of patterns represented with a vector of pattern IDs. */
+	      std::vector<int>               pattern_sub_sizes; /*!< Sizes of the sub-blocks of the generalized nodes. */
 	      std::vector<std::pair<unsigned char, int>> leaves_pattern_types;
+	      std::vector<bool>              parsed_frozen_bits; /*!< Frozen bits of the current tree of patterns. */
 
 public:
 	/*!
@@ -109,6 +111,18 @@ public:
 		return (polar_node_t)pattern_types[node_id];
 	}
 
+	/*!
+	 * \brief Gets the size of the sub-blocks of a generalized node (G-REP or G-PC) from the id of the node.
+	 *
+	 * \param node_id: id of the node
+	 *
+	 * \return the size of the sub-blocks (0 if the node is not a generalized node).
+	 */
+	inline int get_node_sub_size(const int node_id) const
+	{
+		return pattern_sub_sizes[node_id];
+	}
+
 	/*!
 	 * \brief Check if a node type exists in the the tree.
 	 *
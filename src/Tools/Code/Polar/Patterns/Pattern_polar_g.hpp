@@ -0,0 +1,71 @@
+#ifndef PATTERN_POLAR_G_HPP_
+#define PATTERN_POLAR_G_HPP_
+
+#include <sstream>
+#include <string>
+
+#include "Tools/Exception/exception.hpp"
+
+#include "Pattern_polar_i.hpp"
+
+namespace aff3ct
+{
+namespace tools
+{
+// common part of the generalized nodes: the node is made of sub-blocks of 'sub_size' bits, 'P' gives the size of the
+// sub-blocks ('P::compute_sub_size', 0 when the node does not match), the processing ('h') and the equivalent leaves
+template <class P, int MIN_LEVEL, int PRIORITY>
+class Pattern_polar_g : public Pattern_polar_i
+{
+protected:
+	const int sub_size; // size of the sub-blocks
+
+	Pattern_polar_g(const int &N, const Binary_node<Pattern_polar_i>* node,
+	                const int min_level = MIN_LEVEL, const int max_level = -1)
+	: Pattern_polar_i(N, node, min_level, max_level), sub_size(P::compute_sub_size(node))
+	{
+		Pattern_polar_g<P,MIN_LEVEL,PRIORITY>::check_min_level(min_level);
+	}
+
+public:
+	Pattern_polar_g(const int min_level = MIN_LEVEL, const int max_level = -1)
+	: Pattern_polar_i(min_level, max_level), sub_size(0)
+	{
+		Pattern_polar_g<P,MIN_LEVEL,PRIORITY>::check_min_level(min_level);
+	}
+
+	virtual Pattern_polar_i* alloc(const int &N, const Binary_node<Pattern_polar_i>* node) const
+	{
+		return new P(N, node, min_level, max_level);
+	}
+
+	virtual ~Pattern_polar_g() {}
+
+	virtual std::string f() const { return ""; }
+	virtual std::string g() const { return ""; }
+
+	virtual int get_sub_size() const { return sub_size; }
+
+	virtual int _match(const int &reverse_graph_depth, const Binary_node<Pattern_polar_i>* node_curr) const
+	{
+		return P::compute_sub_size(node_curr) ? PRIORITY : 0;
+	}
+
+	virtual bool is_terminal() const { return true; }
+
+private:
+	static void check_min_level(const int min_level)
+	{
+		if (min_level < MIN_LEVEL)
+		{
+			std::stringstream message;
+			message << "'min_level' has to be equal or greater than " << MIN_LEVEL << " ('min_level' = "
+			        << min_level << ").";
+			throw invalid_argument(__FILE__, __LINE__, __func__, message.str());
+		}
+	}
+};
+}
+}
+
+#endif /* PATTERN_POLAR_G_HPP_ */
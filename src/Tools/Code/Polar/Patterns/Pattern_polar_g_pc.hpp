@@ -0,0 +1,77 @@
+#ifndef PATTERN_POLAR_G_PC_HPP_
+#define PATTERN_POLAR_G_PC_HPP_
+
+#include <string>
+#include <vector>
+#include <utility>
+
+#include "Pattern_polar_g.hpp"
+
+#include "Pattern_polar_r0.hpp"
+#include "Pattern_polar_r1.hpp"
+
+namespace aff3ct
+{
+namespace tools
+{
+// generalized parity-check node (G-PC): only the first 'sub_size' bits are frozen, the codeword is made of 'sub_size'
+// interleaved SPC codes (Type-III node when 'sub_size' = 2)
+class Pattern_polar_g_pc : public Pattern_polar_g<Pattern_polar_g_pc,3,29>
+{
+	friend Pattern_polar_g<Pattern_polar_g_pc,3,29>;
+
+protected:
+	Pattern_polar_g_pc(const int &N, const Binary_node<Pattern_polar_i>* node,
+	                   const int min_level = 3, const int max_level = -1)
+	: Pattern_polar_g<Pattern_polar_g_pc,3,29>(N, node, min_level, max_level) {}
+
+public:
+	Pattern_polar_g_pc(const int min_level = 3, const int max_level = -1)
+	: Pattern_polar_g<Pattern_polar_g_pc,3,29>(min_level, max_level) {}
+
+	virtual ~Pattern_polar_g_pc() {}
+
+	virtual polar_node_t type()       const { return polar_node_t::G_PC; }
+	virtual std::string  name()       const { return "G-PC";    }
+	virtual std::string  short_name() const { return "gp";      }
+	virtual std::string  fill_color() const { return "#2F6060"; }
+	virtual std::string  font_color() const { return "#FFFFFF"; }
+
+	virtual std::string h() const { return "gpc"; }
+
+	virtual std::vector<std::pair<unsigned char,int>> get_leaves() const
+	{
+		return {std::make_pair((unsigned char)polar_node_t::RATE_0,              sub_size),
+		        std::make_pair((unsigned char)polar_node_t::RATE_1, this->size - sub_size)};
+	}
+
+	// returns the size of the sub-blocks if the node matches the pattern, 0 otherwise
+	static int compute_sub_size(const Binary_node<Pattern_polar_i>* node_curr)
+	{
+		if (node_curr->is_leaf())
+			return 0;
+
+		const auto pattern_left  = node_curr->get_left ()->get_contents();
+		const auto pattern_right = node_curr->get_right()->get_contents();
+
+		if (pattern_right->type() != polar_node_t::RATE_1)
+			return 0;
+
+		// the left node is half frozen and half information bits
+		if (pattern_left->type() == polar_node_t::G_REP_R1 &&
+		    pattern_left->get_sub_size() * 2 == pattern_left->get_size())
+			return pattern_left->get_sub_size();
+		else if (!node_curr->get_left()->is_leaf() &&
+		         node_curr->get_left()->get_left ()->get_contents()->type() == polar_node_t::RATE_0 &&
+		         node_curr->get_left()->get_right()->get_contents()->type() == polar_node_t::RATE_1)
+			return pattern_left->get_size() / 2;
+		else if (pattern_left->type() == polar_node_t::G_PC)
+			return pattern_left->get_sub_size();
+		else
+			return 0;
+	}
+};
+}
+}
+
+#endif /* PATTERN_POLAR_G_PC_HPP_ */
@@ -0,0 +1,72 @@
+#ifndef PATTERN_POLAR_G_PC_REP_HPP_
+#define PATTERN_POLAR_G_PC_REP_HPP_
+
+#include <string>
+#include <vector>
+#include <utility>
+
+#include "Pattern_polar_g.hpp"
+
+#include "Pattern_polar_r1.hpp"
+#include "Pattern_polar_rep.hpp"
+
+namespace aff3ct
+{
+namespace tools
+{
+// parity-check node with repeated parities: only the first 'sub_size' -1 bits are frozen, the codeword is made of
+// 'sub_size' interleaved codes that all have the same parity (Type-IV node when 'sub_size' = 4)
+class Pattern_polar_g_pc_rep : public Pattern_polar_g<Pattern_polar_g_pc_rep,3,29>
+{
+	friend Pattern_polar_g<Pattern_polar_g_pc_rep,3,29>;
+
+protected:
+	Pattern_polar_g_pc_rep(const int &N, const Binary_node<Pattern_polar_i>* node,
+	                       const int min_level = 3, const int max_level = -1)
+	: Pattern_polar_g<Pattern_polar_g_pc_rep,3,29>(N, node, min_level, max_level) {}
+
+public:
+	Pattern_polar_g_pc_rep(const int min_level = 3, const int max_level = -1)
+	: Pattern_polar_g<Pattern_polar_g_pc_rep,3,29>(min_level, max_level) {}
+
+	virtual ~Pattern_polar_g_pc_rep() {}
+
+	virtual polar_node_t type()       const { return polar_node_t::G_PC_REP; }
+	virtual std::string  name()       const { return "G-PC Rep"; }
+	virtual std::string  short_name() const { return "gpr";      }
+	virtual std::string  fill_color() const { return "#2F6030";  }
+	virtual std::string  font_color() const { return "#FFFFFF";  }
+
+	virtual std::string h() const { return "gpc_rep"; }
+
+	virtual std::vector<std::pair<unsigned char,int>> get_leaves() const
+	{
+		return {std::make_pair((unsigned char)polar_node_t::REP,                 sub_size),
+		        std::make_pair((unsigned char)polar_node_t::RATE_1, this->size - sub_size)};
+	}
+
+	// returns the size of the sub-blocks if the node matches the pattern, 0 otherwise
+	static int compute_sub_size(const Binary_node<Pattern_polar_i>* node_curr)
+	{
+		if (node_curr->is_leaf())
+			return 0;
+
+		const auto pattern_left  = node_curr->get_left ()->get_contents();
+		const auto pattern_right = node_curr->get_right()->get_contents();
+
+		if (pattern_right->type() != polar_node_t::RATE_1)
+			return 0;
+
+		// with a REP node of size 2 on the left, the node is a SPC node
+		if (pattern_left->type() == polar_node_t::REP && pattern_left->get_size() >= 4)
+			return pattern_left->get_size();
+		else if (pattern_left->type() == polar_node_t::G_PC_REP)
+			return pattern_left->get_sub_size();
+		else
+			return 0;
+	}
+};
+}
+}
+
+#endif /* PATTERN_POLAR_G_PC_REP_HPP_ */
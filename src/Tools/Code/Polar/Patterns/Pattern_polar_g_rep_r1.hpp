@@ -0,0 +1,71 @@
+#ifndef PATTERN_POLAR_G_REP_R1_HPP_
+#define PATTERN_POLAR_G_REP_R1_HPP_
+
+#include <string>
+#include <vector>
+#include <utility>
+
+#include "Pattern_polar_g.hpp"
+
+#include "Pattern_polar_r0.hpp"
+#include "Pattern_polar_r1.hpp"
+
+namespace aff3ct
+{
+namespace tools
+{
+// generalized repetition node (G-REP) with a rate 1 source: all the bits are frozen except the last 'sub_size' ones,
+// the codeword is the repetition of any 'sub_size'-bit word (Type-I node when 'sub_size' = 2)
+class Pattern_polar_g_rep_r1 : public Pattern_polar_g<Pattern_polar_g_rep_r1,2,30>
+{
+	friend Pattern_polar_g<Pattern_polar_g_rep_r1,2,30>;
+
+protected:
+	Pattern_polar_g_rep_r1(const int &N, const Binary_node<Pattern_polar_i>* node,
+	                       const int min_level = 2, const int max_level = -1)
+	: Pattern_polar_g<Pattern_polar_g_rep_r1,2,30>(N, node, min_level, max_level) {}
+
+public:
+	Pattern_polar_g_rep_r1(const int min_level = 2, const int max_level = -1)
+	: Pattern_polar_g<Pattern_polar_g_rep_r1,2,30>(min_level, max_level) {}
+
+	virtual ~Pattern_polar_g_rep_r1() {}
+
+	virtual polar_node_t type()       const { return polar_node_t::G_REP_R1; }
+	virtual std::string  name()       const { return "G-Rep R1"; }
+	virtual std::string  short_name() const { return "gr1";      }
+	virtual std::string  fill_color() const { return "#6F2E7F";  }
+	virtual std::string  font_color() const { return "#FFFFFF";  }
+
+	virtual std::string h() const { return "g_rep_r1"; }
+
+	virtual std::vector<std::pair<unsigned char,int>> get_leaves() const
+	{
+		return {std::make_pair((unsigned char)polar_node_t::RATE_0, this->size - sub_size),
+		        std::make_pair((unsigned char)polar_node_t::RATE_1,              sub_size)};
+	}
+
+	// returns the size of the sub-blocks if the node matches the pattern, 0 otherwise
+	static int compute_sub_size(const Binary_node<Pattern_polar_i>* node_curr)
+	{
+		if (node_curr->is_leaf())
+			return 0;
+
+		const auto pattern_left  = node_curr->get_left ()->get_contents();
+		const auto pattern_right = node_curr->get_right()->get_contents();
+
+		if (pattern_left->type() != polar_node_t::RATE_0)
+			return 0;
+
+		if (pattern_right->type() == polar_node_t::RATE_1 && pattern_right->get_size() >= 2)
+			return pattern_right->get_size();
+		else if (pattern_right->type() == polar_node_t::G_REP_R1)
+			return pattern_right->get_sub_size();
+		else
+			return 0;
+	}
+};
+}
+}
+
+#endif /* PATTERN_POLAR_G_REP_R1_HPP_ */
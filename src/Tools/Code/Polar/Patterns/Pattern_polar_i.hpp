@@ -7,6 +7,8 @@
 #include <iomanip>
 #include <string>
 #include <typeinfo>
+#include <utility>
+#include <vector>
 
 #include "Tools/Exception/exception.hpp"
 #include "Tools/Algo/Tree/Binary_tree.hpp"
@@ -25,6 +27,10 @@ enum polar_node_t
 	REP_LEFT,
 	REP,
 	SPC,
+	G_REP_R1,
+	G_REP_SPC,
+	G_PC,
+	G_PC_REP,
 	NB_PATTERNS
 };
 
@@ -191,6 +197,15 @@ public:
 	virtual int _match(const int &reverse_graph_depth, const Binary_node<Pattern_polar_i>* node_curr) const = 0;
 
 	virtual bool is_terminal() const = 0;
+
+	// size of the sub-blocks of the generalized nodes (0 for the other nodes)
+	virtual int get_sub_size() const { return 0; }
+
+	// the node seen as a sequence of rate 0, rate 1, REP and SPC leaves (used to extract the information bits)
+	virtual std::vector<std::pair<unsigned char,int>> get_leaves() const
+	{
+		return {std::make_pair((unsigned char)this->type(), this->size)};
+	}
 };
 }
 }
@@ -12,18 +12,26 @@
 #include "Tools/Code/Polar/Patterns/Pattern_polar_rep_left.hpp"
 #include "Tools/Code/Polar/Patterns/Pattern_polar_spc.hpp"
 #include "Tools/Code/Polar/Patterns/Pattern_polar_std.hpp"
+#include "Tools/Code/Polar/Patterns/Pattern_polar_g_rep_r1.hpp"
+#include "Tools/Code/Polar/Patterns/Pattern_polar_g_rep_spc.hpp"
+#include "Tools/Code/Polar/Patterns/Pattern_polar_g_pc.hpp"
+#include "Tools/Code/Polar/Patterns/Pattern_polar_g_pc_rep.hpp"
 
 namespace aff3ct
 {
 namespace tools
 {
-template <class R0   = Pattern_polar_r0,
-          class R0L  = Pattern_polar_r0_left,
-          class R1   = Pattern_polar_r1,
-          class REP  = Pattern_polar_rep,
-          class REPL = Pattern_polar_rep_left,
-          class SPC  = Pattern_polar_spc,
-          class STD  = Pattern_polar_std>
+template <class R0      = Pattern_polar_r0,
+          class R0L     = Pattern_polar_r0_left,
+          class R1      = Pattern_polar_r1,
+          class REP     = Pattern_polar_rep,
+          class REPL    = Pattern_polar_rep_left,
+          class SPC     = Pattern_polar_spc,
+          class STD     = Pattern_polar_std,
+          class GREPR1  = Pattern_polar_g_rep_r1,
+          class GREPSPC = Pattern_polar_g_rep_spc,
+          class GPC     = Pattern_polar_g_pc,
+          class GPCREP  = Pattern_polar_g_pc_rep>
 std::vector<Pattern_polar_i*> nodes_parser(const std::string &str_polar, int &idx_r0, int &idx_r1);
 }
 }
@@ -9,7 +9,42 @@
 
 #include "nodes_parser.h"
 
-template <class R0, class R0L, class R1, class REP, class REPL, class SPC, class STD>
+namespace aff3ct
+{
+namespace tools
+{
+// allocates a pattern from its description: "NAME" (all the sizes), "NAME_4" (size 4 only), "NAME_4+" (size 4 and
+// bigger) or "NAME_4-16" (sizes from 4 to 16)
+template <class P>
+Pattern_polar_i* alloc_node_pattern(const std::vector<std::string> &v_str1)
+{
+	if (v_str1.size() == 1)
+		return new P;
+
+	auto v_str2 = split(v_str1[1], '-');
+
+	if (v_str2.size() > 1)
+	{
+		auto min = (int)std::log2(std::stoi(v_str2[0]));
+		auto max = (int)std::log2(std::stoi(v_str2[1]));
+
+		return new P(min, max);
+	}
+	else
+	{
+		bool plus = v_str2[0].find("+") != std::string::npos;
+
+		auto min = (int)std::log2(std::stoi(v_str2[0]));
+
+		if (plus) return new P(min     );
+		else      return new P(min, min);
+	}
+}
+}
+}
+
+template <class R0, class R0L, class R1, class REP, class REPL, class SPC, class STD,
+          class GREPR1, class GREPSPC, class GPC, class GPCREP>
 std::vector<aff3ct::tools::Pattern_polar_i*> aff3ct::tools
 ::nodes_parser(const std::string &str_polar, int &idx_r0, int &idx_r1)
 {
@@ -36,165 +71,31 @@ std::vector<aff3ct::tools::Pattern_polar_i*> aff3ct::tools
 		if (v_str1.size() >= 1)
 		{
 			if (v_str1[0] == "R0L")
-			{
-				if (v_str1.size() == 1)
-					polar_patterns.push_back(new R0L);
-				else
-				{
-					auto v_str2 = split(v_str1[1], '-');
-
-					if (v_str2.size() > 1)
-					{
-						auto min = (int)std::log2(std::stoi(v_str2[0]));
-						auto max = (int)std::log2(std::stoi(v_str2[1]));
-
-						polar_patterns.push_back(new R0L(min, max));
-					}
-					else
-					{
-						bool plus = v_str2[0].find("+") != std::string::npos;
-
-						auto min = (int)std::log2(std::stoi(v_str2[0]));
-
-						if (plus) polar_patterns.push_back(new R0L(min     ));
-						else      polar_patterns.push_back(new R0L(min, min));
-					}
-				}
-			}
+				polar_patterns.push_back(alloc_node_pattern<R0L>(v_str1));
 			else if (v_str1[0] == "R0")
 			{
 				idx_r0 = (int)polar_patterns.size();
-
-				if (v_str1.size() == 1)
-					polar_patterns.push_back(new R0);
-				else
-				{
-					auto v_str2 = split(v_str1[1], '-');
-
-					if (v_str2.size() > 1)
-					{
-						auto min = (int)std::log2(std::stoi(v_str2[0]));
-						auto max = (int)std::log2(std::stoi(v_str2[1]));
-
-						polar_patterns.push_back(new R0(min, max));
-					}
-					else
-					{
-						bool plus = v_str2[0].find("+") != std::string::npos;
-
-						auto min = (int)std::log2(std::stoi(v_str2[0]));
-
-						if (plus) polar_patterns.push_back(new R0(min     ));
-						else      polar_patterns.push_back(new R0(min, min));
-					}
-				}
+				polar_patterns.push_back(alloc_node_pattern<R0>(v_str1));
 			}
 			else if (v_str1[0] == "R1")
 			{
 				idx_r1 = (int)polar_patterns.size();
-
-				if (v_str1.size() == 1)
-					polar_patterns.push_back(new R1);
-				else
-				{
-					auto v_str2 = split(v_str1[1], '-');
-
-					if (v_str2.size() > 1)
-					{
-						auto min = (int)std::log2(std::stoi(v_str2[0]));
-						auto max = (int)std::log2(std::stoi(v_str2[1]));
-
-						polar_patterns.push_back(new R1(min, max));
-					}
-					else
-					{
-						bool plus = v_str2[0].find("+") != std::string::npos;
-
-						auto min = (int)std::log2(std::stoi(v_str2[0]));
-
-						if (plus) polar_patterns.push_back(new R1(min     ));
-						else      polar_patterns.push_back(new R1(min, min));
-					}
-				}
+				polar_patterns.push_back(alloc_node_pattern<R1>(v_str1));
 			}
 			else if (v_str1[0] == "REPL")
-			{
-				if (v_str1.size() == 1)
-					polar_patterns.push_back(new REPL);
-				else
-				{
-					auto v_str2 = split(v_str1[1], '-');
-
-					if (v_str2.size() > 1)
-					{
-						auto min = (int)std::log2(std::stoi(v_str2[0]));
-						auto max = (int)std::log2(std::stoi(v_str2[1]));
-
-						polar_patterns.push_back(new REPL(min, max));
-					}
-					else
-					{
-						bool plus = v_str2[0].find("+") != std::string::npos;
-
-						auto min = (int)std::log2(std::stoi(v_str2[0]));
-
-						if (plus) polar_patterns.push_back(new REPL(min     ));
-						else      polar_patterns.push_back(new REPL(min, min));
-					}
-				}
-			}
+				polar_patterns.push_back(alloc_node_pattern<REPL>(v_str1));
 			else if (v_str1[0] == "REP")
-			{
-				if (v_str1.size() == 1)
-					polar_patterns.push_back(new REP);
-				else
-				{
-					auto v_str2 = split(v_str1[1], '-');
-
-					if (v_str2.size() > 1)
-					{
-						auto min = (int)std::log2(std::stoi(v_str2[0]));
-						auto max = (int)std::log2(std::stoi(v_str2[1]));
-
-						polar_patterns.push_back(new REP(min, max));
-					}
-					else
-					{
-						bool plus = v_str2[0].find("+") != std::string::npos;
-
-						auto min = (int)std::log2(std::stoi(v_str2[0]));
-
-						if (plus) polar_patterns.push_back(new REP(min     ));
-						else      polar_patterns.push_back(new REP(min, min));
-					}
-				}
-			}
+				polar_patterns.push_back(alloc_node_pattern<REP>(v_str1));
 			else if (v_str1[0] == "SPC")
-			{
-				if (v_str1.size() == 1)
-					polar_patterns.push_back(new SPC);
-				else
-				{
-					auto v_str2 = split(v_str1[1], '-');
-
-					if (v_str2.size() > 1)
-					{
-						auto min = (int)std::log2(std::stoi(v_str2[0]));
-						auto max = (int)std::log2(std::stoi(v_str2[1]));
-
-						polar_patterns.push_back(new SPC(min, max));
-					}
-					else
-					{
-						bool plus = v_str2[0].find("+") != std::string::npos;
-
-						auto min = (int)std::log2(std::stoi(v_str2[0]));
-
-						if (plus) polar_patterns.push_back(new SPC(min     ));
-						else      polar_patterns.push_back(new SPC(min, min));
-					}
-				}
-			}
+				polar_patterns.push_back(alloc_node_pattern<SPC>(v_str1));
+			else if (v_str1[0] == "GREPR1")
+				polar_patterns.push_back(alloc_node_pattern<GREPR1>(v_str1));
+			else if (v_str1[0] == "GREPSPC")
+				polar_patterns.push_back(alloc_node_pattern<GREPSPC>(v_str1));
+			else if (v_str1[0] == "GPC")
+				polar_patterns.push_back(alloc_node_pattern<GPC>(v_str1));
+			else if (v_str1[0] == "GPCREP")
+				polar_patterns.push_back(alloc_node_pattern<GPCREP>(v_str1));
 			else
 			{
 				std::clog << format_warning("Unrecognized Polar node type (" + v_polar[i] + ").") << std::endl;
@@ -1,3 +1,5 @@
+#include "Tools/Perf/Reorderer/Reorderer.hpp"
+
 #include "CRC_checker.hpp"
 
 using namespace aff3ct;
@@ -9,7 +11,8 @@ CRC_checker<B,R>
 : Post_processing_SISO<B,R>(),
   start_crc_check_ite   (start_crc_check_ite   ),
   simd_inter_frame_level(simd_inter_frame_level),
-  crc                   (crc                   )
+  crc                   (crc                   ),
+  s_frames_ptr          (simd_inter_frame_level)
 {
 }
 
@@ -42,7 +45,18 @@ bool CRC_checker<B,R>
 		for (auto i = loop_size1 * mipp::nElReg<R>(); i < loop_size2; i++)
 			s[i] = (sys[i] + ext[i]) < 0;
 
-		return crc.check(s, simd_inter_frame_level);
+		if (simd_inter_frame_level == 1)
+			return crc.check(s, simd_inter_frame_level);
+
+		// the CRC is checked frame by frame: the decoding can stop only when all the frames of the SIMD register
+		// are valid
+		const auto frame_size = (int)s.size() / simd_inter_frame_level;
+		s_frames.resize(s.size());
+		for (auto f = 0; f < simd_inter_frame_level; f++)
+			s_frames_ptr[f] = s_frames.data() + f * frame_size;
+		Reorderer<B>::apply_rev(s.data(), s_frames_ptr, frame_size);
+
+		return crc.check(s_frames, simd_inter_frame_level);
 	}
 
 	return false;
@@ -1,6 +1,8 @@
 #ifndef CRC_CHECKER_HPP
 #define CRC_CHECKER_HPP
 
+#include <vector>
+
 #include "Module/CRC/CRC.hpp"
 
 #include "../Post_processing_SISO.hpp"
@@ -17,6 +19,11 @@ protected:
 	const int             simd_inter_frame_level;
 	      module::CRC<B> &crc;
 
+	// in the inter-frame SIMD decoders the hard decisions are interleaved (one frame per SIMD lane), they are
+	// deinterleaved in these buffers before the CRC check
+	mipp::vector<B>  s_frames;
+	std::vector<B*>  s_frames_ptr;
+
 public:
 	CRC_checker(module::CRC<B> &crc, const int start_crc_check_ite = 2, const int simd_inter_frame_level = 1);
 
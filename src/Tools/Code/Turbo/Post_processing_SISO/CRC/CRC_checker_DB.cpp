@@ -1,5 +1,7 @@
 #include <algorithm>
 
+#include "Tools/Perf/Reorderer/Reorderer.hpp"
+
 #include "CRC_checker_DB.hpp"
 
 using namespace aff3ct;
@@ -31,14 +33,27 @@ bool CRC_checker_DB<B,R>
 		for (auto i = 0; i < (int)apost.size(); i++)
 			apost[i] = sys[i] + ext[i];
 
-		// compute the hard decision (for the CRC)
-		const auto loop_size = (int)s.size();
+		// compute the hard decision (for the CRC), the frames are interleaved with the inter-frame SIMD
+		const auto n_frames  = this->simd_inter_frame_level;
+		const auto loop_size = (int)s.size() / n_frames;
 		for (auto i = 0; i < loop_size; i+=2)
-		{
-			s[i  ] = (std::max(apost[2*i+2], apost[2*i+3]) - std::max(apost[2*i+0], apost[2*i+1])) > 0;
-			s[i+1] = (std::max(apost[2*i+1], apost[2*i+3]) - std::max(apost[2*i+0], apost[2*i+2])) > 0;
-		}
-		return this->crc.check(s, this->simd_inter_frame_level);
+			for (auto f = 0; f < n_frames; f++)
+			{
+				const auto post = [&](const int l) { return apost[(2*i+l) * n_frames + f]; };
+				s[(i  ) * n_frames + f] = (std::max(post(2), post(3)) - std::max(post(0), post(1))) > 0;
+				s[(i+1) * n_frames + f] = (std::max(post(1), post(3)) - std::max(post(0), post(2))) > 0;
+			}
+
+		if (n_frames == 1)
+			return this->crc.check(s, n_frames);
+
+		// same as 'CRC_checker': the CRC is checked on the deinterleaved frames
+		this->s_frames.resize(s.size());
+		for (auto f = 0; f < n_frames; f++)
+			this->s_frames_ptr[f] = this->s_frames.data() + f * loop_size;
+		Reorderer<B>::apply_rev(s.data(), this->s_frames_ptr, loop_size);
+
+		return this->crc.check(this->s_frames, n_frames);
 	}
 
 	return false;
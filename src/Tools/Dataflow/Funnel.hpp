@@ -0,0 +1,93 @@
+/*!
+ * \file
+ * \brief A merge node: binds input sockets to the outputs of the last path executed by a router.
+ *
+ * \section LICENSE
+ * This file is under MIT license (https://opensource.org/licenses/MIT).
+ */
+#ifndef DATAFLOW_FUNNEL_HPP_
+#define DATAFLOW_FUNNEL_HPP_
+
+#include <vector>
+#include <sstream>
+
+#include "Tools/Exception/exception.hpp"
+#include "Module/Socket.hpp"
+
+#include "Router.hpp"
+
+namespace aff3ct
+{
+namespace tools
+{
+/*!
+ * \class Funnel
+ *
+ * \brief A merge node: the input sockets which follow a router are bound to the output sockets of the path which has
+ *        been executed (native equivalent of the SC_Funnel). Only the data pointers are updated, the data are not
+ *        copied.
+ */
+class Funnel : public Node
+{
+protected:
+	const Router &router;
+
+	std::vector<module::Socket*> sinks;
+	std::vector<module::Socket*> sources1;
+	std::vector<module::Socket*> sources2;
+
+public:
+	/*!
+	 * \brief Constructor.
+	 *
+	 * \param router: the router which selects the path.
+	 */
+	explicit Funnel(const Router &router)
+	: router(router)
+	{
+	}
+
+	virtual ~Funnel()
+	{
+	}
+
+	/*!
+	 * \brief Adds an input socket to merge.
+	 *
+	 * \param sink:    the input socket to bind.
+	 * \param source1: the output socket of the first  path of the router.
+	 * \param source2: the output socket of the second path of the router.
+	 *
+	 * \return the funnel itself.
+	 */
+	Funnel& add(module::Socket &sink, module::Socket &source1, module::Socket &source2)
+	{
+		if (source1.get_databytes() != sink.get_databytes() || source2.get_databytes() != sink.get_databytes())
+		{
+			std::stringstream message;
+			message << "'source1.get_databytes()' and 'source2.get_databytes()' have to be equal to "
+			        << "'sink.get_databytes()' ('source1.get_databytes()' = " << source1.get_databytes()
+			        << ", 'source2.get_databytes()' = " << source2.get_databytes()
+			        << ", 'sink.get_databytes()' = " << sink.get_databytes() << ").";
+			throw invalid_argument(__FILE__, __LINE__, __func__, message.str());
+		}
+
+		sinks   .push_back(&sink   );
+		sources1.push_back(&source1);
+		sources2.push_back(&source2);
+
+		return *this;
+	}
+
+	int exec()
+	{
+		const auto &sources = router.get_path() ? sources2 : sources1;
+		for (size_t i = 0; i < sinks.size(); i++)
+			sinks[i]->bind(sources[i]->get_dataptr());
+		return 0;
+	}
+};
+}
+}
+
+#endif /* DATAFLOW_FUNNEL_HPP_ */
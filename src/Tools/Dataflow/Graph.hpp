@@ -0,0 +1,106 @@
+/*!
+ * \file
+ * \brief A dataflow graph: owns its nodes and executes them from a root node.
+ *
+ * \section LICENSE
+ * This file is under MIT license (https://opensource.org/licenses/MIT).
+ */
+#ifndef DATAFLOW_GRAPH_HPP_
+#define DATAFLOW_GRAPH_HPP_
+
+#include <vector>
+#include <utility>
+
+#include "Tools/Exception/exception.hpp"
+
+#include "Node.hpp"
+#include "Loop.hpp"
+#include "Router.hpp"
+#include "Funnel.hpp"
+
+namespace aff3ct
+{
+namespace tools
+{
+/*!
+ * \class Graph
+ *
+ * \brief A dataflow graph: owns its nodes and executes them from a root node.
+ *
+ * The graph is built once from tasks whose sockets are already bound, then executed once per frame. A graph is
+ * executed by one thread at a time: the multi-threaded runs use one graph (and one set of modules) per thread.
+ */
+class Graph : public Node
+{
+protected:
+	std::vector<Node*     > nodes;
+	std::vector<Predicate*> predicates;
+	Node *root;
+
+public:
+	Graph()
+	: root(nullptr)
+	{
+	}
+
+	virtual ~Graph()
+	{
+		for (auto n : nodes)
+			delete n;
+		for (auto p : predicates)
+			delete p;
+	}
+
+	/*!
+	 * \brief Creates a node owned by the graph.
+	 *
+	 * \param args: the arguments of the node constructor.
+	 *
+	 * \return the created node.
+	 */
+	template <class N, typename... Args>
+	N& create(Args&&... args)
+	{
+		auto n = new N(std::forward<Args>(args)...);
+		nodes.push_back(n);
+		return *n;
+	}
+
+	/*!
+	 * \brief Creates a predicate owned by the graph (to be evaluated by a Predicate_node).
+	 *
+	 * \param args: the arguments of the predicate constructor.
+	 *
+	 * \return the created predicate.
+	 */
+	template <class P, typename... Args>
+	P& create_predicate(Args&&... args)
+	{
+		auto p = new P(std::forward<Args>(args)...);
+		predicates.push_back(p);
+		return *p;
+	}
+
+	/*!
+	 * \brief Sets the first node to execute.
+	 *
+	 * \param root: the root node.
+	 */
+	void set_root(Node &root)
+	{
+		this->root = &root;
+	}
+
+	int exec()
+	{
+		if (root == nullptr)
+			throw runtime_error(__FILE__, __LINE__, __func__, "'root' can't be NULL.");
+
+		root->reset();
+		return root->exec();
+	}
+};
+}
+}
+
+#endif /* DATAFLOW_GRAPH_HPP_ */
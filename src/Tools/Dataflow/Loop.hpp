@@ -0,0 +1,93 @@
+/*!
+ * \file
+ * \brief A bounded loop node with an optional early exit condition.
+ *
+ * \section LICENSE
+ * This file is under MIT license (https://opensource.org/licenses/MIT).
+ */
+#ifndef DATAFLOW_LOOP_HPP_
+#define DATAFLOW_LOOP_HPP_
+
+#include <sstream>
+
+#include "Tools/Exception/exception.hpp"
+
+#include "Node.hpp"
+
+namespace aff3ct
+{
+namespace tools
+{
+/*!
+ * \class Loop
+ *
+ * \brief A bounded loop node: executes the body at most 'n_ite' times. From the iteration 'stop_start', the stop
+ *        node is executed before the body and the loop is exited if its status is not 0 (e.g. a CRC check).
+ */
+class Loop : public Node
+{
+protected:
+	Node       &body;
+	Node       *stop;
+	const int   n_ite;
+	const int   stop_start;
+	      int   n_ite_done;
+
+public:
+	/*!
+	 * \brief Constructor.
+	 *
+	 * \param body:       the body of the loop.
+	 * \param n_ite:      the maximum number of iterations.
+	 * \param stop:       the early exit condition (can be nullptr).
+	 * \param stop_start: the first iteration where the early exit condition is evaluated.
+	 */
+	Loop(Node &body, const int n_ite, Node *stop = nullptr, const int stop_start = 1)
+	: body(body), stop(stop), n_ite(n_ite), stop_start(stop_start), n_ite_done(0)
+	{
+		if (n_ite < 0)
+		{
+			std::stringstream message;
+			message << "'n_ite' has to be equal or greater than 0 ('n_ite' = " << n_ite << ").";
+			throw invalid_argument(__FILE__, __LINE__, __func__, message.str());
+		}
+	}
+
+	virtual ~Loop()
+	{
+	}
+
+	/*!
+	 * \brief Gets the number of times the body has been executed during the last call.
+	 */
+	inline int get_n_ite_done() const
+	{
+		return n_ite_done;
+	}
+
+	int exec()
+	{
+		n_ite_done = 0;
+		for (auto ite = 1; ite <= n_ite; ite++)
+		{
+			if (stop != nullptr && ite >= stop_start && stop->exec())
+				break;
+
+			body.exec();
+			n_ite_done++;
+		}
+
+		return n_ite_done;
+	}
+
+	void reset()
+	{
+		if (stop != nullptr)
+			stop->reset();
+		body.reset();
+	}
+};
+}
+}
+
+#endif /* DATAFLOW_LOOP_HPP_ */
@@ -0,0 +1,189 @@
+/*!
+ * \file
+ * \brief Nodes of the native dataflow runtime: a node wraps a task or a sequence of nodes.
+ *
+ * \section LICENSE
+ * This file is under MIT license (https://opensource.org/licenses/MIT).
+ */
+#ifndef DATAFLOW_NODE_HPP_
+#define DATAFLOW_NODE_HPP_
+
+#include <vector>
+
+#include "Tools/Algo/Predicate.hpp"
+#include "Module/Task.hpp"
+
+namespace aff3ct
+{
+namespace tools
+{
+/*!
+ * \class Node
+ *
+ * \brief A node of a dataflow graph.
+ *
+ * The data are never copied by the nodes: the tasks communicate through their bound sockets.
+ */
+class Node
+{
+public:
+	/*!
+	 * \brief Destructor.
+	 */
+	virtual ~Node()
+	{
+	}
+
+	/*!
+	 * \brief Executes the node.
+	 *
+	 * \return the status of the last executed task.
+	 */
+	virtual int exec() = 0;
+
+	/*!
+	 * \brief Resets the node state (called before each new frame).
+	 */
+	virtual void reset()
+	{
+	}
+};
+
+/*!
+ * \class Task_node
+ *
+ * \brief A node which executes a task.
+ */
+class Task_node : public Node
+{
+protected:
+	module::Task &task;
+
+public:
+	/*!
+	 * \brief Constructor.
+	 *
+	 * \param task: the task to execute.
+	 */
+	explicit Task_node(module::Task &task)
+	: task(task)
+	{
+	}
+
+	virtual ~Task_node()
+	{
+	}
+
+	int exec()
+	{
+		return task.exec();
+	}
+};
+
+/*!
+ * \class Predicate_node
+ *
+ * \brief A node which evaluates a predicate (the status is 1 if the predicate meets the condition(s), 0 otherwise).
+ */
+class Predicate_node : public Node
+{
+protected:
+	Predicate &p;
+
+public:
+	/*!
+	 * \brief Constructor.
+	 *
+	 * \param p: the predicate to evaluate.
+	 */
+	explicit Predicate_node(Predicate &p)
+	: p(p)
+	{
+	}
+
+	virtual ~Predicate_node()
+	{
+	}
+
+	int exec()
+	{
+		return p() ? 1 : 0;
+	}
+
+	void reset()
+	{
+		p.reset();
+	}
+};
+
+/*!
+ * \class Sequence
+ *
+ * \brief A node which executes its children in order.
+ */
+class Sequence : public Node
+{
+protected:
+	std::vector<Node*> nodes;
+	std::vector<Node*> owned_nodes;
+
+public:
+	Sequence()
+	{
+	}
+
+	virtual ~Sequence()
+	{
+		for (auto n : owned_nodes)
+			delete n;
+	}
+
+	/*!
+	 * \brief Adds a node at the end of the sequence.
+	 *
+	 * \param node: the node to add (not owned by the sequence).
+	 *
+	 * \return the sequence itself.
+	 */
+	Sequence& add(Node &node)
+	{
+		nodes.push_back(&node);
+		return *this;
+	}
+
+	/*!
+	 * \brief Adds a task at the end of the sequence.
+	 *
+	 * \param task: the task to add.
+	 *
+	 * \return the sequence itself.
+	 */
+	Sequence& add(module::Task &task)
+	{
+		owned_nodes.push_back(new Task_node(task));
+		return add(*owned_nodes.back());
+	}
+
+	inline bool is_empty() const
+	{
+		return nodes.empty();
+	}
+
+	int exec()
+	{
+		auto status = 0;
+		for (auto n : nodes)
+			status = n->exec();
+		return status;
+	}
+
+	void reset()
+	{
+		for (auto n : nodes)
+			n->reset();
+	}
+};
+}
+}
+
+#endif /* DATAFLOW_NODE_HPP_ */
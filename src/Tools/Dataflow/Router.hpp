@@ -0,0 +1,74 @@
+/*!
+ * \file
+ * \brief A switch node: executes one path out of two depending on a condition node.
+ *
+ * \section LICENSE
+ * This file is under MIT license (https://opensource.org/licenses/MIT).
+ */
+#ifndef DATAFLOW_ROUTER_HPP_
+#define DATAFLOW_ROUTER_HPP_
+
+#include "Node.hpp"
+
+namespace aff3ct
+{
+namespace tools
+{
+/*!
+ * \class Router
+ *
+ * \brief A switch node: executes the condition node then the first path if its status is 0, the second path
+ *        otherwise (native equivalent of the SC_Router).
+ */
+class Router : public Node
+{
+protected:
+	Node &condition;
+	Node &path1;
+	Node &path2;
+	int   path;
+
+public:
+	/*!
+	 * \brief Constructor.
+	 *
+	 * \param condition: the node which selects the path.
+	 * \param path1:     the path executed when the status of the condition is 0.
+	 * \param path2:     the path executed when the status of the condition is not 0.
+	 */
+	Router(Node &condition, Node &path1, Node &path2)
+	: condition(condition), path1(path1), path2(path2), path(0)
+	{
+	}
+
+	virtual ~Router()
+	{
+	}
+
+	/*!
+	 * \brief Gets the last executed path.
+	 *
+	 * \return 0 for the first path, 1 for the second path.
+	 */
+	inline int get_path() const
+	{
+		return path;
+	}
+
+	int exec()
+	{
+		path = condition.exec() ? 1 : 0;
+		return path ? path2.exec() : path1.exec();
+	}
+
+	void reset()
+	{
+		condition.reset();
+		path1    .reset();
+		path2    .reset();
+	}
+};
+}
+}
+
+#endif /* DATAFLOW_ROUTER_HPP_ */
@@ -1,10 +1,13 @@
+#include <limits>
 #include <string>
 #include <vector>
+#include <iomanip>
 #include <sstream>
 #include <iostream>
 
 #include "Tools/Exception/exception.hpp"
 
+#include "Dumper_reduction.hpp"
 #include "Dumper.hpp"
 
 using namespace aff3ct;
@@ -14,7 +17,7 @@ const std::string aff3ct::tools::Dumper::default_ext = "dump";
 
 Dumper
 ::Dumper()
-: add_threshold(0)
+: stream(nullptr), add_threshold(0)
 {
 }
 
@@ -92,6 +95,10 @@ void Dumper
 	if (n_err < this->add_threshold)
 		return;
 
+	// all the data of a frame are sent at once to the writer so the streamed files stay consistent with each other
+	std::vector<std::vector<std::vector<char>>> record(this->stream != nullptr ? this->registered_data_ptr.size() : 0);
+	auto &dst = (this->stream != nullptr) ? record : this->buffer;
+
 	for (auto i = 0; i < (int)this->registered_data_ptr.size(); i++)
 	{
 		if ((unsigned)frame_id < this->registered_data_n_frames[i])
@@ -99,13 +106,16 @@ void Dumper
 			const auto ptr   = this->registered_data_ptr [i];
 			const auto bytes = this->registered_data_size[i] * this->registered_data_sizeof[i];
 
-			this->buffer[i].push_back(std::vector<char>(bytes));
+			dst[i].push_back(std::vector<char>(bytes));
 
 			std::copy(ptr + bytes * (frame_id +0),
 			          ptr + bytes * (frame_id +1),
-			          this->buffer[i][this->buffer[i].size() -1].begin());
+			          dst[i][dst[i].size() -1].begin());
 		}
 	}
+
+	if (this->stream != nullptr)
+		this->stream->push(std::move(record));
 }
 
 void Dumper
@@ -165,7 +175,8 @@ void Dumper
 ::write_header_text(std::ofstream &file, const unsigned n_data, const unsigned data_size,
                     const std::vector<unsigned> &headers)
 {
-	file << n_data    << std::endl << std::endl;
+	// the number of data is padded to a fixed width to be rewritten in place when the file is streamed
+	file << std::setw(std::numeric_limits<unsigned>::digits10 +1) << n_data << std::endl << std::endl;
 	file << data_size << std::endl << std::endl;
 	for (auto h : headers)
 		file << h << " ";
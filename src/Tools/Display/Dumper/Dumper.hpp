@@ -21,6 +21,9 @@ protected:
 
 	std::vector<std::vector<std::vector<char>>> buffer;
 
+	// when not null, the added frames are streamed to the files of this reduction instead of being buffered
+	Dumper_reduction *stream;
+
 	unsigned                           add_threshold;
 	std::vector<const char*>           registered_data_ptr;
 	std::vector<unsigned>              registered_data_size;
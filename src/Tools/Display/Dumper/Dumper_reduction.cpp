@@ -1,3 +1,4 @@
+#include <cstdio>
 #include <string>
 #include <vector>
 #include <sstream>
@@ -11,7 +12,7 @@ using namespace aff3ct::tools;
 
 Dumper_reduction
 ::Dumper_reduction(std::vector<Dumper*> &dumpers)
-: Dumper(), dumpers(dumpers)
+: Dumper(), dumpers(dumpers), max_queue(1024), streaming(false), stop_writer(false)
 {
 	this->checks();
 }
@@ -124,6 +125,7 @@ void Dumper_reduction
 Dumper_reduction
 ::~Dumper_reduction()
 {
+	this->close();
 }
 
 void Dumper_reduction
@@ -140,15 +142,7 @@ void Dumper_reduction
 	if (base_path.empty())
 		throw invalid_argument(__FILE__, __LINE__, __func__, "'base_path' can't be empty.");
 
-	this->buffer             .resize(dumpers[0]->buffer.size());
-	this->registered_data_ptr.resize(dumpers[0]->registered_data_ptr.size());
-
-	this->registered_data_size   = dumpers[0]->registered_data_size;
-	this->registered_data_sizeof = dumpers[0]->registered_data_sizeof;
-	this->registered_data_type   = dumpers[0]->registered_data_type;
-	this->registered_data_ext    = dumpers[0]->registered_data_ext;
-	this->registered_data_bin    = dumpers[0]->registered_data_bin;
-	this->registered_data_head   = dumpers[0]->registered_data_head;
+	this->copy_registered_data();
 
 	for (auto i = 0; i < (int)this->registered_data_ptr.size(); i++)
 	{
@@ -189,6 +183,159 @@ void Dumper_reduction
 	}
 }
 
+void Dumper_reduction
+::copy_registered_data()
+{
+	this->buffer             .resize(dumpers[0]->buffer.size());
+	this->registered_data_ptr.resize(dumpers[0]->registered_data_ptr.size());
+
+	this->registered_data_size   = dumpers[0]->registered_data_size;
+	this->registered_data_sizeof = dumpers[0]->registered_data_sizeof;
+	this->registered_data_type   = dumpers[0]->registered_data_type;
+	this->registered_data_ext    = dumpers[0]->registered_data_ext;
+	this->registered_data_bin    = dumpers[0]->registered_data_bin;
+	this->registered_data_head   = dumpers[0]->registered_data_head;
+}
+
+void Dumper_reduction
+::open(const std::string& base_path)
+{
+	if (this->streaming)
+		throw runtime_error(__FILE__, __LINE__, __func__, "The files are already opened, 'close' has to be called first.");
+
+	this->checks();
+
+	if (base_path.empty())
+		throw invalid_argument(__FILE__, __LINE__, __func__, "'base_path' can't be empty.");
+
+	this->copy_registered_data();
+
+	const auto n_data = this->registered_data_ptr.size();
+	this->files    .clear();
+	this->files    .resize(n_data);
+	this->paths    .resize(n_data);
+	this->n_written.assign(n_data, 0);
+
+	for (size_t i = 0; i < n_data; i++)
+	{
+		const std::string path = base_path + "." + this->registered_data_ext[i];
+		this->paths[i] = path;
+
+		// the headers are written with 0 frames and are rewritten by 'close'
+		if (this->registered_data_bin[i])
+		{
+			this->files[i].open(path, std::ofstream::out | std::ios_base::binary);
+			this->write_header_binary(this->files[i], 0, this->registered_data_size[i], this->registered_data_head[i]);
+		}
+		else
+		{
+			this->files[i].open(path, std::ofstream::out);
+			this->write_header_text(this->files[i], 0, this->registered_data_size[i], this->registered_data_head[i]);
+		}
+
+		if (!this->files[i].is_open())
+		{
+			std::stringstream message;
+			message << "Impossible to open the '" << path << "' file.";
+			throw runtime_error(__FILE__, __LINE__, __func__, message.str());
+		}
+	}
+
+	this->stop_writer = false;
+	this->streaming   = true;
+	this->writer      = std::thread(&Dumper_reduction::write_records, this);
+
+	for (auto d : this->dumpers)
+		d->stream = this;
+}
+
+void Dumper_reduction
+::close(const bool discard)
+{
+	if (!this->streaming)
+		return;
+
+	for (auto d : this->dumpers)
+		d->stream = nullptr;
+
+	{
+		std::lock_guard<std::mutex> lock(this->mtx);
+		if (discard)
+			this->queue.clear();
+		this->stop_writer = true;
+	}
+	this->cv_push.notify_all();
+	this->cv_pop.notify_one();
+	this->writer.join();
+
+	for (size_t i = 0; i < this->files.size(); i++)
+	{
+		if (discard)
+		{
+			this->files[i].close();
+			std::remove(this->paths[i].c_str());
+			continue;
+		}
+
+		// the header has a fixed size: it is rewritten in place with the final number of frames
+		this->files[i].seekp(0);
+		if (this->registered_data_bin[i])
+			this->write_header_binary(this->files[i], this->n_written[i], this->registered_data_size[i],
+			                          this->registered_data_head[i]);
+		else
+			this->write_header_text(this->files[i], this->n_written[i], this->registered_data_size[i],
+			                        this->registered_data_head[i]);
+		this->files[i].close();
+	}
+
+	this->files.clear();
+	this->streaming = false;
+}
+
+void Dumper_reduction
+::push(std::vector<std::vector<std::vector<char>>> &&record)
+{
+	std::unique_lock<std::mutex> lock(this->mtx);
+	this->cv_push.wait(lock, [this]() { return this->queue.size() < this->max_queue; });
+	this->queue.push_back(std::move(record));
+	lock.unlock();
+
+	this->cv_pop.notify_one();
+}
+
+void Dumper_reduction
+::write_records()
+{
+	std::unique_lock<std::mutex> lock(this->mtx);
+	while (true)
+	{
+		this->cv_pop.wait(lock, [this]() { return !this->queue.empty() || this->stop_writer; });
+
+		if (this->queue.empty()) // stop requested and no more pending frames
+			break;
+
+		auto record = std::move(this->queue.front());
+		this->queue.pop_front();
+		lock.unlock();
+		this->cv_push.notify_all();
+
+		for (size_t i = 0; i < record.size(); i++)
+		{
+			const auto size    = this->registered_data_size  [i];
+			const auto size_of = this->registered_data_sizeof[i];
+
+			if (this->registered_data_bin[i])
+				this->write_body_binary(this->files[i], record[i], size * size_of);
+			else
+				this->write_body_text(this->files[i], record[i], size, this->registered_data_type[i]);
+
+			this->n_written[i] += (unsigned)record[i].size();
+		}
+
+		lock.lock();
+	}
+}
+
 void Dumper_reduction
 ::clear()
 {
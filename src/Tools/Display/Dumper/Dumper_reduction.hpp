@@ -1,17 +1,48 @@
 #ifndef DUMPER_REDUCTION_HPP_
 #define DUMPER_REDUCTION_HPP_
 
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <condition_variable>
+
 #include "Dumper.hpp"
 
 namespace aff3ct
 {
 namespace tools
 {
+/*!
+ * \class Dumper_reduction
+ *
+ * \brief Gathers the frames of several dumpers (one per thread) in the same files.
+ *
+ * The frames can be buffered and written at once by dump(), or streamed: open() creates the files and starts a writer
+ * thread which appends the frames as soon as they are added in the dumpers, close() waits for the pending frames and
+ * writes the final number of frames in the file headers. In the streaming mode the memory usage does not depend on
+ * the number of dumped frames. The frames of a file have a fixed size: the frame 'i' of a binary file starts at the
+ * byte 'header_size + i * frame_bytes'.
+ */
 class Dumper_reduction : Dumper
 {
+	friend Dumper;
+
 protected:
 	std::vector<Dumper*> dumpers;
 
+	// streaming mode
+	const size_t                                            max_queue; // number of frames above which 'add' waits
+	bool                                                    streaming;
+	bool                                                    stop_writer;
+	std::vector<std::ofstream>                              files;
+	std::vector<std::string>                                paths;
+	std::vector<unsigned>                                   n_written;
+	std::deque<std::vector<std::vector<std::vector<char>>>> queue;
+	std::thread                                             writer;
+	std::mutex                                              mtx;
+	std::condition_variable                                 cv_push;
+	std::condition_variable                                 cv_pop;
+
 public:
 	explicit Dumper_reduction(std::vector<Dumper*> &dumpers);
 	virtual ~Dumper_reduction();
@@ -20,8 +51,27 @@ public:
 	virtual void add  (const int frame_id = 0      );
 	virtual void clear(                            );
 
+	/*!
+	 * \brief Creates the files and starts to stream the frames added in the dumpers.
+	 *
+	 * \param base_path: the path of the files without the extension.
+	 */
+	void open(const std::string& base_path);
+
+	/*!
+	 * \brief Writes the pending frames, updates the file headers and closes the files.
+	 *
+	 * \param discard: drops the pending frames and removes the files instead (e.g. when the simulation failed).
+	 */
+	void close(const bool discard = false);
+
+protected:
+	void push(std::vector<std::vector<std::vector<char>>> &&record);
+
 private:
 	void checks();
+	void copy_registered_data();
+	void write_records();
 };
 }
 }
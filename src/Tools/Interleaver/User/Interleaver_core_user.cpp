@@ -111,6 +111,29 @@ Interleaver_core_user<T>
 {
 }
 
+template <typename T>
+void Interleaver_core_user<T>
+::select_frames(const int first, const int step)
+{
+	if (first < 0 || step <= 0)
+	{
+		std::stringstream message;
+		message << "'first' has to be positive and 'step' has to be greater than 0 ('first' = " << first
+		        << ", 'step' = " << step << ").";
+		throw invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	std::vector<std::vector<T>> selection;
+	for (auto f = first; f < (int)this->pi_buffer.size(); f += step)
+		selection.push_back(std::move(this->pi_buffer[f]));
+
+	if (selection.empty()) // less interleavers than subsets: play a single one
+		selection.push_back(this->pi_buffer[first % this->pi_buffer.size()]);
+
+	this->pi_buffer = std::move(selection);
+	this->cur_itl_id = 0;
+}
+
 template <typename T>
 void Interleaver_core_user<T>
 ::gen_lut(T *lut, const int frame_id)
@@ -18,6 +18,15 @@ public:
 	Interleaver_core_user(const int size, const std::string &filename, const int n_frames = 1);
 	virtual ~Interleaver_core_user();
 
+	/*!
+	 * \brief Uses only the interleavers 'first', 'first + step', 'first + 2 * step', etc. of the file (allows to split
+	 *        the dumped frames between several interleavers).
+	 *
+	 * \param first: the first interleaver to use.
+	 * \param step:  the gap between two used interleavers.
+	 */
+	void select_frames(const int first, const int step);
+
 protected:
 	void gen_lut(T *lut, const int frame_id);
 };
@@ -0,0 +1,143 @@
+#ifndef BIT_SLICED_H_
+#define BIT_SLICED_H_
+
+#include <algorithm>
+#include <vector>
+#include <type_traits>
+#include <mipp.h>
+
+namespace aff3ct
+{
+namespace tools
+{
+/*
+ * Bit-sliced frames: the bit 'i' of the frame 'f' is the bit 'f % (8 * sizeof(B))' of the element
+ * 'i * mipp::nElReg<B>() + f / (8 * sizeof(B))'. A register holds one bit of 'bs_n_frames<B>()' frames and the bitwise
+ * operations process all these frames at once.
+ *
+ * Small integers are bit-sliced the same way: a counter is an array of registers (its bit planes, LSB first).
+ */
+template <typename B>
+constexpr int bs_n_frames()
+{
+	return mipp::nElReg<B>() * 8 * (int)sizeof(B);
+}
+
+template <typename B>
+inline bool bs_get(const B *words, const int frame)
+{
+	using U = typename std::make_unsigned<B>::type;
+	constexpr int n_bits = 8 * (int)sizeof(B);
+	return ((U)words[frame / n_bits] >> (frame % n_bits)) & (U)1;
+}
+
+template <typename B>
+inline void bs_set(B *words, const int frame)
+{
+	using U = typename std::make_unsigned<B>::type;
+	constexpr int n_bits = 8 * (int)sizeof(B);
+	words[frame / n_bits] = (B)((U)words[frame / n_bits] | ((U)1 << (frame % n_bits)));
+}
+
+// packs the bits (bit != 0) of 'bs_n_frames<B>()' consecutive frames of 'size' elements
+template <typename B>
+inline void bs_pack(const B *in, B *out, const int size)
+{
+	constexpr int n_frames = bs_n_frames<B>();
+	constexpr int n_elmts  = mipp::nElReg<B>();
+
+	std::fill(out, out + size * n_elmts, (B)0);
+	for (auto f = 0; f < n_frames; f++)
+		for (auto i = 0; i < size; i++)
+			if (in[f * size + i] != (B)0)
+				bs_set(&out[i * n_elmts], f);
+}
+
+// packs the hard decisions (LLR < 0) of 'bs_n_frames<B>()' consecutive frames of 'size' LLRs, the LLRs and the bits
+// can have the same type in fixed-point: the two cases are not distinguished by the type of 'in'
+template <typename B, typename R>
+inline void bs_hard_decide(const R *in, B *out, const int size)
+{
+	constexpr int n_frames = bs_n_frames<B>();
+	constexpr int n_elmts  = mipp::nElReg<B>();
+
+	std::fill(out, out + size * n_elmts, (B)0);
+	for (auto f = 0; f < n_frames; f++)
+		for (auto i = 0; i < size; i++)
+			if (in[f * size + i] < (R)0)
+				bs_set(&out[i * n_elmts], f);
+}
+
+// unpacks the bits 'pos[0]', 'pos[1]', ... of 'bs_n_frames<B>()' frames (one bit per element in 'out')
+template <typename B>
+inline void bs_unpack(const B *in, B *out, const unsigned *pos, const int size)
+{
+	constexpr int n_frames = bs_n_frames<B>();
+	constexpr int n_elmts  = mipp::nElReg<B>();
+
+	for (auto f = 0; f < n_frames; f++)
+		for (auto i = 0; i < size; i++)
+			out[f * size + i] = (B)bs_get(&in[pos[i] * n_elmts], f);
+}
+
+// unpacks all the bits of 'bs_n_frames<B>()' frames of 'size' elements (one bit per element in 'out')
+template <typename B>
+inline void bs_unpack(const B *in, B *out, const int size)
+{
+	constexpr int n_frames = bs_n_frames<B>();
+	constexpr int n_elmts  = mipp::nElReg<B>();
+
+	for (auto f = 0; f < n_frames; f++)
+		for (auto i = 0; i < size; i++)
+			out[f * size + i] = (B)bs_get(&in[i * n_elmts], f);
+}
+
+// adds the one bit numbers 'x' to the counters 'planes' at the bit position 'pos' (the carries beyond the last plane
+// are lost)
+template <typename B>
+inline void bs_add(mipp::Reg<B> *planes, const int n_planes, mipp::Reg<B> x, const int pos = 0)
+{
+	for (auto p = pos; p < n_planes; p++)
+	{
+		const auto carry = planes[p] & x;
+		planes[p] ^= x;
+		x = carry;
+	}
+}
+
+// frames in which the counter is greater or equal to the constant 'c'
+template <typename B>
+inline mipp::Reg<B> bs_greater_equal(const mipp::Reg<B> *planes, const int n_planes, const int c)
+{
+	const auto r_zero = mipp::Reg<B>((B)0);
+	const auto r_ones = ~r_zero;
+
+	if (c <= 0)               return r_ones;
+	if ((c >> n_planes) != 0) return r_zero;
+
+	auto gt = r_zero;
+	auto eq = r_ones;
+	for (auto p = n_planes -1; p >= 0; p--)
+		if ((c >> p) & 1)
+			eq &= planes[p];
+		else
+		{
+			gt |= eq & planes[p];
+			eq  = mipp::andnb(planes[p], eq);
+		}
+
+	return gt | eq;
+}
+
+// number of bit planes required to count up to 'max_val'
+inline int bs_n_planes(const int max_val)
+{
+	auto n = 0;
+	while ((max_val >> n) != 0)
+		n++;
+	return n;
+}
+}
+}
+
+#endif /* BIT_SLICED_H_ */
@@ -0,0 +1,157 @@
+#if defined(__linux__) || defined(__linux)
+	#include <pthread.h> // pthread_setaffinity_np
+	#include <sched.h>   // cpu_set_t
+#endif
+
+#include <thread>
+#include <sstream>
+#include <fstream>
+#include <algorithm>
+
+#include "Tools/Exception/exception.hpp"
+
+#include "thread_pinning.h"
+
+using namespace aff3ct;
+
+// parses a list of CPU cores like "0-3,8,10-11" (the format of the Linux "cpulist" files)
+static std::vector<int> parse_cpu_list(const std::string &list)
+{
+	std::vector<int> cpus;
+	std::stringstream ss(list);
+	std::string item;
+
+	while (std::getline(ss, item, ','))
+	{
+		if (item.empty())
+			continue;
+
+		try
+		{
+			auto dash = item.find('-');
+			if (dash == std::string::npos)
+				cpus.push_back(std::stoi(item));
+			else
+			{
+				const auto first = std::stoi(item.substr(0, dash));
+				const auto last  = std::stoi(item.substr(dash +1));
+				for (auto c = first; c <= last; c++)
+					cpus.push_back(c);
+			}
+		}
+		catch (std::exception const&)
+		{
+			std::stringstream message;
+			message << "Wrong CPU list ('list' = " << list << ").";
+			throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+		}
+	}
+
+	for (auto c : cpus)
+		if (c < 0)
+		{
+			std::stringstream message;
+			message << "The CPU ids have to be positive ('list' = " << list << ").";
+			throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+		}
+
+	return cpus;
+}
+
+// returns the CPU cores of each NUMA node, or a single node with all the cores if the topology is unknown
+static std::vector<std::vector<int>> get_numa_nodes()
+{
+	std::vector<std::vector<int>> nodes;
+
+#if defined(__linux__) || defined(__linux)
+	const int max_nodes = 1024;
+	for (auto n = 0; n < max_nodes; n++)
+	{
+		std::ifstream file("/sys/devices/system/node/node" + std::to_string(n) + "/cpulist");
+		if (!file.is_open())
+			continue;
+
+		std::string list;
+		std::getline(file, list);
+
+		auto cpus = parse_cpu_list(list);
+		if (cpus.size())
+			nodes.push_back(cpus);
+	}
+#endif
+
+	if (nodes.empty())
+	{
+		const int n_cpus = std::thread::hardware_concurrency() ? std::thread::hardware_concurrency() : 1;
+		nodes.push_back(std::vector<int>(n_cpus));
+		for (auto c = 0; c < n_cpus; c++)
+			nodes[0][c] = c;
+	}
+
+	return nodes;
+}
+
+std::vector<int> aff3ct::tools::get_cpu_placement(const std::string &policy, const int n_threads)
+{
+	if (policy.empty() || policy == "none" || n_threads <= 0)
+		return std::vector<int>();
+
+	std::vector<int> cpus;
+	if (policy == "compact")
+	{
+		for (auto &node : get_numa_nodes())
+			cpus.insert(cpus.end(), node.begin(), node.end());
+	}
+	else if (policy == "scatter")
+	{
+		const auto nodes = get_numa_nodes();
+		size_t max_size = 0;
+		for (auto &node : nodes)
+			max_size = std::max(max_size, node.size());
+
+		for (size_t c = 0; c < max_size; c++)
+			for (auto &node : nodes)
+				if (c < node.size())
+					cpus.push_back(node[c]);
+	}
+	else
+		cpus = parse_cpu_list(policy);
+
+	if (cpus.empty())
+	{
+		std::stringstream message;
+		message << "No CPU core to pin the threads on ('policy' = " << policy << ").";
+		throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	// when there are more threads than cores, the cores are reused in the same order
+	std::vector<int> placement(n_threads);
+	for (auto t = 0; t < n_threads; t++)
+		placement[t] = cpus[t % cpus.size()];
+
+	return placement;
+}
+
+void aff3ct::tools::pin_thread(const int cpu)
+{
+#if defined(__linux__) || defined(__linux)
+	if (cpu < 0 || cpu >= CPU_SETSIZE)
+	{
+		std::stringstream message;
+		message << "'cpu' has to be positive and smaller than 'CPU_SETSIZE' ('cpu' = " << cpu
+		        << ", 'CPU_SETSIZE' = " << CPU_SETSIZE << ").";
+		throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	cpu_set_t cpu_set;
+	CPU_ZERO(&cpu_set);
+	CPU_SET(cpu, &cpu_set);
+
+	if (auto ret = pthread_setaffinity_np(pthread_self(), sizeof(cpu_set_t), &cpu_set))
+	{
+		std::stringstream message;
+		message << "'pthread_setaffinity_np' returned '" << ret << "' error code ('cpu' = " << cpu << ").";
+		throw tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
+	}
+#endif
+}
@@ -0,0 +1,37 @@
+/*!
+ * \file
+ * \brief Pins the threads on the CPU cores.
+ *
+ * \section LICENSE
+ * This file is under MIT license (https://opensource.org/licenses/MIT).
+ */
+#ifndef THREAD_PINNING_H_
+#define THREAD_PINNING_H_
+
+#include <string>
+#include <vector>
+
+namespace aff3ct
+{
+namespace tools
+{
+/*!
+ * \brief Computes the CPU core of each thread.
+ *
+ * \param policy:    "none", "compact" (fill the NUMA nodes one after the other), "scatter" (round-robin on the NUMA
+ *                   nodes) or an explicit comma separated list of CPU cores (ranges like "0-7" are allowed).
+ * \param n_threads: number of threads to place.
+ * \return the CPU core of each thread (empty if the threads should not be pinned).
+ */
+std::vector<int> get_cpu_placement(const std::string &policy, const int n_threads);
+
+/*!
+ * \brief Pins the calling thread on the given CPU core (does nothing if the OS does not support the pinning).
+ *
+ * \param cpu: the CPU core id.
+ */
+void pin_thread(const int cpu);
+}
+}
+
+#endif // THREAD_PINNING_H_
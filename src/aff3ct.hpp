@@ -24,6 +24,7 @@
 #include <Tools/Perf/Transpose/transpose_selector.h>
 #include <Tools/Perf/Transpose/transpose_NEON.h>
 #include <Tools/Perf/hard_decision.h>
+#include <Tools/Perf/bit_sliced.h>
 #include <Tools/Display/bash_tools.h>
 
 #include <Tools/Interleaver/Random/Interleaver_core_random.hpp>
@@ -42,6 +43,7 @@
 #include <Tools/Math/Galois.hpp>
 #include <Tools/Algo/Sort/LC_sorter.hpp>
 #include <Tools/Algo/Sort/LC_sorter_simd.hpp>
+#include <Tools/Algo/Sort/LC_sorter_bitonic.hpp>
 #include <Tools/Algo/PRNG/PRNG_MT19937_simd.hpp>
 #include <Tools/Algo/PRNG/PRNG_MT19937.hpp>
 #include <Tools/Algo/Predicate.hpp>
@@ -62,6 +64,11 @@
 #include <Tools/SystemC/SC_Predicate.hpp>
 #include <Tools/SystemC/SC_Debug.hpp>
 #include <Tools/SystemC/SC_Duplicator.hpp>
+#include <Tools/Dataflow/Node.hpp>
+#include <Tools/Dataflow/Router.hpp>
+#include <Tools/Dataflow/Funnel.hpp>
+#include <Tools/Dataflow/Loop.hpp>
+#include <Tools/Dataflow/Graph.hpp>
 #include <Tools/Code/Polar/API/API_polar_static_intra_32bit.hpp>
 #include <Tools/Code/Polar/API/API_polar_dynamic_seq.hpp>
 #include <Tools/Code/Polar/API/API_polar.hpp>
@@ -85,6 +92,11 @@
 #include <Tools/Code/Polar/Patterns/Pattern_polar_r1.hpp>
 #include <Tools/Code/Polar/Patterns/Pattern_polar_rep.hpp>
 #include <Tools/Code/Polar/Patterns/Pattern_polar_r0.hpp>
+#include <Tools/Code/Polar/Patterns/Pattern_polar_g.hpp>
+#include <Tools/Code/Polar/Patterns/Pattern_polar_g_rep_r1.hpp>
+#include <Tools/Code/Polar/Patterns/Pattern_polar_g_rep_spc.hpp>
+#include <Tools/Code/Polar/Patterns/Pattern_polar_g_pc.hpp>
+#include <Tools/Code/Polar/Patterns/Pattern_polar_g_pc_rep.hpp>
 #include <Tools/Code/Polar/Pattern_polar_parser.hpp>
 #include <Tools/Code/Polar/Frozenbits_notifier.hpp>
 #include <Tools/Code/LDPC/Standard/DVBS2/DVBS2_constants.hpp>
@@ -166,6 +178,8 @@
 #include <Module/Channel/NO/Channel_NO.hpp>
 #include <Module/Decoder/Decoder_SISO_SIHO.hpp>
 #include <Module/Decoder/Decoder.hpp>
+#include <Module/Decoder/Polar/SCAN/Decoder_polar_SCAN_fast.hpp>
+#include <Module/Decoder/Polar/SCAN/Decoder_polar_SCAN_fast_sys.hpp>
 #include <Module/Decoder/Polar/SCAN/Decoder_polar_SCAN_naive.hpp>
 #include <Module/Decoder/Polar/SCAN/Decoder_polar_SCAN_naive_sys.hpp>
 #include <Module/Decoder/Polar/SC/Decoder_polar_SC_naive.hpp>
@@ -179,8 +193,10 @@
 #include <Module/Decoder/Polar/SCL/CRC/Decoder_polar_SCL_naive_CA_sys.hpp>
 #include <Module/Decoder/Polar/SCL/CRC/Decoder_polar_SCL_MEM_fast_CA_sys.hpp>
 #include <Module/Decoder/Polar/SCL/CRC/Decoder_polar_SCL_fast_CA_sys.hpp>
+#include <Module/Decoder/Polar/SCL/CRC/Decoder_polar_SCL_inter_fast_CA_sys.hpp>
 #include <Module/Decoder/Polar/SCL/CRC/Decoder_polar_SCL_naive_CA.hpp>
 #include <Module/Decoder/Polar/SCL/Decoder_polar_SCL_MEM_fast_sys.hpp>
+#include <Module/Decoder/Polar/SCL/Decoder_polar_SCL_inter_fast_sys.hpp>
 #include <Module/Decoder/Decoder_SIHO_HIHO.hpp>
 #include <Module/Decoder/Decoder_HIHO.hpp>
 #include <Module/Decoder/RSC/BCJR/Seq_generic/Decoder_RSC_BCJR_seq_generic_std_json.hpp>
@@ -194,6 +210,9 @@
 #include <Module/Decoder/RSC/BCJR/Inter/Decoder_RSC_BCJR_inter.hpp>
 #include <Module/Decoder/RSC/BCJR/Inter/Decoder_RSC_BCJR_inter_fast.hpp>
 #include <Module/Decoder/RSC/BCJR/Decoder_RSC_BCJR.hpp>
+#include <Module/Decoder/RSC/BCJR/Inter_generic/Decoder_RSC_BCJR_inter_generic_std.hpp>
+#include <Module/Decoder/RSC/BCJR/Intra_generic/Decoder_RSC_BCJR_intra_generic_std.hpp>
+#include <Module/Decoder/RSC/BCJR/Sub_block/Decoder_RSC_BCJR_sub_block.hpp>
 #include <Module/Decoder/RSC/BCJR/Seq/Decoder_RSC_BCJR_seq_very_fast.hpp>
 #include <Module/Decoder/RSC/BCJR/Seq/Decoder_RSC_BCJR_seq_fast.hpp>
 #include <Module/Decoder/RSC/BCJR/Seq/Decoder_RSC_BCJR_seq_scan.hpp>
@@ -214,12 +233,14 @@
 #include <Module/Decoder/LDPC/BP/Layered/SPA/Decoder_LDPC_BP_layered_sum_product.hpp>
 #include <Module/Decoder/LDPC/BP/Layered/Decoder_LDPC_BP_layered.hpp>
 #include <Module/Decoder/LDPC/BP/Flooding/Gallager/Decoder_LDPC_BP_flooding_Gallager_A.hpp>
+#include <Module/Decoder/LDPC/BP/Flooding/Gallager/Decoder_LDPC_BP_flooding_Gallager_inter.hpp>
 #include <Module/Decoder/LDPC/BP/Flooding/ONMS/Decoder_LDPC_BP_flooding_offset_normalize_min_sum.hpp>
 #include <Module/Decoder/LDPC/BP/Flooding/LSPA/Decoder_LDPC_BP_flooding_log_sum_product.hpp>
 #include <Module/Decoder/LDPC/BP/Flooding/AMS/Decoder_LDPC_BP_flooding_approximate_min_star.hpp>
 #include <Module/Decoder/LDPC/BP/Flooding/SPA/Decoder_LDPC_BP_flooding_sum_product.hpp>
 #include <Module/Decoder/LDPC/BP/Flooding/Decoder_LDPC_BP_flooding.hpp>
 #include <Module/Decoder/LDPC/BP/Decoder_LDPC_BP.hpp>
+#include <Module/Decoder/LDPC/BF/Decoder_LDPC_bit_flipping_inter.hpp>
 #include <Module/Decoder/Decoder_SIHO.hpp>
 #include <Module/Decoder/BCH/Decoder_BCH.hpp>
 #include <Module/Decoder/Generic/Chase/Decoder_chase_std.hpp>
@@ -229,10 +250,13 @@
 #include <Module/Decoder/Decoder_SISO.hpp>
 #include <Module/Decoder/NO/Decoder_NO.hpp>
 #include <Module/Decoder/RA/Decoder_RA.hpp>
+#include <Module/Decoder/RA/Decoder_RA_inter.hpp>
 #include <Module/Decoder/RSC_DB/BCJR/Decoder_RSC_DB_BCJR_generic.hpp>
 #include <Module/Decoder/RSC_DB/BCJR/Decoder_RSC_DB_BCJR_DVB_RCS2.hpp>
 #include <Module/Decoder/RSC_DB/BCJR/Decoder_RSC_DB_BCJR.hpp>
 #include <Module/Decoder/RSC_DB/BCJR/Decoder_RSC_DB_BCJR_DVB_RCS1.hpp>
+#include <Module/Decoder/RSC_DB/BCJR/Decoder_RSC_DB_BCJR_inter.hpp>
+#include <Module/Decoder/RSC_DB/BCJR/Decoder_RSC_DB_BCJR_intra.hpp>
 #include <Module/Decoder/Turbo/Decoder_turbo_fast.hpp>
 #include <Module/Decoder/Turbo/Decoder_turbo.hpp>
 #include <Module/Decoder/Turbo/Decoder_turbo_std.hpp>
@@ -269,6 +293,7 @@
 #include <Module/Modem/CPM/CPE/Encoder_CPE_Rimoldi.hpp>
 #include <Module/Modem/CPM/CPE/Encoder_CPE.hpp>
 #include <Module/Modem/CPM/BCJR/CPM_BCJR.hpp>
+#include <Module/Modem/CPM/BCJR/CPM_BCJR_inter.hpp>
 #include <Module/Modem/User/Modem_user.hpp>
 #include <Module/Modem/QAM/Modem_QAM.hpp>
 #include <Module/Modem/PAM/Modem_PAM.hpp>
@@ -352,6 +377,7 @@
 #include <Factory/Launcher/Launcher.hpp>
 #include <Factory/Simulation/Simulation.hpp>
 #include <Factory/Simulation/EXIT/EXIT.hpp>
+#include <Factory/Simulation/DEC/DEC.hpp>
 #include <Factory/Simulation/BFER/BFER_std.hpp>
 #include <Factory/Simulation/BFER/BFER.hpp>
 #include <Factory/Simulation/BFER/BFER_ite.hpp>
@@ -367,10 +393,12 @@
 #include <Launcher/Code/Turbo/Turbo.hpp>
 #include <Launcher/Simulation/BFER_std.hpp>
 #include <Launcher/Simulation/EXIT.hpp>
+#include <Launcher/Simulation/DEC.hpp>
 #include <Launcher/Simulation/BFER_ite.hpp>
 #include <Launcher/Launcher.hpp>
 #include <Simulation/Simulation.hpp>
 #include <Simulation/EXIT/EXIT.hpp>
+#include <Simulation/DEC/DEC.hpp>
 #include <Simulation/BFER/Standard/BFER_std.hpp>
 #include <Simulation/BFER/Standard/Threads/BFER_std_threads.hpp>
 #include <Simulation/BFER/Standard/SystemC/SC_BFER_std.hpp>